@@ -0,0 +1,497 @@
+// ****************************************************************************
+//
+// LED Audio Follower Class
+// ------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedAudioFollower, which follows the
+// amplitude of blocks of audio samples, per band, in fixed point, and
+// drives LED levels from it.
+//
+// ****************************************************************************
+
+#include <math.h>
+#include <Arduino.h>
+
+#include <CwwLedAudioFollower.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define AUDIO_COEFF_ONE       32768  // envelope coefficient 1.0; Q15
+#define AUDIO_ENVELOPE_BITS   8      // fraction bits of envelope
+#define AUDIO_AMPLITUDE_MAX   32767
+
+// ****************************************************************************
+// LED Audio Follower Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedAudioFollower::CwwLedAudioFollower (
+  uint16_t     sampleRate,
+  uint8_t      bandCapacity,
+  CwwLedBank * bankPtr
+) {
+
+  if ( sampleRate == 0 ) sampleRate = 1;
+  if ( bandCapacity >= CWW_LED_AUDIO_NO_BAND ) bandCapacity = CWW_LED_AUDIO_NO_BAND - 1;
+
+  this->bands        = new structAudioBand [ bandCapacity ];
+  this->bandCapacity = bandCapacity;
+  this->bandCount    = 0;
+
+  this->sampleRate       = sampleRate;
+  this->coeffSampleCount = 0;
+  this->bankPtr          = bankPtr;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedAudioFollower::~CwwLedAudioFollower () {
+
+  delete [] bands;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+uint8_t CwwLedAudioFollower::addBand (
+  CwwLedController         * controllerPtr,
+  const cwwStructLedBiquad * filterPtr
+) {
+
+  structAudioBand * bandPtr;
+
+  if ( bandCount >= bandCapacity ) return CWW_LED_AUDIO_NO_BAND;
+
+  bandPtr = &bands[bandCount];
+
+  bandPtr->controllerPtr = controllerPtr;
+  bandPtr->isFiltered    = filterPtr != NULL;
+  if ( filterPtr != NULL ) bandPtr->filter = *filterPtr;
+  bandPtr->x1 = bandPtr->x2 = bandPtr->y1 = bandPtr->y2 = 0;
+
+  bandPtr->detector       = LED_DETECT_PEAK;
+  bandPtr->envelope       = 0;
+  bandPtr->level          = 0;
+  bandPtr->levelIsWritten = false;
+
+  bandCount++;
+
+  setTiming ( bandCount - 1, 10, 300 );
+  setRange  ( bandCount - 1, 0, AUDIO_AMPLITUDE_MAX );
+
+  return bandCount - 1;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedAudioFollower::setDetector (
+  uint8_t            bandIndex,
+  cwwEnumLedDetector detector
+) {
+
+  if ( bandIndex >= bandCount ) return false;
+
+  bands[bandIndex].detector = detector;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedAudioFollower::setTiming (
+  uint8_t  bandIndex,
+  uint16_t attackMs,
+  uint16_t releaseMs
+) {
+
+  if ( bandIndex >= bandCount ) return false;
+
+  bands[bandIndex].attackMs  = attackMs;
+  bands[bandIndex].releaseMs = releaseMs;
+  calcCoeffs ( &bands[bandIndex] );
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedAudioFollower::setRange (
+  uint8_t  bandIndex,
+  uint16_t floorAmplitude,
+  uint16_t fullAmplitude
+) {
+
+  boolean setIsClean;
+
+  if ( bandIndex >= bandCount ) return false;
+
+  setIsClean = fullAmplitude <= AUDIO_AMPLITUDE_MAX && floorAmplitude < fullAmplitude;
+  if ( fullAmplitude > AUDIO_AMPLITUDE_MAX ) fullAmplitude  = AUDIO_AMPLITUDE_MAX;
+  if ( floorAmplitude >= fullAmplitude     ) floorAmplitude = fullAmplitude - 1;
+
+  // Scale computed once, so that mapping an envelope to a level costs a
+  // multiplication rather than a division; rounded up, so that the full
+  // amplitude reaches 255...
+  bands[bandIndex].floorAmplitude = floorAmplitude;
+  bands[bandIndex].levelScale     = ( ( 255UL << 16 ) + fullAmplitude - floorAmplitude - 1 ) / ( fullAmplitude - floorAmplitude );
+
+  return setIsClean;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedAudioFollower::processBlock (
+  const int16_t * samples,
+  uint16_t        sampleCount
+) {
+
+  uint8_t           bandIndex;
+  structAudioBand * bandPtr;
+  boolean           rawIsMeasured;
+  uint16_t          rawPeak;
+  uint64_t          rawSumSquares;
+  uint16_t          blockPeak;
+  uint64_t          blockSumSquares;
+  uint16_t          blockAmplitude;
+  uint8_t           level;
+
+  if ( sampleCount == 0 ) return;
+
+  // Envelope coefficients depend on the block duration...
+  if ( sampleCount != coeffSampleCount ) {
+    coeffSampleCount = sampleCount;
+    for ( bandIndex = 0; bandIndex < bandCount; bandIndex++ ) calcCoeffs ( &bands[bandIndex] );
+  }
+
+  rawIsMeasured = false;
+  rawPeak       = 0;
+  rawSumSquares = 0;
+
+  if ( bankPtr != NULL ) bankPtr->beginFrame ();
+
+  for ( bandIndex = 0; bandIndex < bandCount; bandIndex++ ) {
+
+    bandPtr = &bands[bandIndex];
+
+    if ( bandPtr->isFiltered ) {
+      filterBlock ( bandPtr, samples, sampleCount, &blockPeak, &blockSumSquares );
+    }
+    else {
+      if ( ! rawIsMeasured ) {
+        measureBlock ( samples, sampleCount, &rawPeak, &rawSumSquares );
+        rawIsMeasured = true;
+      }
+      blockPeak       = rawPeak;
+      blockSumSquares = rawSumSquares;
+    }
+
+    if ( bandPtr->detector == LED_DETECT_RMS ) blockAmplitude = squareRoot ( blockSumSquares / sampleCount );
+    else                                       blockAmplitude = blockPeak;
+
+    level = followBand ( bandPtr, blockAmplitude );
+
+    if ( bandPtr->controllerPtr != NULL && ( level != bandPtr->level || ! bandPtr->levelIsWritten ) ) {
+      bandPtr->controllerPtr->setLevel ( level );
+      bandPtr->levelIsWritten = true;
+    }
+    bandPtr->level = level;
+
+  }
+
+  if ( bankPtr != NULL ) bankPtr->commitFrame ();
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint16_t CwwLedAudioFollower::valueOfEnvelope ( uint8_t bandIndex ) {
+
+  if ( bandIndex >= bandCount ) return 0;
+
+  return bands[bandIndex].envelope >> AUDIO_ENVELOPE_BITS;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedAudioFollower::valueOfLevel ( uint8_t bandIndex ) {
+
+  if ( bandIndex >= bandCount ) return 0;
+
+  return bands[bandIndex].level;
+
+}
+
+// ----------------------------------------------------------------------------
+
+cwwStructLedBiquad CwwLedAudioFollower::lowPass (
+  uint16_t sampleRate,
+  uint16_t cutoffHz,
+  float    q
+) {
+
+  float omega;
+  float alpha;
+  float cosOmega;
+
+  omega    = 2.0 * M_PI * cutoffHz / sampleRate;
+  alpha    = sin ( omega ) / ( 2.0 * q );
+  cosOmega = cos ( omega );
+
+  return quantize ( ( 1.0 - cosOmega ) / 2.0, 1.0 - cosOmega, ( 1.0 - cosOmega ) / 2.0,
+                    1.0 + alpha, -2.0 * cosOmega, 1.0 - alpha );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwStructLedBiquad CwwLedAudioFollower::highPass (
+  uint16_t sampleRate,
+  uint16_t cutoffHz,
+  float    q
+) {
+
+  float omega;
+  float alpha;
+  float cosOmega;
+
+  omega    = 2.0 * M_PI * cutoffHz / sampleRate;
+  alpha    = sin ( omega ) / ( 2.0 * q );
+  cosOmega = cos ( omega );
+
+  return quantize ( ( 1.0 + cosOmega ) / 2.0, - ( 1.0 + cosOmega ), ( 1.0 + cosOmega ) / 2.0,
+                    1.0 + alpha, -2.0 * cosOmega, 1.0 - alpha );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwStructLedBiquad CwwLedAudioFollower::bandPass (
+  uint16_t sampleRate,
+  uint16_t centerHz,
+  float    q
+) {
+
+  float omega;
+  float alpha;
+  float cosOmega;
+
+  omega    = 2.0 * M_PI * centerHz / sampleRate;
+  alpha    = sin ( omega ) / ( 2.0 * q );
+  cosOmega = cos ( omega );
+
+  return quantize ( alpha, 0.0, -alpha, 1.0 + alpha, -2.0 * cosOmega, 1.0 - alpha );
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedAudioFollower::calcCoeffs ( structAudioBand * bandPtr ) {
+
+  bandPtr->attackCoeff  = calcCoeff ( bandPtr->attackMs  );
+  bandPtr->releaseCoeff = calcCoeff ( bandPtr->releaseMs );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedAudioFollower::calcCoeff ( uint16_t timeMs ) {
+
+  uint32_t blockSamples;
+  uint32_t timeSamples;
+
+  // Share of the distance to the block amplitude covered per block, for a
+  // time constant of timeMs: blockSamples / ( blockSamples + timeSamples ),
+  // a first order approximation of 1 - exp ( -blockSamples / timeSamples )
+  // that needs no floating point...
+  blockSamples = coeffSampleCount > 0 ? coeffSampleCount : 1;
+  timeSamples  = (uint32_t) timeMs * sampleRate / 1000;
+
+  return ( (uint32_t) AUDIO_COEFF_ONE * blockSamples ) / ( blockSamples + timeSamples );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedAudioFollower::followBand (
+  structAudioBand * bandPtr,
+  uint16_t          blockAmplitude
+) {
+
+  uint32_t targetEnvelope;
+  uint32_t envelopeAmplitude;
+  uint64_t levelAbove;
+
+  targetEnvelope = (uint32_t) blockAmplitude << AUDIO_ENVELOPE_BITS;
+
+  if ( targetEnvelope > bandPtr->envelope ) {
+    bandPtr->envelope += ( (uint64_t) ( targetEnvelope - bandPtr->envelope ) * bandPtr->attackCoeff ) >> 15;
+  }
+  else {
+    bandPtr->envelope -= ( (uint64_t) ( bandPtr->envelope - targetEnvelope ) * bandPtr->releaseCoeff ) >> 15;
+  }
+
+  envelopeAmplitude = bandPtr->envelope >> AUDIO_ENVELOPE_BITS;
+  if ( envelopeAmplitude <= bandPtr->floorAmplitude ) return 0;
+
+  // The product passes 32 bits above the full amplitude of a narrow range...
+  levelAbove = ( (uint64_t) ( envelopeAmplitude - bandPtr->floorAmplitude ) * bandPtr->levelScale ) >> 16;
+
+  return levelAbove > 255 ? 255 : levelAbove;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedAudioFollower::filterBlock (
+  structAudioBand * bandPtr,
+  const int16_t   * samples,
+  uint16_t          sampleCount,
+  uint16_t        * peakPtr,
+  uint64_t        * sumSquaresPtr
+) {
+
+  cwwStructLedBiquad filter;
+  int32_t            x0, x1, x2, y0, y1, y2;
+  int64_t            accumulator;
+  uint16_t           sampleIndex;
+  uint32_t           magnitude;
+  uint32_t           peak;
+  uint64_t           sumSquares;
+
+  // Filter state in locals for the duration of the block...
+  filter = bandPtr->filter;
+  x1 = bandPtr->x1;  x2 = bandPtr->x2;
+  y1 = bandPtr->y1;  y2 = bandPtr->y2;
+
+  peak       = 0;
+  sumSquares = 0;
+
+  for ( sampleIndex = 0; sampleIndex < sampleCount; sampleIndex++ ) {
+
+    x0 = samples[sampleIndex];
+
+    accumulator = (int64_t) filter.b0 * x0 + (int64_t) filter.b1 * x1 + (int64_t) filter.b2 * x2
+                - (int64_t) filter.a1 * y1 - (int64_t) filter.a2 * y2;
+    y0 = accumulator >> AUDIO_BIQUAD_FP_BITS;
+    if      ( y0 >  AUDIO_AMPLITUDE_MAX     ) y0 =  AUDIO_AMPLITUDE_MAX;
+    else if ( y0 < -AUDIO_AMPLITUDE_MAX - 1 ) y0 = -AUDIO_AMPLITUDE_MAX - 1;
+
+    x2 = x1;  x1 = x0;
+    y2 = y1;  y1 = y0;
+
+    magnitude = y0 < 0 ? -y0 : y0;
+    if ( magnitude > peak ) peak = magnitude;
+    sumSquares += (uint32_t) ( y0 * y0 );
+
+  }
+
+  bandPtr->x1 = x1;  bandPtr->x2 = x2;
+  bandPtr->y1 = y1;  bandPtr->y2 = y2;
+
+  *peakPtr       = peak > AUDIO_AMPLITUDE_MAX ? AUDIO_AMPLITUDE_MAX : peak;
+  *sumSquaresPtr = sumSquares;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedAudioFollower::measureBlock (
+  const int16_t * samples,
+  uint16_t        sampleCount,
+  uint16_t      * peakPtr,
+  uint64_t      * sumSquaresPtr
+) {
+
+  uint16_t sampleIndex;
+  int32_t  sample;
+  int32_t  magnitude;
+  int32_t  peak;
+  uint64_t sumSquares;
+
+  // Plain reductions without early exits or stores, so that compilers can
+  // vectorize the loop...
+  peak       = 0;
+  sumSquares = 0;
+
+  for ( sampleIndex = 0; sampleIndex < sampleCount; sampleIndex++ ) {
+    sample     = samples[sampleIndex];
+    magnitude  = sample < 0 ? -sample : sample;
+    peak       = magnitude > peak ? magnitude : peak;
+    sumSquares += (uint32_t) ( sample * sample );
+  }
+
+  *peakPtr       = peak > AUDIO_AMPLITUDE_MAX ? AUDIO_AMPLITUDE_MAX : peak;
+  *sumSquaresPtr = sumSquares;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedAudioFollower::squareRoot ( uint32_t value ) {
+
+  uint32_t root;
+  uint32_t bit;
+
+  // Bitwise integer square root...
+  root = 0;
+  bit  = 1UL << 30;
+  while ( bit > value ) bit >>= 2;
+
+  while ( bit != 0 ) {
+    if ( value >= root + bit ) {
+      value -= root + bit;
+      root   = ( root >> 1 ) + bit;
+    }
+    else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return root > AUDIO_AMPLITUDE_MAX ? AUDIO_AMPLITUDE_MAX : root;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwStructLedBiquad CwwLedAudioFollower::quantize (
+  float b0,
+  float b1,
+  float b2,
+  float a0,
+  float a1,
+  float a2
+) {
+
+  cwwStructLedBiquad filter;
+  float              scale;
+
+  scale = (float) ( 1L << AUDIO_BIQUAD_FP_BITS ) / a0;
+
+  filter.b0 = lround ( b0 * scale );
+  filter.b1 = lround ( b1 * scale );
+  filter.b2 = lround ( b2 * scale );
+  filter.a1 = lround ( a1 * scale );
+  filter.a2 = lround ( a2 * scale );
+
+  return filter;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,144 @@
+// ****************************************************************************
+//
+// LED Audio Follower Class
+// ------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedAudioFollower class drives LED levels from audio: it takes
+// blocks of 16 bit signed samples (e.g. an ADC DMA buffer on the device,
+// or PCM data read from a WAV file on a host), follows the amplitude of
+// each block, and sets the level of one controller per band.
+//
+// Each band has:
+//
+// - an optional biquad filter (see lowPass, highPass, bandPass), e.g. to
+//   light one LED for bass, one for mid and one for treble,
+// - a detector, taking either the peak or the RMS amplitude of a block,
+// - an envelope with attack and release times, i.e. how fast the level
+//   follows rising and falling amplitudes, and
+// - a range of amplitudes mapped onto levels 0 to 255 (see setRange).
+//
+// All arithmetic is fixed point and all memory is allocated by the
+// constructor, so processBlock() may run right after a DMA transfer
+// completes. Filter coefficients are Q14 (a0 normalized to 1); the design
+// functions use floating point, but only when setting up. The detector
+// loops of unfiltered bands are written so that compilers can vectorize
+// them; their result is shared by all unfiltered bands.
+//
+// ADC samples must be centered on zero (e.g. subtract the midpoint of the
+// ADC range), or passed through a high pass filter.
+//
+// If a bank is given, the levels of each block are written as one bank
+// frame (see CwwLedBank::beginFrame).
+//
+// ****************************************************************************
+
+#ifndef CwwLedAudioFollower_h
+#define CwwLedAudioFollower_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+
+// ============================================================================
+
+#define CWW_LED_AUDIO_NO_BAND   0xFF  // returned by addBand on failure
+#define AUDIO_BIQUAD_FP_BITS    14    // fixed point bits of biquad coefficients
+
+enum cwwEnumLedDetector {
+  LED_DETECT_PEAK,  // largest absolute sample of a block
+  LED_DETECT_RMS    // root mean square of a block
+};
+
+struct cwwStructLedBiquad {  // coefficients; Q14 (see AUDIO_BIQUAD_FP_BITS)
+  int32_t b0;
+  int32_t b1;
+  int32_t b2;
+  int32_t a1;
+  int32_t a2;
+};
+
+// ============================================================================
+
+class CwwLedAudioFollower {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedAudioFollower ( uint16_t     sampleRate,          // Samples per second
+                                   uint8_t      bandCapacity = 1,    // Maximum number of bands
+                                   CwwLedBank * bankPtr      = NULL  // Bank to frame level writes with, if any
+                                 );
+    virtual ~CwwLedAudioFollower ();
+
+    uint8_t addBand ( CwwLedController * controllerPtr, const cwwStructLedBiquad * filterPtr = NULL );
+    // Returns band index or CWW_LED_AUDIO_NO_BAND; controller may be NULL
+    // to only follow the envelope (see valueOfEnvelope).
+
+    boolean setDetector ( uint8_t bandIndex, cwwEnumLedDetector detector );
+    boolean setTiming   ( uint8_t bandIndex, uint16_t attackMs, uint16_t releaseMs );        // defaults: 10 ms, 300 ms
+    boolean setRange    ( uint8_t bandIndex, uint16_t floorAmplitude, uint16_t fullAmplitude ); // to levels 0 and 255; defaults: 0, 32767
+
+    void processBlock ( const int16_t * samples, uint16_t sampleCount );
+
+    uint16_t valueOfEnvelope ( uint8_t bandIndex );  // amplitude, 0 to 32767
+    uint8_t  valueOfLevel    ( uint8_t bandIndex );
+
+    static cwwStructLedBiquad lowPass  ( uint16_t sampleRate, uint16_t cutoffHz, float q = 0.7071 );
+    static cwwStructLedBiquad highPass ( uint16_t sampleRate, uint16_t cutoffHz, float q = 0.7071 );
+    static cwwStructLedBiquad bandPass ( uint16_t sampleRate, uint16_t centerHz, float q = 1.0 );  // 0 dB peak gain
+
+  private:
+
+    // Private Types:
+
+    struct structAudioBand {
+      CwwLedController * controllerPtr;
+      boolean            isFiltered;
+      cwwStructLedBiquad filter;
+      int32_t            x1, x2, y1, y2;  // filter state
+      uint8_t            detector;
+      uint16_t           attackMs;
+      uint16_t           releaseMs;
+      uint16_t           attackCoeff;     // Q15 share of the distance covered per block
+      uint16_t           releaseCoeff;
+      uint16_t           floorAmplitude;
+      uint32_t           levelScale;      // Q16 levels per amplitude above floor
+      uint32_t           envelope;        // amplitude; Q8
+      uint8_t            level;
+      boolean            levelIsWritten;
+    };
+
+    // Private Variables:
+
+    structAudioBand * bands;
+    uint8_t           bandCapacity;
+    uint8_t           bandCount;
+
+    uint16_t     sampleRate;
+    uint16_t     coeffSampleCount;  // block size the envelope coefficients are computed for
+    CwwLedBank * bankPtr;
+
+    // Private Functions:
+
+    void     calcCoeffs  ( structAudioBand * bandPtr );
+    uint16_t calcCoeff   ( uint16_t timeMs );
+    uint8_t  followBand  ( structAudioBand * bandPtr, uint16_t blockAmplitude );
+    void     filterBlock ( structAudioBand * bandPtr, const int16_t * samples, uint16_t sampleCount,
+                           uint16_t * peakPtr, uint64_t * sumSquaresPtr );
+
+    static void               measureBlock ( const int16_t * samples, uint16_t sampleCount, uint16_t * peakPtr, uint64_t * sumSquaresPtr );
+    static uint16_t           squareRoot   ( uint32_t value );
+    static cwwStructLedBiquad quantize     ( float b0, float b1, float b2, float a0, float a1, float a2 );
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
@@ -0,0 +1,237 @@
+// ****************************************************************************
+//
+// LED Bank Class
+// --------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedBank, which refreshes a group of LED
+// controllers as one animation frame.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedBank.h>
+
+// ****************************************************************************
+// LED Bank Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedBank::CwwLedBank (
+  uint16_t       channelCapacity,
+  CwwLedOutput * frameOutputPtr
+) {
+
+  this->channelPtrs     = new CwwLedController * [ channelCapacity ];
+  this->channelCapacity = channelCapacity;
+  this->channelCount    = 0;
+
+  this->frameOutputPtr = frameOutputPtr;
+  this->frameDepth     = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedBank::~CwwLedBank () {
+
+  delete [] channelPtrs;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+boolean CwwLedBank::addChannel ( CwwLedController * controllerPtr ) {
+
+  if ( channelCount >= channelCapacity ) return false;
+
+  channelPtrs[channelCount++] = controllerPtr;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+CwwLedController * CwwLedBank::channel ( uint16_t channelIndex ) {
+
+  return channelIndex < channelCount ? channelPtrs[channelIndex] : NULL;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint16_t CwwLedBank::valueOfChannelCount () {
+
+  return channelCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedBank::valueOfChannelCapacity () {
+
+  return channelCapacity;
+
+}
+
+// ============================================================================
+
+boolean CwwLedBank::updateIsDue () {
+
+  uint16_t channelIndex;
+
+  for ( channelIndex = 0; channelIndex < channelCount; channelIndex++ ) {
+    if ( channelPtrs[channelIndex]->updateIsDue () ) return true;
+  }
+
+  return false;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedBank::updateNow () {
+
+  uint16_t channelIndex;
+  boolean  anyUpdated;
+
+  anyUpdated = false;
+
+  beginFrame ();
+
+  for ( channelIndex = 0; channelIndex < channelCount; channelIndex++ ) {
+    if ( channelPtrs[channelIndex]->updateNow () ) anyUpdated = true;
+  }
+
+  // Commit even if no channel was due, since levels may have been changed
+  // directly (e.g. setMode) since the last frame...
+  commitFrame ();
+
+  return anyUpdated;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedBank::millisUntilUpdate () {
+
+  uint16_t      channelIndex;
+  unsigned long untilChannel;
+  unsigned long untilUpdate;
+
+  untilUpdate = UPDATE_NOT_SCHEDULED;
+
+  for ( channelIndex = 0; channelIndex < channelCount && untilUpdate > 0; channelIndex++ ) {
+    untilChannel = channelPtrs[channelIndex]->millisUntilUpdate ();
+    if ( untilChannel < untilUpdate ) untilUpdate = untilChannel;
+  }
+
+  return untilUpdate;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedBank::checkInvariants () {
+
+  uint16_t channelIndex;
+  uint8_t  stateIssues;
+
+  stateIssues = STATE_ISSUE_NONE;
+
+  for ( channelIndex = 0; channelIndex < channelCount; channelIndex++ ) {
+    stateIssues |= channelPtrs[channelIndex]->checkInvariants ();
+  }
+
+  return stateIssues;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedBank::beginFrame () {
+
+  if ( frameDepth++ == 0 && frameOutputPtr != NULL ) frameOutputPtr->beginFrame ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedBank::commitFrame () {
+
+  if ( frameDepth == 0 ) return;
+
+  if ( --frameDepth == 0 && frameOutputPtr != NULL ) frameOutputPtr->commitFrame ();
+
+}
+
+// ============================================================================
+
+boolean CwwLedBank::applyCommand ( const cwwStructLedCommand & command ) {
+
+  CwwLedController * controllerPtr;
+
+  if ( command.channel >= channelCount ) return false;
+
+  controllerPtr = channelPtrs[command.channel];
+
+  switch ( command.command ) {
+
+    case LED_COMMAND_MODE:
+      if ( command.mode >= LED_MODE_COUNT ) return false;
+      controllerPtr->setMode ( (cwwEnumLedMode) command.mode, command.phaseCount, command.stepAmount );
+      break;
+
+    case LED_COMMAND_LEVEL:
+      controllerPtr->setLevel ( command.level );
+      break;
+
+    case LED_COMMAND_START_SEQUENCE:
+      controllerPtr->startSequence ();
+      break;
+
+    case LED_COMMAND_STOP_SEQUENCE:
+      controllerPtr->stopSequence ();
+      break;
+
+    default:
+      return false;
+
+  }
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedBank::applyCommands (
+  const cwwStructLedCommand * commands,
+  uint16_t                    commandCount
+) {
+
+  uint16_t commandIndex;
+  uint16_t appliedCount;
+
+  appliedCount = 0;
+
+  beginFrame ();
+
+  for ( commandIndex = 0; commandIndex < commandCount; commandIndex++ ) {
+    if ( applyCommand ( commands[commandIndex] ) ) appliedCount++;
+  }
+
+  commitFrame ();
+
+  return appliedCount;
+
+}
+
+// ****************************************************************************
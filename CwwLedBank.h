@@ -0,0 +1,100 @@
+// ****************************************************************************
+//
+// LED Bank Class
+// --------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedBank class groups a number of CwwLedController instances
+// (channels) so that they can be refreshed together, one animation frame
+// at a time. If the channels are bound to an output backend (see
+// CwwLedOutput), the bank brackets each frame with beginFrame() and
+// commitFrame() calls on that backend, allowing the backend to do its
+// per-frame work (e.g. bit plane preparation for a multiplexed matrix,
+// see CwwLedMatrix) once per frame rather than once per level change.
+//
+// The bank does not own the controllers; they need to outlive the bank.
+//
+// Commands (see cwwStructLedCommand) provide a compact, uniform way to
+// set channel modes and levels, e.g. for commands received from other
+// processes or over a serial link. Commands applied between beginFrame()
+// and commitFrame() reach the output backend in the same frame as the
+// regular refresh (updateNow() may be called within an open frame).
+//
+// ****************************************************************************
+
+#ifndef CwwLedBank_h
+#define CwwLedBank_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+
+// ============================================================================
+
+enum cwwEnumLedCommand {
+  LED_COMMAND_MODE,            // setMode ( mode, phaseCount, stepAmount )
+  LED_COMMAND_LEVEL,           // setLevel ( level )
+  LED_COMMAND_START_SEQUENCE,  // startSequence ()
+  LED_COMMAND_STOP_SEQUENCE    // stopSequence ()
+};
+
+struct cwwStructLedCommand {
+  uint16_t channel;     // channel index in bank
+  uint8_t  command;     // see cwwEnumLedCommand
+  uint8_t  mode;        // see cwwEnumLedMode; for LED_COMMAND_MODE
+  uint16_t phaseCount;  // for LED_COMMAND_MODE
+  uint8_t  stepAmount;  // for LED_COMMAND_MODE
+  uint8_t  level;       // for LED_COMMAND_LEVEL
+};
+
+// ============================================================================
+
+class CwwLedBank {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedBank ( uint16_t       channelCapacity,          // Maximum number of channels (controllers) in bank
+                          CwwLedOutput * frameOutputPtr = NULL     // Output backend to notify of frame boundaries, if any
+                        );
+    virtual ~CwwLedBank ();
+
+    boolean            addChannel ( CwwLedController * controllerPtr );  // false if bank is full
+    CwwLedController * channel    ( uint16_t channelIndex );             // NULL if index is out of range
+
+    uint16_t valueOfChannelCount    ();
+    uint16_t valueOfChannelCapacity ();
+
+    boolean       updateIsDue       ();  // true if any channel needs an update
+    boolean       updateNow         ();  // refresh all channels as one frame; true if any channel was updated
+    unsigned long millisUntilUpdate ();  // minimum over all channels (see CwwLedController::millisUntilUpdate)
+
+    uint8_t checkInvariants ();  // cwwEnumLedStateIssue flags of all channels combined; for tests
+
+    void beginFrame  ();  // open a frame; frames may be nested
+    void commitFrame ();  // close a frame; output is committed when outermost frame closes
+
+    boolean  applyCommand  ( const cwwStructLedCommand & command );                       // false if invalid
+    uint16_t applyCommands ( const cwwStructLedCommand * commands, uint16_t commandCount );  // returns count applied
+
+  private:
+
+    // Private Variables:
+
+    CwwLedController ** channelPtrs;
+    uint16_t            channelCapacity;
+    uint16_t            channelCount;
+
+    CwwLedOutput * frameOutputPtr;
+    uint8_t        frameDepth;
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
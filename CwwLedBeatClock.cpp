@@ -0,0 +1,372 @@
+// ****************************************************************************
+//
+// LED Beat Clock Class
+// --------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedBeatClock, a software phase locked
+// loop that sets the rate of the LED timebase from external beat pulses,
+// and class CwwLedPulseTrain, a jittered pulse source for tests.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedBeatClock.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define BEAT_PERIOD_FP_BITS    8    // fraction bits of estimated pulse period
+#define BEAT_LOCK_PULSES       4    // pulses within lock window to lock
+#define BEAT_MISS_PULSES       4    // pulses outside a quarter period to reacquire
+#define BEAT_GAP_BEATS         2    // beats without pulse to unlock
+#define BEAT_RANGE_SHIFT       3    // pulse periods from nominal / 8 to nominal * 8
+#define BEAT_SLEW_BEATS        4    // beats over which timebase phase is corrected
+#define BEAT_SLEW_LIMIT_SHIFT  3    // phase correction at most 1/8 of rate
+
+// ****************************************************************************
+// LED Beat Clock Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedBeatClock::CwwLedBeatClock (
+  unsigned long nominalBeatMs,
+  uint8_t       pulsesPerBeat
+) {
+
+  if ( pulsesPerBeat == 0 ) pulsesPerBeat = 1;
+  if ( nominalBeatMs == 0 ) nominalBeatMs = 1;
+
+  this->nominalPulseUs = nominalBeatMs * 1000 / pulsesPerBeat;
+  this->pulsesPerBeat  = pulsesPerBeat;
+  this->trackingShift  = 3;
+
+  this->pulseTimestamp = 0;
+  this->pulseIsPending = false;
+
+  this->pulseCount   = 0;
+  this->lockCount    = 0;
+  this->missCount    = 0;
+  this->periodUs     = 0;
+  this->expectedUs   = 0;
+  this->phaseErrorUs = 0;
+  this->gridUs       = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedBeatClock::~CwwLedBeatClock () {
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+void CwwLedBeatClock::pulse () {
+
+  pulse ( CwwLedTimebase::sourceMicros () );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedBeatClock::pulse ( unsigned long timestampUs ) {
+
+  pulseTimestamp = timestampUs;
+  pulseIsPending = true;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedBeatClock::updateNow () {
+
+  unsigned long timestampUs;
+  unsigned long pulsePeriod;
+  unsigned long sinceExpected;
+  unsigned long periodCount;
+  long          phaseError;
+  uint8_t       gainShift;
+  int64_t       periodAdjust;
+  uint64_t      nominalPeriod;
+
+  if ( ! pulseIsPending ) {
+    // Hold the tempo when pulses stop, and lock again from scratch when they
+    // resume...
+    if ( pulseCount > 1 && (long) ( CwwLedTimebase::sourceMicros () - expectedUs ) > (long) ( BEAT_GAP_BEATS * pulsesPerBeat * ( periodUs >> BEAT_PERIOD_FP_BITS ) ) ) {
+      pulseCount = 0;
+      lockCount  = 0;
+    }
+    return false;
+  }
+
+  noInterrupts ();
+  timestampUs    = pulseTimestamp;
+  pulseIsPending = false;
+  interrupts ();
+
+  if ( pulseCount == 0 ) {
+    acquire ( timestampUs );
+    return true;
+  }
+
+  sinceExpected = timestampUs - expectedUs;
+
+  if ( pulseCount == 1 ) {
+    // First period measured directly...
+    if ( sinceExpected < nominalPulseUs >> BEAT_RANGE_SHIFT || sinceExpected > nominalPulseUs << BEAT_RANGE_SHIFT ) {
+      acquire ( timestampUs );
+      return true;
+    }
+    periodUs    = (uint64_t) sinceExpected << BEAT_PERIOD_FP_BITS;
+    expectedUs  = timestampUs;
+    gridUs     += nominalPulseUs;
+    pulseCount  = 2;
+    trackRate ();
+    return true;
+  }
+
+  pulsePeriod = periodUs >> BEAT_PERIOD_FP_BITS;
+  periodCount = ( sinceExpected + pulsePeriod / 2 ) / pulsePeriod;
+
+  // Extra pulses (e.g. bounce) are ignored; after a long gap the phase is
+  // acquired again...
+  if ( periodCount == 0 ) return false;
+  if ( periodCount > (unsigned long) BEAT_GAP_BEATS * pulsesPerBeat ) {
+    acquire ( timestampUs );
+    return true;
+  }
+
+  phaseError   = (long) ( sinceExpected - periodCount * pulsePeriod );
+  phaseErrorUs = phaseError;
+
+  if ( (unsigned long) labs ( phaseError ) <= pulsePeriod / 8 ) {
+    if ( lockCount < 255 ) lockCount++;
+  }
+  else {
+    lockCount = 0;
+  }
+
+  // Phase errors of over a quarter period mean a change in tempo rather
+  // than jitter: the gains are widened again, and if that does not catch
+  // up, the phase is acquired again...
+  if ( (unsigned long) labs ( phaseError ) > pulsePeriod / 4 ) {
+    if ( ++missCount >= BEAT_MISS_PULSES ) {
+      acquire ( timestampUs );
+      return true;
+    }
+    pulseCount = 2;
+  }
+  else {
+    missCount = 0;
+  }
+
+  // Alpha-beta filter: phase by a share of the error, period by a smaller
+  // one. Gains start high and narrow down to the tracking setting as
+  // pulses come in, so that the first (single interval) period estimate is
+  // refined quickly...
+  gainShift = 1;
+  while ( gainShift < trackingShift && pulseCount >= 4 << gainShift ) gainShift++;
+
+  expectedUs += periodCount * pulsePeriod + phaseError / ( 1L << gainShift );
+
+  // The Q8 period, and its range, overflow 32 bits for nominal pulses
+  // over 2 s (e.g. tap tempo below 30 BPM)...
+  periodAdjust  = ( (int64_t) phaseError << BEAT_PERIOD_FP_BITS ) / (long) periodCount / ( 1L << ( 2 * gainShift + 1 ) );
+  periodUs      = (int64_t) periodUs + periodAdjust;
+  nominalPeriod = (uint64_t) nominalPulseUs << BEAT_PERIOD_FP_BITS;
+  if ( periodUs < nominalPeriod >> BEAT_RANGE_SHIFT ) periodUs = nominalPeriod >> BEAT_RANGE_SHIFT;
+  if ( periodUs > nominalPeriod << BEAT_RANGE_SHIFT ) periodUs = nominalPeriod << BEAT_RANGE_SHIFT;
+
+  gridUs += periodCount * nominalPulseUs;
+  if ( pulseCount < 255 ) pulseCount++;
+
+  trackRate ();
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedBeatClock::release () {
+
+  pulseCount = 0;
+  lockCount  = 0;
+  missCount  = 0;
+
+  CwwLedTimebase::setRate ( TIMEBASE_RATE_NORMAL );
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedBeatClock::setTracking ( uint8_t trackingShift ) {
+
+  if ( trackingShift < 1 || trackingShift > 6 ) return false;
+
+  this->trackingShift = trackingShift;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedBeatClock::valueOfTracking () {
+
+  return trackingShift;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedBeatClock::isLocked () {
+
+  return pulseCount > 1 && lockCount >= BEAT_LOCK_PULSES;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedBeatClock::valueOfBeatPeriod () {
+
+  return ( periodUs >> BEAT_PERIOD_FP_BITS ) * pulsesPerBeat;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+long CwwLedBeatClock::valueOfPhaseError () {
+
+  return phaseErrorUs;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedBeatClock::acquire ( unsigned long timestampUs ) {
+
+  pulseCount   = 1;
+  lockCount    = 0;
+  missCount    = 0;
+  expectedUs   = timestampUs;
+  phaseErrorUs = 0;
+
+  // The beat grid starts at this pulse; the rate is held until the period
+  // is measured...
+  gridUs = CwwLedTimebase::now () * 1000UL - ( CwwLedTimebase::sourceMicros () - timestampUs );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedBeatClock::trackRate () {
+
+  uint32_t tempoRate;
+  int64_t  sinceExpected;
+  long     timeErrorUs;
+  int64_t  phaseRate;
+  int64_t  phaseRateLimit;
+
+  // Rate at which the nominal pulse period passes in one actual period...
+  tempoRate = ( ( (uint64_t) nominalPulseUs << BEAT_PERIOD_FP_BITS ) << 16 ) / periodUs;
+
+  // Timebase time against the beat grid, projected to now; the difference
+  // is slewed out over a few beats. The filtered time of the latest pulse
+  // may lie ahead of now...
+  sinceExpected = (int64_t) (long) ( CwwLedTimebase::sourceMicros () - expectedUs ) * tempoRate / 65536;
+  timeErrorUs   = (long) ( CwwLedTimebase::now () * 1000UL - ( gridUs + (long) sinceExpected ) );
+
+  phaseRate      = - (int64_t) tempoRate * timeErrorUs / (int64_t) ( BEAT_SLEW_BEATS * pulsesPerBeat * nominalPulseUs );
+  phaseRateLimit = tempoRate >> BEAT_SLEW_LIMIT_SHIFT;
+  if ( phaseRate >  phaseRateLimit ) phaseRate =  phaseRateLimit;
+  if ( phaseRate < -phaseRateLimit ) phaseRate = -phaseRateLimit;
+
+  CwwLedTimebase::setRate ( tempoRate + phaseRate );
+
+}
+
+// ****************************************************************************
+// LED Pulse Train Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedPulseTrain::CwwLedPulseTrain (
+  unsigned long periodUs,
+  unsigned long jitterUs,
+  uint8_t       dropPercent,
+  unsigned long randomSeed
+) {
+
+  this->periodUs    = periodUs > 0 ? periodUs : 1;
+  this->jitterUs    = jitterUs < this->periodUs / 2 ? jitterUs : this->periodUs / 2;
+  this->dropPercent = dropPercent < 100 ? dropPercent : 99;
+  this->randomState = randomSeed;
+  this->idealTime   = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedPulseTrain::~CwwLedPulseTrain () {
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+unsigned long CwwLedPulseTrain::nextPulse () {
+
+  do {
+    idealTime += periodUs;
+  } while ( nextRandom () % 100 < dropPercent );
+
+  return idealTime - jitterUs + nextRandom () % ( 2 * jitterUs + 1 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedPulseTrain::setPeriod ( unsigned long periodUs ) {
+
+  this->periodUs = periodUs > 0 ? periodUs : 1;
+  if ( jitterUs > this->periodUs / 2 ) jitterUs = this->periodUs / 2;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedPulseTrain::valueOfIdealTime () {
+
+  return idealTime;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+unsigned long CwwLedPulseTrain::nextRandom () {
+
+  // Linear congruential generator; upper bits only...
+  randomState = randomState * 1664525UL + 1013904223UL;
+
+  return ( randomState >> 8 ) & 0xFFFFFF;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,146 @@
+// ****************************************************************************
+//
+// LED Beat Clock Class
+// --------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedBeatClock class locks all LED timing to an external beat,
+// e.g. MIDI clock (24 pulses per beat) or a tap tempo button (one pulse
+// per beat). Timing parameters of controllers are set up for a nominal
+// beat period (e.g. a blink period of 500 ms for one blink per beat at
+// 120 BPM); the beat clock then sets the rate of the timebase (see
+// CwwLedTimebase::setRate) so that the nominal beat period lasts exactly
+// one actual beat, whatever the tempo of the music. Controllers need no
+// setBlinkPeriod() or setOscillatePeriod() calls when the tempo changes.
+//
+// pulse() timestamps pulses with CwwLedTimebase::sourceMicros() (i.e.
+// micros(), unless set otherwise); it may be called from a pin change
+// interrupt (or from the MIDI input handler). updateNow() processes the
+// latest pulse with a software phase locked loop (a second order,
+// alpha-beta tracking filter):
+//
+// - the expected time of each pulse is predicted from the estimated pulse
+//   period; the difference to the actual time is the phase error,
+// - the phase is corrected by a share of the phase error (the alpha gain,
+//   2^-trackingShift), and the period by a smaller share (the beta gain,
+//   2^-(2 * trackingShift + 1)), so jitter is smoothed out while tempo
+//   changes are followed without lasting phase error, and
+// - skipped pulses are tolerated (counted as whole periods), and extra
+//   pulses shorter than half a period are ignored (e.g. switch bounce).
+//
+// The timebase rate is the nominal period over the estimated period,
+// slewed so that the timebase also keeps in phase with the beat grid: any
+// difference to the nominal time of the latest pulse is corrected over
+// four beats, without ever stepping the time. If pulses stop for more
+// than two beats, the last tempo is held and the clock unlocks, to lock
+// again when pulses resume; release() returns the timebase to rate 1
+// until then.
+//
+// The CwwLedPulseTrain class is a stand-in for an external clock, e.g. on
+// a host with a virtual timebase: it generates pulse timestamps of a given
+// period with random jitter and optional dropped pulses, to measure how
+// well the beat clock locks (see valueOfPhaseError).
+//
+// ****************************************************************************
+
+#ifndef CwwLedBeatClock_h
+#define CwwLedBeatClock_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+
+// ============================================================================
+
+class CwwLedBeatClock {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedBeatClock ( unsigned long nominalBeatMs = 500,  // Beat period controllers are set up for (e.g. 500 ms for 120 BPM)
+                               uint8_t       pulsesPerBeat = 1     // e.g. 24 for MIDI clock
+                             );
+    virtual ~CwwLedBeatClock ();
+
+    void pulse ();                           // timestamp with CwwLedTimebase::sourceMicros(); may be called from an interrupt
+    void pulse ( unsigned long timestampUs );
+
+    boolean updateNow ();  // process latest pulse, set timebase rate; true if a pulse was processed
+    void    release   ();  // timebase back to rate 1 until next pulse
+
+    boolean setTracking     ( uint8_t trackingShift );  // 1 (fast, follows jitter) to 6 (smooth, slow to lock); default 3
+    uint8_t valueOfTracking ();
+
+    boolean       isLocked          ();  // phase error within 1/8 of a pulse period for the last four pulses
+    unsigned long valueOfBeatPeriod ();  // estimated beat period in us; 0 until two pulses were seen
+    long          valueOfPhaseError ();  // phase error of last pulse in us; positive if late
+
+  private:
+
+    // Private Variables:
+
+    unsigned long nominalPulseUs;
+    uint8_t       pulsesPerBeat;
+    uint8_t       trackingShift;
+
+    volatile unsigned long pulseTimestamp;  // latest pulse, as set by pulse()
+    volatile boolean       pulseIsPending;
+
+    uint8_t       pulseCount;       // pulses processed since (re)acquiring; saturates
+    uint8_t       lockCount;        // consecutive pulses within lock window; saturates
+    uint8_t       missCount;        // consecutive pulses outside a quarter period
+    uint64_t      periodUs;         // estimated pulse period; Q8 (wider than 32 bits from pulses of 2^24 us on)
+    unsigned long expectedUs;       // filtered time of latest pulse
+    long          phaseErrorUs;
+    unsigned long gridUs;           // nominal timebase time of latest pulse, in us (wraps)
+
+    // Private Functions:
+
+    void acquire   ( unsigned long timestampUs );
+    void trackRate ();
+
+};
+
+// ============================================================================
+
+class CwwLedPulseTrain {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedPulseTrain ( unsigned long periodUs,         // Pulse period in us
+                                unsigned long jitterUs    = 0,  // Maximum deviation of each pulse, either way
+                                uint8_t       dropPercent = 0,  // Share of pulses dropped
+                                unsigned long randomSeed  = 1   // Seed of jitter and drops
+                              );
+    virtual ~CwwLedPulseTrain ();
+
+    unsigned long nextPulse        ();  // timestamp in us of next pulse; first ideal pulse at one period
+    void          setPeriod        ( unsigned long periodUs );  // tempo change from the next pulse on
+    unsigned long valueOfIdealTime ();  // timestamp in us the last pulse would have had without jitter
+
+  private:
+
+    // Private Variables:
+
+    unsigned long periodUs;
+    unsigned long jitterUs;
+    uint8_t       dropPercent;
+    unsigned long randomState;
+    unsigned long idealTime;
+
+    // Private Functions:
+
+    unsigned long nextRandom ();
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
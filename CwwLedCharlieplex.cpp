@@ -0,0 +1,266 @@
+// ****************************************************************************
+//
+// Charlieplexed LED Output Class
+// ------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedCharlieplex, an output backend for
+// charlieplexed LEDs using time-sliced drive with duty compensation.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedCharlieplex.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define CHARLIE_MIN_PINS    2
+#define CHARLIE_MAX_PINS    8  // limited by 8-bit pin masks
+#define CHARLIE_FULL_SLOT 255  // ticks of a slot at full level
+
+// ****************************************************************************
+// Charlieplexed LED Output Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedCharlieplex::CwwLedCharlieplex (
+  const uint8_t * pins,
+  uint8_t         pinCount,
+  uint8_t         maxLitCount
+) {
+
+  if      ( pinCount < CHARLIE_MIN_PINS ) pinCount = CHARLIE_MIN_PINS;
+  else if ( pinCount > CHARLIE_MAX_PINS ) pinCount = CHARLIE_MAX_PINS;
+
+  this->pins     = pins;
+  this->pinCount = pinCount;
+  this->ledCount = pinCount * ( pinCount - 1 );
+
+  if ( maxLitCount == 0 || maxLitCount > ledCount ) maxLitCount = ledCount;
+  this->maxLitCount = maxLitCount;
+
+  ledLevels = new uint8_t [ ledCount ];
+  memset ( ledLevels, 0, ledCount );
+  levelsChanged = false;
+
+  scanTables[0] = new structScanSlot [ ledCount + 1 ];
+  scanTables[1] = new structScanSlot [ ledCount + 1 ];
+  buildScanTable ( 0 );
+  buildScanTable ( 1 );
+  frontTableSet = 0;
+  scanTableSet  = 0;
+
+  scanSlot         = 0;
+  drivenOutputMask = 0;
+  drivenHighMask   = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedCharlieplex::~CwwLedCharlieplex () {
+
+  delete [] ledLevels;
+  delete [] scanTables[0];
+  delete [] scanTables[1];
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+void CwwLedCharlieplex::begin () {
+
+  uint8_t index;
+
+  for ( index = 0; index < pinCount; index++ ) {
+    digitalWrite ( pins[index], LOW   );
+    pinMode      ( pins[index], INPUT );
+  }
+
+  drivenOutputMask = 0;
+  drivenHighMask   = 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedCharlieplex::channelOf ( uint8_t anodePinIndex, uint8_t cathodePinIndex ) {
+
+  // Channels are numbered by anode pin, then by cathode pin, skipping the
+  // impossible pairing of a pin with itself...
+  return anodePinIndex * ( pinCount - 1 )
+       + ( cathodePinIndex < anodePinIndex ? cathodePinIndex : cathodePinIndex - 1 );
+
+}
+
+// ============================================================================
+
+void CwwLedCharlieplex::writeLevel ( uint8_t ledChannel, uint8_t ledLevel, boolean usePwm ) {
+
+  if ( ledChannel >= ledCount ) return;
+
+  if ( ! usePwm && ledLevel > 0 ) ledLevel = 255;
+
+  if ( ledLevels[ledChannel] != ledLevel ) {
+    ledLevels[ledChannel] = ledLevel;
+    levelsChanged = true;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedCharlieplex::commitFrame () {
+
+  uint8_t backTableSet;
+
+  if ( ! levelsChanged ) return;
+
+  // If the scan has not yet picked up the previously committed table, the
+  // other set is still being displayed and must not be overwritten. The
+  // changes stay pending until the next commit...
+  if ( scanTableSet != frontTableSet ) return;
+
+  backTableSet = frontTableSet ^ 1;
+  buildScanTable ( backTableSet );
+  frontTableSet = backTableSet;
+  levelsChanged = false;
+
+}
+
+// ============================================================================
+
+uint16_t CwwLedCharlieplex::scanIsr () {
+
+  structScanSlot * slotPtr;
+
+  // scanSlot is the next slot to light; it is 0 only before the first
+  // call, which thus starts a frame with slot 0 of the latest table...
+  if ( scanSlot == 0 || scanSlot >= slotCounts[scanTableSet] ) {
+    scanSlot = 0;
+    scanTableSet = frontTableSet;  // latch new table only at frame start
+  }
+
+  slotPtr = &scanTables[scanTableSet][scanSlot++];
+  drivePins ( slotPtr->outputMask, slotPtr->highMask );
+
+  return slotPtr->slotTicks;
+
+}
+
+// ============================================================================
+
+uint8_t CwwLedCharlieplex::valueOfPinCount () {
+
+  return pinCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedCharlieplex::valueOfLedCount () {
+
+  return ledCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedCharlieplex::valueOfMaxLitCount () {
+
+  return maxLitCount;
+
+}
+
+// ============================================================================
+// Protected Functions
+// ============================================================================
+
+void CwwLedCharlieplex::drivePins ( uint8_t outputMask, uint8_t highMask ) {
+
+  uint8_t index;
+  uint8_t pinBit;
+
+  // Release pins no longer driven first, so that no LED other than the
+  // one of the new slot can light up during the transition. A pin that
+  // was high is written low while still an output, as an input with its
+  // latch high would have its pull-up on (e.g. on AVR) and could ghost
+  // an LED...
+  for ( index = 0, pinBit = 1; index < pinCount; index++, pinBit <<= 1 ) {
+    if ( ( drivenOutputMask & pinBit ) && ! ( outputMask & pinBit ) ) {
+      if ( drivenHighMask & pinBit ) digitalWrite ( pins[index], LOW );
+      pinMode ( pins[index], INPUT );
+    }
+  }
+
+  for ( index = 0, pinBit = 1; index < pinCount; index++, pinBit <<= 1 ) {
+    if ( outputMask & pinBit ) {
+      if ( ! ( drivenOutputMask & pinBit ) ) pinMode ( pins[index], OUTPUT );  // latch is low
+      digitalWrite ( pins[index], highMask & pinBit ? HIGH : LOW );
+    }
+  }
+
+  drivenOutputMask = outputMask;
+  drivenHighMask   = highMask;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedCharlieplex::buildScanTable ( uint8_t tableSet ) {
+
+  structScanSlot * slotPtr;
+  uint8_t          ledChannel;
+  uint8_t          anodeIndex;
+  uint8_t          cathodeIndex;
+  uint8_t          litCount;
+  uint16_t         litTicks;
+  uint16_t         frameTicks;
+
+  slotPtr  = scanTables[tableSet];
+  litCount = 0;
+  litTicks = 0;
+
+  for ( ledChannel = 0; ledChannel < ledCount; ledChannel++ ) {
+
+    if ( ledLevels[ledChannel] == 0 ) continue;  // off LEDs get no slot
+
+    anodeIndex   = ledChannel / ( pinCount - 1 );
+    cathodeIndex = ledChannel % ( pinCount - 1 );
+    if ( cathodeIndex >= anodeIndex ) cathodeIndex++;
+
+    slotPtr->outputMask = ( 1 << anodeIndex ) | ( 1 << cathodeIndex );
+    slotPtr->highMask   =   1 << anodeIndex;
+    slotPtr->slotTicks  = ledLevels[ledChannel];
+    litTicks += slotPtr->slotTicks;
+    litCount++;
+    slotPtr++;
+
+  }
+
+  // Pad frame with a dark slot for duty compensation...
+  frameTicks = (uint16_t) CHARLIE_FULL_SLOT * ( litCount > maxLitCount ? litCount : maxLitCount );
+
+  if ( frameTicks > litTicks ) {
+    slotPtr->outputMask = 0;
+    slotPtr->highMask   = 0;
+    slotPtr->slotTicks  = frameTicks - litTicks;
+    slotCounts[tableSet] = litCount + 1;
+  }
+  else {
+    slotCounts[tableSet] = litCount;
+  }
+
+}
+
+// ****************************************************************************
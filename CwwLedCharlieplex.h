@@ -0,0 +1,112 @@
+// ****************************************************************************
+//
+// Charlieplexed LED Output Class
+// ------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedCharlieplex class is an output backend (see CwwLedOutput) for
+// charlieplexed LEDs: n pins (2 to 8) drive up to n * ( n - 1 ) LEDs, one
+// LED per ordered pair of pins (anode pin, cathode pin). Each LED is
+// addressed by a channel number (see channelOf) and may be driven by its
+// own CwwLedController instance.
+//
+// Since only one LED can be lit at a time, the LEDs are time-sliced: each
+// lit LED gets one slot per scan frame, lit for a time proportional to
+// its level. LEDs that are off get no slot at all. To keep the brightness
+// of an LED independent of the number of other LEDs that happen to be
+// lit (duty compensation), the scan frame is padded with a dark slot up
+// to the length of maxLitCount full slots.
+//
+// The scan table (pin directions, pin states and slot durations) is
+// prepared from the LED levels once per frame in commitFrame() (e.g. by
+// CwwLedBank::updateNow()). The scan is driven by user code from a timer
+// interrupt by calling scanIsr(), which returns the number of timer ticks
+// until it needs to be called again; i.e. there are only litCount + 1
+// interrupts per scan frame of 255 * max ( litCount, maxLitCount ) ticks.
+//
+// The default pin handling uses pinMode() and digitalWrite(). Hardware
+// with direct port access may override drivePins() in a derived class.
+//
+// ****************************************************************************
+
+#ifndef CwwLedCharlieplex_h
+#define CwwLedCharlieplex_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+
+// ============================================================================
+
+class CwwLedCharlieplex : public CwwLedOutput {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedCharlieplex ( const uint8_t * pins,             // Charlieplex pins; array of pinCount pin numbers
+                                 uint8_t         pinCount,         // Number of pins (2 to 8)
+                                 uint8_t         maxLitCount = 0   // Number of LEDs lit at full duty; 0 for all LEDs
+                               );
+    virtual ~CwwLedCharlieplex ();
+
+    void    begin     ();                                                 // Configure pins; call once before scanning
+    uint8_t channelOf ( uint8_t anodePinIndex, uint8_t cathodePinIndex ); // Indices into pins array
+
+    virtual void writeLevel  ( uint8_t ledChannel, uint8_t ledLevel, boolean usePwm );
+    virtual void commitFrame ();  // prepare scan table from LED levels, if changed
+
+    uint16_t scanIsr ();  // light next LED; returns ticks until next call
+
+    uint8_t valueOfPinCount    ();
+    uint8_t valueOfLedCount    ();
+    uint8_t valueOfMaxLitCount ();
+
+  protected:
+
+    // Protected Types:
+
+    struct structScanSlot {
+      uint8_t  outputMask;  // pins to drive (bit per pin index); others are high impedance
+      uint8_t  highMask;    // driven pins to set high
+      uint16_t slotTicks;   // duration of slot in timer ticks
+    };
+
+    // Protected Functions:
+
+    virtual void drivePins ( uint8_t outputMask, uint8_t highMask );
+
+  private:
+
+    // Private Variables:
+
+    const uint8_t * pins;
+    uint8_t         pinCount;
+    uint8_t         ledCount;
+    uint8_t         maxLitCount;
+
+    uint8_t * ledLevels;
+    boolean   levelsChanged;
+
+    structScanSlot * scanTables[2];  // two sets of up to ledCount + 1 slots
+    uint8_t          slotCounts[2];
+    volatile uint8_t frontTableSet;
+    volatile uint8_t scanTableSet;
+
+    uint8_t scanSlot;  // next slot to light
+    uint8_t drivenOutputMask;
+    uint8_t drivenHighMask;
+
+    // Private Functions:
+
+    void buildScanTable ( uint8_t tableSet );
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
@@ -0,0 +1,480 @@
+// ****************************************************************************
+//
+// LED Chase Class
+// ---------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedChase, which runs scanner, comet and
+// marquee chase effects over a range of channels of a bank.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedChase.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define CHASE_FP_BITS     8            // fraction bits of positions along the path
+#define CHASE_FP_ONE      256          // one channel along the path
+#define CHASE_NO_VISIT    0x40000000L  // second visit of channels that are not bounced over
+
+// ****************************************************************************
+// LED Chase Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedChase::CwwLedChase (
+  CwwLedBank & bank,
+  uint16_t     firstChannel,
+  uint16_t     channelCount
+) {
+
+  uint16_t channelCapacity;
+
+  channelCapacity = bank.valueOfChannelCapacity ();
+  if ( firstChannel > channelCapacity ) firstChannel = channelCapacity;
+  if ( channelCount == 0 || channelCount > channelCapacity - firstChannel ) channelCount = channelCapacity - firstChannel;
+
+  this->bankPtr      = &bank;
+  this->firstChannel = firstChannel;
+  this->channelCount = channelCount;
+
+  this->shapeLevels      = new uint8_t [ channelCount ];
+  this->writtenLevels    = new uint8_t [ channelCount ];
+  this->levelsAreWritten = false;
+
+  this->width           = 1;
+  this->tailLength      = 0;
+  this->stepMs          = 50;
+  this->direction       = LED_CHASE_FORWARD;
+  this->bounce          = false;
+  this->spacing         = 0;
+  this->headLevel       = 255;
+  this->backgroundLevel = 0;
+
+  this->chaseIsRunning  = false;
+  this->pathPosition    = 0;
+  this->pathRemainder   = 0;
+  this->phaseTime       = 0;
+  this->refreshTime     = 0;
+  this->refreshInterval = 20;
+
+  calcPath ();
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedChase::~CwwLedChase () {
+
+  delete [] shapeLevels;
+  delete [] writtenLevels;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+void CwwLedChase::start () {
+
+  chaseIsRunning   = true;
+  pathPosition     = 0;
+  pathRemainder    = 0;
+  phaseTime        = CwwLedTimebase::now ();
+  refreshTime      = phaseTime - refreshInterval;
+  levelsAreWritten = false;
+
+  updateNow ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedChase::stop () {
+
+  chaseIsRunning = false;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedChase::isRunning () {
+
+  return chaseIsRunning;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedChase::setWidth ( uint16_t width ) {
+
+  boolean setIsClean;
+
+  setIsClean = width > 0;
+
+  takePhase ();
+  this->width = setIsClean ? width : 1;
+  calcPath ();
+
+  return setIsClean;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedChase::setTail ( uint16_t tailLength ) {
+
+  takePhase ();
+  this->tailLength = tailLength;
+  calcPath ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedChase::setStepTime ( uint16_t stepMs ) {
+
+  boolean setIsClean;
+
+  setIsClean = stepMs > 0;
+
+  // The head goes on from where it is at the new speed...
+  takePhase ();
+  this->stepMs  = setIsClean ? stepMs : 1;
+  pathRemainder = 0;
+
+  return setIsClean;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedChase::setDirection ( cwwEnumLedChaseDirection direction ) {
+
+  // Channels are tracked by their place along the path...
+  this->direction  = direction;
+  levelsAreWritten = false;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedChase::setBounce ( boolean bounce ) {
+
+  takePhase ();
+  this->bounce = bounce;
+  calcPath ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedChase::setSpacing ( uint16_t spacing ) {
+
+  takePhase ();
+  this->spacing = spacing;
+  calcPath ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedChase::setLevels (
+  uint8_t headLevel,
+  uint8_t backgroundLevel
+) {
+
+  this->headLevel       = headLevel;
+  this->backgroundLevel = backgroundLevel;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint16_t CwwLedChase::valueOfWidth () {
+
+  return width;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedChase::valueOfTail () {
+
+  return tailLength;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedChase::valueOfStepTime () {
+
+  return stepMs;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwEnumLedChaseDirection CwwLedChase::valueOfDirection () {
+
+  return (cwwEnumLedChaseDirection) direction;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedChase::isBouncing () {
+
+  return bounce;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedChase::valueOfSpacing () {
+
+  return spacing;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedChase::valueOfRangeCount () {
+
+  return channelCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+long CwwLedChase::valueOfPosition () {
+
+  takePhase ();
+
+  return pathPosition;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedChase::updateIsDue () {
+
+  return chaseIsRunning && CwwLedTimebase::now () - refreshTime >= refreshInterval;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedChase::updateNow () {
+
+  uint16_t           shapeCount;
+  uint16_t           copiedCount;
+  uint16_t           channelIndex;
+  CwwLedController * controllerPtr;
+
+  if ( ! updateIsDue () ) return false;
+
+  takePhase ();
+  refreshTime = phaseTime;
+
+  // Levels of all channels from the head position. A channel is passed by
+  // the head once per cycle, or twice when bouncing (once each way)...
+  if ( bounce ) {
+    calcShapes ( channelCount, pathPosition + ( (long) pathWidth << CHASE_FP_BITS ), pathPosition - pathLength + CHASE_FP_ONE, pathLength );
+  }
+  else if ( spacing > 0 ) {
+    // ...a marquee repeats every spacing channels, so one period is
+    // computed and copied along the range, doubling the copy each time...
+    shapeCount = spacing < channelCount ? spacing : channelCount;
+    calcShapes ( shapeCount, pathPosition, CHASE_NO_VISIT, pathLength );
+    for ( copiedCount = shapeCount; copiedCount < channelCount; copiedCount += shapeCount ) {
+      shapeCount = copiedCount < channelCount - copiedCount ? copiedCount : channelCount - copiedCount;
+      memcpy ( &shapeLevels[copiedCount], shapeLevels, shapeCount );
+    }
+  }
+  else {
+    calcShapes ( channelCount, pathPosition, CHASE_NO_VISIT, 0 );
+  }
+
+  // Only changed levels are written, all in one frame...
+  bankPtr->beginFrame ();
+
+  for ( channelIndex = 0; channelIndex < channelCount; channelIndex++ ) {
+    if ( levelsAreWritten && shapeLevels[channelIndex] == writtenLevels[channelIndex] ) continue;
+    controllerPtr = bankPtr->channel ( firstChannel + ( direction == LED_CHASE_REVERSE ? channelCount - 1 - channelIndex : channelIndex ) );
+    if ( controllerPtr != NULL ) controllerPtr->setLevel ( shapeLevels[channelIndex] );
+    writtenLevels[channelIndex] = shapeLevels[channelIndex];
+  }
+  levelsAreWritten = true;
+
+  bankPtr->commitFrame ();
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedChase::millisUntilUpdate () {
+
+  unsigned long elapsedTime;
+
+  if ( ! chaseIsRunning ) return UPDATE_NOT_SCHEDULED;
+
+  elapsedTime = CwwLedTimebase::now () - refreshTime;
+
+  return elapsedTime >= refreshInterval ? 0 : refreshInterval - elapsedTime;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedChase::setRefreshInterval ( uint16_t newInterval ) {
+
+  boolean setIsClean;
+
+  setIsClean = newInterval > 0;
+  refreshInterval = setIsClean ? newInterval : 1;
+
+  return setIsClean;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedChase::valueOfRefreshInterval () {
+
+  return refreshInterval;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedChase::calcPath () {
+
+  // The tail includes one channel for the trailing edge of the head, so
+  // that a head without tail moves as smoothly as it comes in. Its slope is
+  // found once here, so that the loop over the channels multiplies rather
+  // than divides...
+  tailExtent = (long) ( tailLength + 1 ) << CHASE_FP_BITS;
+  tailSlope  = ( (uint32_t) CHASE_FP_ONE << 16 ) / tailExtent;
+
+  // A bouncing head runs from one end of the range to the other and back;
+  // a marquee runs one period of its pattern; a single head runs in at
+  // the start of the range and until its tail has left at the end...
+  pathWidth = width;
+  if ( bounce ) {
+    if ( pathWidth > channelCount / 2 ) pathWidth = channelCount / 2 > 0 ? channelCount / 2 : 1;
+    pathLength = channelCount > pathWidth ? (long) ( channelCount - pathWidth ) << ( CHASE_FP_BITS + 1 ) : 0;
+  }
+  else if ( spacing > 0 ) {
+    pathLength = (long) spacing << CHASE_FP_BITS;
+  }
+  else {
+    pathLength = ( ( (long) channelCount - 1 + width ) << CHASE_FP_BITS ) + tailExtent;
+  }
+
+  if ( pathLength > 0 ) pathPosition %= pathLength;
+  else                  pathPosition  = 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedChase::takePhase () {
+
+  unsigned long timeNow;
+  uint64_t      pathTime;
+
+  if ( ! chaseIsRunning ) return;
+
+  timeNow = CwwLedTimebase::now ();
+
+  // Moved along the path since the position was last taken, carrying the
+  // time short of a full step (1/256 channel) over to the next time...
+  pathTime      = ( (uint64_t) ( timeNow - phaseTime ) << CHASE_FP_BITS ) + pathRemainder;
+  pathRemainder = pathTime % stepMs;
+  phaseTime     = timeNow;
+
+  if ( pathLength > 0 ) pathPosition = ( pathPosition + pathTime / stepMs ) % pathLength;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedChase::calcShapes (
+  uint16_t shapeCount,
+  int32_t  headBase,
+  int32_t  bounceBase,
+  int32_t  wrapLength
+) {
+
+  uint16_t channelIndex;
+  int32_t  channelBase;
+  int32_t  sinceHead;
+  int32_t  sinceBounce;
+  int32_t  leadShare;
+  int32_t  tailDistance;
+  int32_t  tailShare;
+  int32_t  headShare;
+  int32_t  bounceShare;
+  int32_t  headExtent;
+  int32_t  levelSpan;
+  int32_t  tailLimit;
+  uint32_t tailScale;
+  uint8_t  levelBase;
+  uint8_t * levels;
+
+  // Loop invariants in locals, so that compilers can keep them in registers
+  // and vectorize the loop (stores to a byte array may alias any member)...
+  levels     = shapeLevels;
+  headExtent = (int32_t) pathWidth << CHASE_FP_BITS;
+  tailLimit  = tailExtent;
+  tailScale  = tailSlope;
+  levelBase  = backgroundLevel;
+  levelSpan  = (int32_t) headLevel - backgroundLevel;
+
+  // For each channel: distance along the path since the head (its leading
+  // edge) reached the channel, wrapped into one cycle. The channel fades in
+  // under the leading edge, stays at head level for the width of the head
+  // and falls along the tail. When bouncing, the brighter of both visits
+  // wins, so the afterglow of one pass is kept while the head turns. The
+  // second visit of other chases is too far back to show. Selects rather
+  // than branches, and no early exits...
+  for ( channelIndex = 0; channelIndex < shapeCount; channelIndex++ ) {
+    channelBase  = (int32_t) channelIndex << CHASE_FP_BITS;
+
+    sinceHead    = headBase - channelBase;
+    sinceHead   += sinceHead < 0 ? wrapLength : 0;
+    sinceHead   -= sinceHead >= wrapLength ? wrapLength : 0;
+    leadShare    = sinceHead < 0 ? 0 : sinceHead > CHASE_FP_ONE ? CHASE_FP_ONE : sinceHead;
+    tailDistance = sinceHead - headExtent;
+    tailDistance = tailDistance < 0 ? 0 : tailDistance > tailLimit ? tailLimit : tailDistance;
+    tailShare    = CHASE_FP_ONE - (int32_t) ( ( (uint32_t) tailDistance * tailScale ) >> 16 );
+    headShare    = tailShare < leadShare ? tailShare : leadShare;
+
+    sinceBounce  = bounceBase + channelBase;
+    sinceBounce += sinceBounce < 0 ? wrapLength : 0;
+    sinceBounce -= sinceBounce >= wrapLength ? wrapLength : 0;
+    leadShare    = sinceBounce < 0 ? 0 : sinceBounce > CHASE_FP_ONE ? CHASE_FP_ONE : sinceBounce;
+    tailDistance = sinceBounce - headExtent;
+    tailDistance = tailDistance < 0 ? 0 : tailDistance > tailLimit ? tailLimit : tailDistance;
+    tailShare    = CHASE_FP_ONE - (int32_t) ( ( (uint32_t) tailDistance * tailScale ) >> 16 );
+    bounceShare  = tailShare < leadShare ? tailShare : leadShare;
+
+    headShare    = bounceShare > headShare ? bounceShare : headShare;
+    levels[channelIndex] = levelBase + ( ( levelSpan * headShare ) >> CHASE_FP_BITS );
+  }
+
+}
+
+// ****************************************************************************
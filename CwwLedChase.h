@@ -0,0 +1,149 @@
+// ****************************************************************************
+//
+// LED Chase Class
+// ---------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedChase class runs a moving light over a range of channels of a
+// CwwLedBank: a scanner (a head bouncing between both ends), a comet (a
+// head with a fading tail running across) or a marquee chase (heads
+// repeating every few channels, running around).
+//
+// The effect is set by a few parameters:
+//
+// - width: number of channels at the head level,
+// - tail: number of channels behind the head over which the level falls
+//   to the background level (0 for a hard edge),
+// - step time: time in ms for the head to move on by one channel,
+// - direction: towards higher (forward) or lower (reverse) channels,
+// - bounce: the head turns at each end of the range (a scanner); the tail
+//   is then the afterglow of the channels the head last passed, and
+// - spacing: the pattern repeats every so many channels (a marquee); 0
+//   for a single head running across the range and out at its end.
+//
+//   CwwLedChase scanner ( bank );
+//   scanner.setWidth    ( 1 );
+//   scanner.setTail     ( 4 );
+//   scanner.setStepTime ( 60 );
+//   scanner.setBounce   ( true );
+//   scanner.start ();
+//
+// The head moves in steps of 1/256 channel, so slow chases move smoothly
+// (the leading edge of the head fades in). The level of each channel is
+// computed from the head position alone, in one integer loop without
+// branches over all channels per refresh, which compilers can vectorize.
+// A refresh thus costs the same whatever the parameters; only channels
+// whose level changed are written, as one bank frame. A marquee computes
+// one period of its pattern and copies it along the range.
+//
+// The chase sets the levels of its channels (see CwwLedController::setLevel)
+// and should be the only thing doing so while running.
+//
+// ****************************************************************************
+
+#ifndef CwwLedChase_h
+#define CwwLedChase_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+
+// ============================================================================
+
+enum cwwEnumLedChaseDirection {
+  LED_CHASE_FORWARD,  // head moves towards higher channels
+  LED_CHASE_REVERSE   // head moves towards lower channels
+};
+
+// ============================================================================
+
+class CwwLedChase {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedChase ( CwwLedBank & bank,              // Bank to drive
+                           uint16_t     firstChannel = 0,  // First channel of range
+                           uint16_t     channelCount = 0   // Number of channels in range; 0 for all from first channel on
+                         );
+    virtual ~CwwLedChase ();
+
+    void    start     ();  // head starts at the beginning of the range
+    void    stop      ();  // channels keep their levels
+    boolean isRunning ();
+
+    boolean setWidth     ( uint16_t width );       // channels at head level; at least 1; default 1
+    void    setTail      ( uint16_t tailLength );  // channels of fading tail; default 0
+    boolean setStepTime  ( uint16_t stepMs );      // ms per channel moved; at least 1; default 50
+    void    setDirection ( cwwEnumLedChaseDirection direction );  // default forward
+    void    setBounce    ( boolean bounce );       // default false; a bouncing head ignores spacing
+    void    setSpacing   ( uint16_t spacing );     // channels per repeat of pattern; 0 for a single head; default 0
+    void    setLevels    ( uint8_t headLevel, uint8_t backgroundLevel = 0 );  // defaults: 255, 0
+
+    uint16_t                 valueOfWidth      ();
+    uint16_t                 valueOfTail       ();
+    uint16_t                 valueOfStepTime   ();
+    cwwEnumLedChaseDirection valueOfDirection  ();
+    boolean                  isBouncing        ();
+    uint16_t                 valueOfSpacing    ();
+    uint16_t                 valueOfRangeCount ();  // channels in range
+    long                     valueOfPosition   ();  // head position along its path, in 1/256 channels
+
+    boolean       updateIsDue       ();  // true if running and a refresh is due
+    boolean       updateNow         ();  // refresh levels as one bank frame; true if refreshed
+    unsigned long millisUntilUpdate ();  // 0 if due; UPDATE_NOT_SCHEDULED if not running
+
+    boolean  setRefreshInterval     ( uint16_t newInterval );  // interval in ms between refreshes; default 20
+    uint16_t valueOfRefreshInterval ();
+
+  private:
+
+    // Private Variables:
+
+    CwwLedBank * bankPtr;
+    uint16_t     firstChannel;
+    uint16_t     channelCount;
+
+    uint8_t * shapeLevels;    // per channel of range: level computed last...
+    uint8_t * writtenLevels;  // ...and level written last
+    boolean   levelsAreWritten;
+
+    uint16_t width;
+    uint16_t tailLength;
+    uint16_t stepMs;
+    uint8_t  direction;
+    boolean  bounce;
+    uint16_t spacing;
+    uint8_t  headLevel;
+    uint8_t  backgroundLevel;
+
+    uint16_t pathWidth;       // width in effect; a bouncing head is at most half the range
+    long     pathLength;      // path of head per cycle, in 1/256 channels
+    long     tailExtent;      // tail, including the trailing edge of the head, in 1/256 channels
+    uint32_t tailSlope;       // level share lost per 1/256 channel of tail; 16.16 fixed point
+
+    boolean       chaseIsRunning;
+    long          pathPosition;   // head position along its path, in 1/256 channels...
+    uint16_t      pathRemainder;  // ...plus time not yet moved, in 1/256 ms
+    unsigned long phaseTime;      // timebase time the position was taken at
+    unsigned long refreshTime;
+    uint16_t      refreshInterval;
+
+    // Private Functions:
+
+    void calcPath   ();
+    void takePhase  ();
+    void calcShapes ( uint16_t shapeCount, int32_t headBase, int32_t bounceBase, int32_t wrapLength );
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
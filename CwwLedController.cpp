@@ -20,6 +20,7 @@
 #include <Arduino.h>
 
 #include <CwwLedController.h>
+#include <CwwLedTimebase.h>
 
 // ============================================================================
 // Private Macros:
@@ -31,6 +32,12 @@
 #define LEVEL_VALUE_ABS_MAX  ( 255 << LEVEL_FP_BITS   )
 #define LEVEL_VALUE_ABS_MID  ( 255 << LEVEL_FP_BITS-1 )
 
+#define SEQUENCE_MAX_STEPS_PER_UPDATE  32  // bounds zero delay parameter step loops
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(address)  ( * (const uint8_t *) ( address ) )  // cores without program memory space
+#endif
+
 // ****************************************************************************
 // Core LED Controller Class
 // ****************************************************************************
@@ -48,23 +55,30 @@ CwwLedController::CwwLedController (
   uint16_t      refreshInterval 
 ) {
 
+  this->ledOutputPtr = NULL;
   this->ledPin       = ledPin;
-  this->usePwm       = usePwm;
-  this->invertSignal = invertSignal;
 
-  this->levelMin = LEVEL_VALUE_ABS_MIN;
-  this->levelMax = LEVEL_VALUE_ABS_MAX;
+  pinMode ( ledPin, OUTPUT );
+  initialize ( usePwm, invertSignal, blinkPeriod, oscillatePeriod, refreshInterval );
 
-  this->refreshInterval = refreshInterval == 0 ? 1 : refreshInterval;
-  setBlinkPeriod     ( blinkPeriod     );
-  setOscillatePeriod ( oscillatePeriod );
-  this->remainingPhases = 0;
+}
 
-  this->sequencePlayerPtr = NULL;
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-  pinMode ( ledPin, OUTPUT );
-  setMode ( LED_OFF, 0, 0, true );
-  drivePin ();
+CwwLedController::CwwLedController (
+  CwwLedOutput & ledOutput,
+  uint8_t        ledChannel,
+  boolean        usePwm,
+  boolean        invertSignal,
+  unsigned long  blinkPeriod,
+  unsigned long  oscillatePeriod,
+  uint16_t       refreshInterval 
+) {
+
+  this->ledOutputPtr = &ledOutput;
+  this->ledPin       = ledChannel;
+
+  initialize ( usePwm, invertSignal, blinkPeriod, oscillatePeriod, refreshInterval );
 
 }
 
@@ -220,6 +234,22 @@ void CwwLedController::hold () {
 
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedController::envelopeOn () {
+
+  setMode ( LED_ENVELOPE_ON );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedController::envelopeOff () {
+
+  setMode ( LED_ENVELOPE_OFF );
+
+}
+
 // ----------------------------------------------------------------------------
 
 boolean CwwLedController::isOn () {
@@ -272,7 +302,7 @@ boolean CwwLedController::isSteady () {
 
 void CwwLedController::installSequence ( CwwLedSequence * sequencePtr ) {
 
-  if ( sequencePlayerPtr == NULL ) sequencePlayerPtr = new CwwLedSequencePlayer;
+  if ( sequencePlayerPtr == NULL ) sequencePlayerPtr = new CwwLedSequencePlayer ( this );
 
   sequencePlayerPtr->attachSequence ( sequencePtr );
 
@@ -311,11 +341,28 @@ void CwwLedController::stopSequence () {
 
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedController::pauseSequence () {
+
+  if ( sequencePlayerPtr != NULL ) sequencePlayerPtr->pause ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedController::resumeSequence () {
+
+  return sequencePlayerPtr != NULL && sequencePlayerPtr->resume ();
+
+}
+
 // ----------------------------------------------------------------------------
 
 uint8_t CwwLedController::valueOfSequenceRepeatCount () {
 
-  return sequencePlayerPtr != NULL && sequencePlayerPtr->valueOfRepeatCount ();
+  if ( sequencePlayerPtr == NULL ) return 0;
+  else                             return sequencePlayerPtr->valueOfRepeatCount ();
 
 }
 
@@ -327,35 +374,53 @@ boolean CwwLedController::isPlayingSequence () {
 
 }
 
-// ============================================================================
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-boolean CwwLedController::setLevel ( uint8_t ledLevelNew ) {
+boolean CwwLedController::isSequencePaused () {
 
-  uint16_t levelNew;
-  boolean  success;
+  return sequencePlayerPtr != NULL && sequencePlayerPtr->isPaused ();
 
-  levelNew   = ledLevelNew;
-  levelNew <<= LEVEL_FP_BITS;
-  success = true;
+}
 
-  if      ( levelNew == LEVEL_VALUE_ABS_MIN ) setMode ( LED_OFF  );
-  else if ( levelNew == LEVEL_VALUE_ABS_MAX ) setMode ( LED_ON   );
-  else if ( levelNew == levelMin            ) setMode ( LED_LOW  );
-  else if ( levelNew == levelMax            ) setMode ( LED_HIGH );
-  else if ( usePwm ) {
-    success = levelNew >= levelMin && levelNew <= levelMax;
-    if      ( levelNew < levelMin ) levelNew = levelMin;
-    else if ( levelNew > levelMax ) levelNew = levelMax;
-    ledLevel = levelNew;
-    ledModeSetting = LED_HOLD_LEVEL;
-    ledModeActive  = LED_HOLD_LEVEL;
-    drivePin ();
-  }
-  else {
-    success = false;
-  }
+// ----------------------------------------------------------------------------
 
-  return success;
+boolean CwwLedController::setSequenceRate ( uint16_t playbackRate ) {
+
+  return sequencePlayerPtr != NULL && sequencePlayerPtr->setRate ( playbackRate );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedController::valueOfSequenceRate () {
+
+  return sequencePlayerPtr != NULL ? sequencePlayerPtr->valueOfRate () : SEQUENCE_RATE_NORMAL;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedController::setSequenceReverse ( boolean playReversed ) {
+
+  if ( sequencePlayerPtr != NULL ) sequencePlayerPtr->setReverse ( playReversed );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedController::isSequenceReversed () {
+
+  return sequencePlayerPtr != NULL && sequencePlayerPtr->isReversed ();
+
+}
+
+// ============================================================================
+
+boolean CwwLedController::setLevel ( uint8_t ledLevelNew ) {
+
+  stopSequence ();
+
+  return applyLevel ( (uint16_t) ledLevelNew << LEVEL_FP_BITS );
 
 }
 
@@ -363,7 +428,7 @@ boolean CwwLedController::setLevel ( uint8_t ledLevelNew ) {
 
 uint8_t CwwLedController::currentLevel () {
 
-  return ledLevel;
+  return ledLevel >> LEVEL_FP_BITS;
 
 }
 
@@ -372,8 +437,12 @@ uint8_t CwwLedController::currentLevel () {
 
 void CwwLedController::setMode ( cwwEnumLedMode ledModeNew, uint16_t phaseCount, uint8_t stepAmount ) {
 
+  // A phase count restarts a finite blink or oscillation, even one that
+  // has just completed its phases (e.g. from a LED_EVENT_PHASES_DONE
+  // callback), as sequence steps do...
   stopSequence ();
-  setMode ( ledModeNew, phaseCount, stepAmount, false );
+  setMode ( ledModeNew, phaseCount, (uint16_t) stepAmount << LEVEL_FP_BITS, phaseCount > 0 );
+  dispatchEvents ();
 
 }
 
@@ -454,29 +523,11 @@ uint16_t CwwLedController::valueOfRefreshInterval () {
 
 boolean CwwLedController::updateIsDue () {
 
-  unsigned long currentTime;
-  unsigned long elapsedTime;
-
-  if ( updateInterval > 0 ) {
-
-    currentTime = millis ();
-
-    if ( currentTime < lastDriveTime ) {
-      elapsedTime = ( ULONG_MAX - lastDriveTime ) + currentTime;
-    }
-    else {
-      elapsedTime = currentTime - lastDriveTime;
-    }
-
-    return elapsedTime >= updateInterval;
-
-  }
-  else {
-
-    if ( sequencePlayerPtr == NULL ) return false;
-    else                             return sequencePlayerPtr->stepDelayIsDone ();
-  }
+  // A sequence step may fall due between refreshes (e.g. while blinking)...
+  if ( refreshIsDue () ) return true;
 
+  if ( sequencePlayerPtr == NULL ) return false;
+  else                             return sequencePlayerPtr->stepDelayIsDone ();
 
 }
 
@@ -484,17 +535,45 @@ boolean CwwLedController::updateIsDue () {
 
 boolean CwwLedController::updateNow () {
 
+  uint16_t ledLevelLast;
+  uint8_t  stepCount;
+  boolean  modeStepApplied;
+
   if ( sequencePlayerPtr != NULL && sequencePlayerPtr->stepDelayIsDone() ) {
 
-    setMode ( sequencePlayerPtr->modeOfStep(), 0, levelStep, false );
-    sequencePlayerPtr->advanceOneStep ();
+    // Apply all parameter steps that are due, up to and including the
+    // next mode step, recomputing derived values only once...
+    ledLevelLast    = ledLevel;
+    stepCount       = 0;
+    modeStepApplied = false;
+
+    do {
+      if ( sequencePlayerPtr->isParamStep() ) {
+        applyParamStep ( sequencePlayerPtr->paramOfStep(), sequencePlayerPtr->operandOfStep() );
+      }
+      else {
+        refreshDerived ();
+        applyStep ( sequencePlayerPtr->modeOfStep(), sequencePlayerPtr->operandOfStep() );
+        modeStepApplied = true;
+      }
+      sequencePlayerPtr->advanceOneStep ();
+    } while ( ! modeStepApplied
+           && ++stepCount < SEQUENCE_MAX_STEPS_PER_UPDATE
+           && sequencePlayerPtr->stepDelayIsDone() );
+
+    refreshDerived ();
+    if ( ! modeStepApplied && ledLevel != ledLevelLast ) drivePin ( false );
+    dispatchEvents ();
+
+    return true;
 
   }
   else {
 
-    if ( updateIsDue() ) {
+    if ( refreshIsDue () ) {
       computeState ( ledModeActive );
       drivePin ();
+      dispatchEvents ();
       return true;
     }
     else {
@@ -505,43 +584,108 @@ boolean CwwLedController::updateNow () {
 
 }
 
-// ============================================================================
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-boolean CwwLedController::setLevelMin ( uint8_t levelMinNew ) {
+unsigned long CwwLedController::millisUntilUpdate () {
 
-  uint16_t levelRange;
-  uint16_t levelOffset;
-  uint16_t levelPercent;
-  uint16_t levelMinSpec;
-  boolean  driveAfterSet;
-  boolean  setIsClean;
+  unsigned long elapsedTime;
+  unsigned long untilRefresh;
+  unsigned long untilStep;
 
-  if ( levelMinNew == levelMin ) return true;
+  if ( updateInterval > 0 ) {
+    elapsedTime  = CwwLedTimebase::now () - lastDriveTime;
+    untilRefresh = elapsedTime >= updateInterval ? 0 : updateInterval - elapsedTime;
+  }
+  else {
+    untilRefresh = UPDATE_NOT_SCHEDULED;
+  }
 
-  driveAfterSet = ledLevel >= levelMin && ledLevel <= levelMax;
+  if ( sequencePlayerPtr != NULL ) untilStep = sequencePlayerPtr->millisUntilStep ();
+  else                             untilStep = UPDATE_NOT_SCHEDULED;
 
-  if ( driveAfterSet ) {
-    levelRange  = levelMax - levelMin;
-    levelOffset = ledLevel - levelMin;
-    levelPercent = ( (uint32_t) levelOffset << 15 ) / levelRange;
-    // levelPercent: fixed point with 15 fraction bits
+  return untilStep < untilRefresh ? untilStep : untilRefresh;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint8_t CwwLedController::checkInvariants () {
+
+  uint8_t stateIssues;
+  boolean levelMatches;
+  boolean modeIsPeriodic;
+  boolean modeHasPhases;
+
+  stateIssues = STATE_ISSUE_NONE;
+
+  if ( levelMin >= levelMax || levelMax > LEVEL_VALUE_ABS_MAX || ( ! derivedIsStale && levelStep == 0 ) ) {
+    stateIssues |= STATE_ISSUE_LEVEL_RANGE;
   }
 
-  levelMinSpec = levelMinNew << LEVEL_FP_BITS;
-  setIsClean = levelMinSpec < levelMax;
+  modeIsPeriodic = false;
+  modeHasPhases  = false;
 
-  if ( setIsClean ) levelMin = levelMinSpec;
-  else              levelMin = levelMax - ( 1 << LEVEL_FP_BITS );
+  switch ( ledModeActive ) {
+    case LED_OFF:         levelMatches = ledLevel == LEVEL_VALUE_ABS_MIN;  break;
+    case LED_ON:          levelMatches = ledLevel == LEVEL_VALUE_ABS_MAX;  break;
+    case LED_LOW:         levelMatches = ledLevel == levelMin;             break;
+    case LED_HIGH:        levelMatches = ledLevel == levelMax;             break;
+    case LED_HOLD_LEVEL:  levelMatches = ledLevel <= LEVEL_VALUE_ABS_MAX;  break;
+    case LED_BLINK_MAX:
+      levelMatches   = ledLevel == LEVEL_VALUE_ABS_MIN || ledLevel == LEVEL_VALUE_ABS_MAX;
+      modeIsPeriodic = true;
+      modeHasPhases  = true;
+      break;
+    case LED_BLINK_LEVEL:
+      levelMatches   = ledLevel == levelMin || ledLevel == levelMax;
+      modeIsPeriodic = true;
+      modeHasPhases  = true;
+      break;
+    case LED_FADE_DOWN:
+    case LED_FADE_UP:
+    case LED_ENVELOPE_ON:
+    case LED_ENVELOPE_OFF:
+      levelMatches   = ledLevel <= LEVEL_VALUE_ABS_MAX;
+      modeIsPeriodic = true;
+      break;
+    case LED_OSCILLATE:
+      levelMatches   = ledLevel <= LEVEL_VALUE_ABS_MAX;
+      modeIsPeriodic = true;
+      modeHasPhases  = true;
+      break;
+    default:
+      levelMatches = true;
+      stateIssues |= STATE_ISSUE_MODE;
+      break;
+  }
 
-  calcLevelMid ();
+  if ( ! levelMatches                           ) stateIssues |= STATE_ISSUE_LEVEL;
+  if ( modeIsPeriodic != ( updateInterval > 0 ) ) stateIssues |= STATE_ISSUE_SCHEDULE;
+  if ( remainingPhases > 0 && ! modeHasPhases   ) stateIssues |= STATE_ISSUE_PHASES;
 
-  if ( driveAfterSet ) {
-    levelRange = levelMax - levelMin;
-    levelOffset = ( (uint32_t) levelRange * levelPercent ) >> 15;
-    ledLevel = levelMin + levelOffset;
-    drivePin ( false );
+  if ( sequencePlayerPtr != NULL && ! sequencePlayerPtr->stateIsValid () ) {
+    stateIssues |= STATE_ISSUE_SEQUENCE;
   }
 
+  return stateIssues;
+
+}
+
+// ============================================================================
+
+boolean CwwLedController::setLevelMin ( uint8_t levelMinNew ) {
+
+  uint16_t levelMinSpec;
+  boolean  setIsClean;
+
+  levelMinSpec = (uint16_t) levelMinNew << LEVEL_FP_BITS;
+  if ( levelMinSpec == levelMin ) return true;
+
+  setIsClean = levelMinSpec < levelMax;
+  if ( ! setIsClean ) levelMinSpec = levelMax - ( 1 << LEVEL_FP_BITS );
+
+  if ( changeLevelRange ( levelMinSpec, levelMax ) ) drivePin ( false );
+  calcLevelMid  ();
   calcLevelStep ();
 
   return setIsClean;
@@ -552,39 +696,17 @@ boolean CwwLedController::setLevelMin ( uint8_t levelMinNew ) {
 
 boolean CwwLedController::setLevelMax ( uint8_t levelMaxNew ) {
 
-  uint16_t levelRange;
-  uint16_t levelOffset;
-  uint16_t levelPercent;
   uint16_t levelMaxSpec;
-  boolean  driveAfterSet;
   boolean  setIsClean;
 
-  if ( levelMaxNew == levelMax ) return true;
+  levelMaxSpec = (uint16_t) levelMaxNew << LEVEL_FP_BITS;
+  if ( levelMaxSpec == levelMax ) return true;
 
-  driveAfterSet = ledLevel >= levelMin && ledLevel <= levelMax;
-
-  if ( driveAfterSet ) {
-    levelRange  = levelMax - levelMin;
-    levelOffset = ledLevel - levelMin;
-    levelPercent = ( (uint32_t) levelOffset << 15 ) / levelRange;
-    // levelPercent: fixed point with 15 fraction bits
-  }
-
-  levelMaxSpec = levelMaxNew << LEVEL_FP_BITS;
   setIsClean = levelMaxSpec > levelMin;
+  if ( ! setIsClean ) levelMaxSpec = levelMin + ( 1 << LEVEL_FP_BITS );
 
-  if ( setIsClean ) levelMax = levelMaxSpec;
-  else              levelMax = levelMin + ( 1 << LEVEL_FP_BITS );
-
-  calcLevelMid ();
-
-  if ( driveAfterSet ) {
-    levelRange = levelMax - levelMin;
-    levelOffset = ( (uint32_t) levelRange * levelPercent ) >> 15;
-    ledLevel = levelMin + levelOffset;
-    drivePin ( false );
-  }
-
+  if ( changeLevelRange ( levelMin, levelMaxSpec ) ) drivePin ( false );
+  calcLevelMid  ();
   calcLevelStep ();
   
   return setIsClean;
@@ -595,54 +717,29 @@ boolean CwwLedController::setLevelMax ( uint8_t levelMaxNew ) {
 
 boolean CwwLedController::setLevelRange ( uint8_t levelMinNew, uint8_t levelMaxNew ) {
 
-  uint16_t levelRange;
-  uint16_t levelOffset;
-  uint16_t levelPercent;
-  boolean  driveAfterSet;
-  boolean  setIsClean;
-
-  driveAfterSet = ledLevel >= levelMin && ledLevel <= levelMax;
-
-  if ( driveAfterSet ) {
-    levelRange  = levelMax - levelMin;
-    levelOffset = ledLevel - levelMin;
-    levelPercent = ( (uint32_t) levelOffset << 15 ) / levelRange;
-    // levelPercent: fixed point with 15 fraction bits
-  }
+  uint8_t levelSwap;
+  boolean setIsClean;
 
   setIsClean = levelMinNew < levelMaxNew;
 
-  if ( setIsClean ) {
-    levelMin = levelMinNew;
-    levelMax = levelMaxNew;
-  }
-  else {
+  if ( ! setIsClean ) {
     if ( levelMinNew > levelMaxNew ) {
-      levelMin = levelMaxNew;
-      levelMax = levelMinNew;
+      levelSwap   = levelMinNew;
+      levelMinNew = levelMaxNew;
+      levelMaxNew = levelSwap;
+    }
+    else if ( levelMinNew == 0 ) {
+      levelMaxNew = 1;
     }
     else {
-      if ( levelMinNew == 0 ) {
-        levelMin = 0;
-        levelMax = 1;
-      }
-      else {
-        levelMin = levelMaxNew - 1;
-        levelMax = levelMaxNew;
-      }
+      levelMinNew = levelMaxNew - 1;
     }
   }
 
-  levelMin <<= LEVEL_FP_BITS;
-  levelMax <<= LEVEL_FP_BITS;
-  calcLevelMid ();
-
-  if ( driveAfterSet ) {
-    levelRange = levelMax - levelMin;
-    levelOffset = ( (uint32_t) levelRange * levelPercent ) >> 15;
-    ledLevel = levelMin + levelOffset;
-    drivePin ( false );
-  }
+  if ( changeLevelRange ( (uint16_t) levelMinNew << LEVEL_FP_BITS,
+                          (uint16_t) levelMaxNew << LEVEL_FP_BITS ) ) drivePin ( false );
+  calcLevelMid  ();
+  calcLevelStep ();
 
   return setIsClean;
 
@@ -650,9 +747,29 @@ boolean CwwLedController::setLevelRange ( uint8_t levelMinNew, uint8_t levelMaxN
 
 // ----------------------------------------------------------------------------
 
+boolean CwwLedController::setEnvelope (
+  uint16_t attackMs,
+  uint16_t decayMs,
+  uint8_t  sustainLevel,
+  uint16_t releaseMs
+) {
+
+  envelopeAttackMs     = attackMs;
+  envelopeDecayMs      = decayMs;
+  envelopeSustainLevel = sustainLevel;
+  envelopeReleaseMs    = releaseMs;
+
+  calcEnvelopeSteps ();
+
+  return envelopeSustain == (uint16_t) sustainLevel << LEVEL_FP_BITS;
+
+}
+
+// ----------------------------------------------------------------------------
+
 uint8_t CwwLedController::valueOfLevelMin () {
 
-  return levelMin;
+  return levelMin >> LEVEL_FP_BITS;
 
 }
 
@@ -660,7 +777,7 @@ uint8_t CwwLedController::valueOfLevelMin () {
 
 uint8_t CwwLedController::valueOfLevelMax () {
 
-  return levelMax;
+  return levelMax >> LEVEL_FP_BITS;
 
 }
 
@@ -668,7 +785,7 @@ uint8_t CwwLedController::valueOfLevelMax () {
 
 uint8_t CwwLedController::valueOfLevelStep () {
 
-  return levelStep;
+  return levelStep >> LEVEL_FP_BITS;
 
 }
 
@@ -706,63 +823,263 @@ boolean CwwLedController::isInverted () {
 }
 
 // ============================================================================
-// Private Functions
-// ============================================================================
-
-void CwwLedController::setMode (
-  cwwEnumLedMode ledModeNew,
-  uint16_t       phaseCount,
-  uint16_t       stepAmount,
-  boolean        forceSet
-) {
 
-  cwwEnumLedMode ledModeSpec;
+cwwEnumLedMode CwwLedController::digitalModeOf ( cwwEnumLedMode ledMode ) {
 
-  ledModeSpec = adjustMode ( ledModeNew );
-  if ( ledModeSpec != ledModeSetting || forceSet ) {
-    computeState ( ledModeSpec, phaseCount, stepAmount );
-    drivePin ();
+  switch ( ledMode ) {
+    case LED_HIGH:
+    case LED_STEP_UP:
+    case LED_FADE_UP:
+      return LED_ON;
+    case LED_LOW:
+    case LED_STEP_DOWN:
+    case LED_FADE_DOWN:
+    case LED_ENVELOPE_OFF:
+      return LED_OFF;
+    case LED_ENVELOPE_ON:
+      return LED_ON;
+    case LED_FADE_REVERSE:
+      return LED_TOGGLE_MAX;
+    case LED_BLINK_LEVEL:
+    case LED_OSCILLATE:
+      return LED_BLINK_MAX;
+    default:
+      return ledMode;
   }
 
 }
 
-// ----------------------------------------------------------------------------
+// ============================================================================
 
-cwwEnumLedMode CwwLedController::adjustMode (
-  cwwEnumLedMode ledModeNew
-) {
+void CwwLedController::setEventCallback ( cwwLedEventCallback callback, void * contextPtr ) {
 
-  cwwEnumLedMode ledModeAdjusted;
+  eventCallback   = callback;
+  eventContextPtr = contextPtr;
+  eventsPending   = 0;
 
-  // By default, just pass the incoming mode unless one of the following
-  // overrides or adjustments is required...
-  ledModeAdjusted = ledModeNew;
+}
 
-  // If PWM is not enabled, translate PWM-specific modes to
-  // nearest pure digital modes...
-  if ( ! usePwm ) {
-    switch ( ledModeNew ) {
-      case LED_HIGH:
-      case LED_STEP_UP:
-      case LED_FADE_UP:
-        ledModeAdjusted = LED_ON;
-        break;
-      case LED_LOW:
-      case LED_STEP_DOWN:
-      case LED_FADE_DOWN:
-        ledModeAdjusted = LED_OFF;
-        break;
-      case LED_FADE_REVERSE:
-        ledModeAdjusted = LED_TOGGLE_MAX;
-        break;
-      case LED_BLINK_LEVEL:
-      case LED_OSCILLATE:
-        ledModeAdjusted = LED_BLINK_MAX;
-        break;
-      case LED_HOLD_LEVEL:
-        ledModeAdjusted = ledModeActive;
-        break;
-    }
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedController::initialize (
+  boolean       usePwm,
+  boolean       invertSignal,
+  unsigned long blinkPeriod,
+  unsigned long oscillatePeriod,
+  uint16_t      refreshInterval 
+) {
+
+  this->usePwm       = usePwm;
+  this->invertSignal = invertSignal;
+
+  this->levelMin = LEVEL_VALUE_ABS_MIN;
+  this->levelMax = LEVEL_VALUE_ABS_MAX;
+  calcLevelMid ();
+  this->derivedIsStale = false;
+
+  this->envelopeAttackMs     = 0;
+  this->envelopeDecayMs      = 0;
+  this->envelopeSustainLevel = 255;
+  this->envelopeReleaseMs    = 500;
+  this->envelopeInDecay      = false;
+
+  this->refreshInterval = refreshInterval == 0 ? 1 : refreshInterval;
+  setBlinkPeriod     ( blinkPeriod     );
+  setOscillatePeriod ( oscillatePeriod );
+  this->remainingPhases = 0;
+
+  this->sequencePlayerPtr = NULL;
+
+  this->eventCallback   = NULL;
+  this->eventContextPtr = NULL;
+  this->eventsPending   = 0;
+
+  setMode ( LED_OFF, 0, 0, true );
+  drivePin ();
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedController::setMode (
+  cwwEnumLedMode ledModeNew,
+  uint16_t       phaseCount,
+  uint16_t       stepAmount,
+  boolean        forceSet
+) {
+
+  cwwEnumLedMode ledModeSpec;
+
+  ledModeSpec = adjustMode ( ledModeNew );
+  if ( ledModeSpec != ledModeSetting || forceSet ) {
+    // Phases left over from an interrupted blink or oscillation must not
+    // limit the new mode...
+    remainingPhases = 0;
+    computeState ( ledModeSpec, phaseCount, stepAmount );
+    drivePin ();
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedController::applyStep (
+  cwwEnumLedMode modeOfStep,
+  uint16_t       operandOfStep
+) {
+
+  switch ( modeOfStep ) {
+
+    case LED_BLINK:
+    case LED_BLINK_MAX:
+    case LED_BLINK_LEVEL:
+    case LED_OSCILLATE:
+      setMode ( modeOfStep, operandOfStep, 0, operandOfStep > 0 );
+      break;
+
+    case LED_STEP_DOWN:
+    case LED_STEP_UP:
+      if ( operandOfStep > 255 ) operandOfStep = 255;
+      setMode ( modeOfStep, 0, operandOfStep << LEVEL_FP_BITS, true );
+      break;
+
+    case LED_HOLD_LEVEL:
+      if ( operandOfStep > 255 ) operandOfStep = 255;
+      if ( operandOfStep > 0 ) applyLevel ( operandOfStep << LEVEL_FP_BITS );
+      else                     setMode ( modeOfStep, 0, 0, false );
+      break;
+
+    default:
+      setMode ( modeOfStep, 0, 0, false );
+      break;
+
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedController::applyLevel ( uint16_t levelNew ) {
+
+  boolean success;
+
+  success = true;
+
+  if      ( levelNew == LEVEL_VALUE_ABS_MIN ) setMode ( LED_OFF,  0, 0, false );
+  else if ( levelNew >= LEVEL_VALUE_ABS_MAX ) setMode ( LED_ON,   0, 0, false );
+  else if ( levelNew == levelMin            ) setMode ( LED_LOW,  0, 0, false );
+  else if ( levelNew == levelMax            ) setMode ( LED_HIGH, 0, 0, false );
+  else if ( usePwm ) {
+    success = levelNew >= levelMin && levelNew <= levelMax;
+    if      ( levelNew < levelMin ) levelNew = levelMin;
+    else if ( levelNew > levelMax ) levelNew = levelMax;
+    ledLevel = levelNew;
+    ledModeSetting  = LED_HOLD_LEVEL;
+    ledModeActive   = LED_HOLD_LEVEL;
+    updateInterval  = 0;
+    remainingPhases = 0;
+    drivePin ();
+  }
+  else {
+    success = false;
+  }
+
+  return success;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedController::applyParamStep (
+  cwwEnumLedParam paramOfStep,
+  uint16_t        valueOfStep
+) {
+
+  uint16_t levelMinNew;
+  uint16_t levelMaxNew;
+
+  // Set parameters without recomputing derived values or driving the
+  // pin; see refreshDerived()...
+  switch ( paramOfStep ) {
+
+    case LED_PARAM_BLINK_PERIOD:
+      blinkPeriod = valueOfStep >= 2 ? valueOfStep : 2;
+      break;
+
+    case LED_PARAM_OSCILLATE_PERIOD:
+      oscillatePeriod = valueOfStep >= 2 ? valueOfStep : 2;
+      derivedIsStale = true;
+      break;
+
+    case LED_PARAM_REFRESH_INTERVAL:
+      refreshInterval = valueOfStep > 0 ? valueOfStep : 1;
+      derivedIsStale = true;
+      break;
+
+    case LED_PARAM_LEVEL_MIN:
+      levelMinNew = ( valueOfStep & 0xFF ) << LEVEL_FP_BITS;
+      if ( levelMinNew >= levelMax ) levelMinNew = levelMax - ( 1 << LEVEL_FP_BITS );
+      changeLevelRange ( levelMinNew, levelMax );
+      derivedIsStale = true;
+      break;
+
+    case LED_PARAM_LEVEL_MAX:
+      levelMaxNew = ( valueOfStep & 0xFF ) << LEVEL_FP_BITS;
+      if ( levelMaxNew <= levelMin ) levelMaxNew = levelMin + ( 1 << LEVEL_FP_BITS );
+      changeLevelRange ( levelMin, levelMaxNew );
+      derivedIsStale = true;
+      break;
+
+    case LED_PARAM_LEVEL_RANGE:
+      levelMinNew = valueOfStep & 0xFF;
+      levelMaxNew = valueOfStep >> 8;
+      if ( levelMinNew > levelMaxNew ) {
+        levelMinNew = valueOfStep >> 8;
+        levelMaxNew = valueOfStep & 0xFF;
+      }
+      else if ( levelMinNew == levelMaxNew ) {
+        if ( levelMinNew == 0 ) levelMaxNew = 1;
+        else                    levelMinNew = levelMaxNew - 1;
+      }
+      changeLevelRange ( levelMinNew << LEVEL_FP_BITS, levelMaxNew << LEVEL_FP_BITS );
+      derivedIsStale = true;
+      break;
+
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedController::refreshDerived () {
+
+  if ( derivedIsStale ) {
+    calcLevelMid  ();
+    calcLevelStep ();
+    derivedIsStale = false;
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+cwwEnumLedMode CwwLedController::adjustMode (
+  cwwEnumLedMode ledModeNew
+) {
+
+  cwwEnumLedMode ledModeAdjusted;
+
+  // By default, just pass the incoming mode unless one of the following
+  // overrides or adjustments is required...
+  ledModeAdjusted = ledModeNew;
+
+  // If PWM is not enabled, translate PWM-specific modes to
+  // nearest pure digital modes...
+  if ( ! usePwm ) {
+    if ( ledModeNew == LED_HOLD_LEVEL ) ledModeAdjusted = ledModeActive;
+    else                                ledModeAdjusted = digitalModeOf ( ledModeNew );
   }
 
   // Translate generic toggle model to pure digital or
@@ -823,6 +1140,7 @@ void CwwLedController::computeState (
       ledLevel = LEVEL_VALUE_ABS_MIN;
       ledModeActive = LED_OFF;
       updateInterval = 0;
+      break;
  
     case LED_LOW:
       ledDirIsUp = false;
@@ -872,6 +1190,7 @@ void CwwLedController::computeState (
         else {
           ledModeActive = ledDirIsUp ? LED_ON : LED_OFF;
           updateInterval = 0;
+          queueEvent ( LED_EVENT_PHASES_DONE );
         }
       }
       else {
@@ -893,6 +1212,7 @@ void CwwLedController::computeState (
         else {
           ledModeActive = ledDirIsUp ? LED_HIGH : LED_LOW;
           updateInterval = 0;
+          queueEvent ( LED_EVENT_PHASES_DONE );
         }
       }
       else {
@@ -971,6 +1291,7 @@ void CwwLedController::computeState (
         else {
           ledModeActive = ledDirIsUp ? LED_HIGH : LED_LOW;
           updateInterval = 0;
+          queueEvent ( LED_EVENT_PHASES_DONE );
         }
       }
       else {
@@ -984,6 +1305,47 @@ void CwwLedController::computeState (
       updateInterval = 0;
       break;
 
+    case LED_ENVELOPE_ON:
+      // Attack starts from the current level; a level at or above the
+      // maximum goes straight to decay...
+      if ( ledModeActive != LED_ENVELOPE_ON ) envelopeInDecay = ledLevel >= levelMax;
+      if ( ! envelopeInDecay ) {
+        ledDirIsUp = true;
+        incrementLevel ( envelopeAttackStep );
+        envelopeInDecay = ledLevel == levelMax;
+        ledModeActive = LED_ENVELOPE_ON;
+        updateInterval = refreshInterval;
+      }
+      else {
+        ledDirIsUp = false;
+        if ( ledLevel > envelopeSustain && ledLevel - envelopeSustain > envelopeDecayStep ) ledLevel -= envelopeDecayStep;
+        else                                                                                ledLevel  = envelopeSustain;
+        if ( ledLevel != envelopeSustain ) {
+          ledModeActive = LED_ENVELOPE_ON;
+          updateInterval = refreshInterval;
+        }
+        else {
+          if      ( ledLevel == levelMax ) ledModeActive = LED_HIGH;
+          else if ( ledLevel == levelMin ) ledModeActive = LED_LOW;
+          else                             ledModeActive = LED_HOLD_LEVEL;
+          updateInterval = 0;
+        }
+      }
+      break;
+
+    case LED_ENVELOPE_OFF:
+      ledDirIsUp = false;
+      decrementLevel ( envelopeReleaseStep );
+      if ( ledLevel == levelMin ) {
+        ledModeActive = LED_LOW;
+        updateInterval = 0;
+      }
+      else {
+        ledModeActive = LED_ENVELOPE_OFF;
+        updateInterval = refreshInterval;
+      }
+      break;
+
   }  // switch ( ledModeNew )
 
 }
@@ -1009,10 +1371,51 @@ boolean CwwLedController::calcLevelStep () {
   setIsClean = setIsClean && levelStep > 0;
   if ( levelStep == 0 ) levelStep = 1;
 
+  // Envelope steps depend on the same range and refresh interval...
+  calcEnvelopeSteps ();
+
   return setIsClean;
 
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedController::calcEnvelopeSteps () {
+
+  uint16_t releaseDistance;
+
+  envelopeSustain = (uint16_t) envelopeSustainLevel << LEVEL_FP_BITS;
+  if      ( envelopeSustain < levelMin ) envelopeSustain = levelMin;
+  else if ( envelopeSustain > levelMax ) envelopeSustain = levelMax;
+
+  releaseDistance = envelopeSustain - levelMin;
+  if ( releaseDistance == 0 ) releaseDistance = levelMax - levelMin;
+
+  // Computed once per change of timing or range, so that each refresh of
+  // an envelope is a single add (or subtract) and compare...
+  envelopeAttackStep  = calcSegmentStep ( levelMax - levelMin,        envelopeAttackMs  );
+  envelopeDecayStep   = calcSegmentStep ( levelMax - envelopeSustain, envelopeDecayMs   );
+  envelopeReleaseStep = calcSegmentStep ( releaseDistance,            envelopeReleaseMs );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedController::calcSegmentStep (
+  uint16_t levelDistance,
+  uint16_t segmentMs
+) {
+
+  uint32_t segmentStep;
+
+  // Segments no longer than one refresh complete in a single step...
+  if ( segmentMs <= refreshInterval ) segmentStep = levelDistance;
+  else                                segmentStep = (uint32_t) levelDistance * refreshInterval / segmentMs;
+
+  return segmentStep > 0 ? segmentStep : 1;
+
+}
+
 // ----------------------------------------------------------------------------
 
 void CwwLedController::decrementLevel () {
@@ -1055,6 +1458,42 @@ void CwwLedController::incrementLevel ( uint16_t delta ) {
 
 // ============================================================================
 
+boolean CwwLedController::changeLevelRange ( uint16_t levelMinNew, uint16_t levelMaxNew ) {
+
+  uint16_t levelRange;
+  uint16_t levelOffset;
+  uint16_t levelPercent;
+  boolean  levelInRange;
+
+  // Keep level at the same relative position within the new range, if it
+  // is within the current range; caller needs to drive the pin if so.
+  // Full off and on are absolute levels, even where they fall within the
+  // range...
+  levelInRange = ledLevel >= levelMin && ledLevel <= levelMax
+              && ledModeActive != LED_OFF && ledModeActive != LED_ON && ledModeActive != LED_BLINK_MAX;
+
+  if ( levelInRange ) {
+    levelRange  = levelMax - levelMin;
+    levelOffset = ledLevel - levelMin;
+    levelPercent = ( (uint32_t) levelOffset << 15 ) / levelRange;
+    // levelPercent: fixed point with 15 fraction bits
+  }
+
+  levelMin = levelMinNew;
+  levelMax = levelMaxNew;
+
+  if ( levelInRange ) {
+    levelRange = levelMax - levelMin;
+    levelOffset = ( (uint32_t) levelRange * levelPercent ) >> 15;
+    ledLevel = levelMin + levelOffset;
+  }
+
+  return levelInRange;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
 void CwwLedController::calcLevelMid () {
 
   levelMid = levelMin + ( levelMax - levelMin ) / 2;
@@ -1079,41 +1518,74 @@ boolean CwwLedController::levelIsNearAbsMax () {
 
 // ============================================================================
 
+boolean CwwLedController::refreshIsDue () {
+
+  // Unsigned difference stays correct when the time wraps around...
+  return updateInterval > 0 && CwwLedTimebase::now () - lastDriveTime >= updateInterval;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
 void CwwLedController::drivePin ( boolean markDriveTime ) {
 
   uint8_t ledLevelEff;
 
   ledLevelEff = ( invertSignal ? LEVEL_VALUE_ABS_MAX - ledLevel : ledLevel ) >> LEVEL_FP_BITS;
 
-  if      ( ledLevelEff == 0 ) digitalWrite ( ledPin, LOW         );
-  else if ( usePwm )           analogWrite  ( ledPin, ledLevelEff );
-  else                         digitalWrite ( ledPin, HIGH        );
+  if      ( ledOutputPtr != NULL ) ledOutputPtr->writeLevel ( ledPin, ledLevelEff, usePwm );
+  else if ( ledLevelEff == 0 )     digitalWrite ( ledPin, LOW         );
+  else if ( usePwm )               analogWrite  ( ledPin, ledLevelEff );
+  else                             digitalWrite ( ledPin, HIGH        );
+
+  if ( markDriveTime ) lastDriveTime = CwwLedTimebase::now ();
+
+}
+
+// ============================================================================
+
+void CwwLedController::queueEvent ( cwwEnumLedEvent ledEvent ) {
+
+  if ( eventCallback != NULL ) eventsPending |= 1 << ledEvent;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedController::dispatchEvents () {
+
+  uint8_t eventsToFire;
+  uint8_t ledEvent;
+
+  if ( eventsPending == 0 ) return;
 
-  if ( markDriveTime ) lastDriveTime = millis ();
+  // Clear before invoking, as callbacks may cause new events...
+  eventsToFire  = eventsPending;
+  eventsPending = 0;
+
+  for ( ledEvent = 0; eventsToFire != 0; ledEvent++, eventsToFire >>= 1 ) {
+    if ( ( eventsToFire & 1 ) && eventCallback != NULL ) {
+      eventCallback ( this, (cwwEnumLedEvent) ledEvent, eventContextPtr );
+    }
+  }
 
 }
 
 // ****************************************************************************
-// LED Action Sequence Class (defines action/event sequence)
+// LED Output Backend Interface Class
 // ****************************************************************************
 
 // ============================================================================
 // Constructors, Destructor
 // ============================================================================
 
-CwwLedSequence::CwwLedSequence () {
+CwwLedOutput::CwwLedOutput () {
 
-   startOfSequencePtr = NULL;
-   repeatCount        = 1;
-   attachCount        = 0;
-   
 }
 
 // ----------------------------------------------------------------------------
 
-CwwLedSequence::~CwwLedSequence () {
-
-  discardAll ();
+CwwLedOutput::~CwwLedOutput () {
 
 }
 
@@ -1121,48 +1593,198 @@ CwwLedSequence::~CwwLedSequence () {
 // Public Functions
 // ============================================================================
 
-void CwwLedSequence::addStep ( unsigned long timeToStepMs, cwwEnumLedMode modeOfStep ) {
+void CwwLedOutput::beginFrame () {
 
-  structSequenceStep * newStepPtr;
-  structSequenceStep * lastStepPtr;
+}
 
-  newStepPtr = new structSequenceStep;
-  newStepPtr->timeToStepMs = timeToStepMs;
-  newStepPtr->modeOfStep   = modeOfStep;
-  newStepPtr->nextStepPtr  = NULL;
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-  if ( startOfSequencePtr == NULL ) {
-    startOfSequencePtr = newStepPtr;
-  }
-  else {
-    lastStepPtr = startOfSequencePtr;
-    while ( lastStepPtr->nextStepPtr != NULL ) lastStepPtr = lastStepPtr->nextStepPtr;
-    lastStepPtr->nextStepPtr = newStepPtr;
-  }
+void CwwLedOutput::commitFrame () {
 
 }
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// ****************************************************************************
+// LED Action Sequence Class (defines action/event sequence)
+// ****************************************************************************
 
-void CwwLedSequence::discardAll ( boolean forceDiscard ) {
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
 
-  structSequenceStep * delStepPtr;
-  structSequenceStep * nextStepPtr;
+CwwLedSequence::CwwLedSequence () {
 
-  if ( attachCount == 0 || forceDiscard ) {
+   steps        = NULL;
+   tablePtr     = NULL;
+   stepCount    = 0;
+   stepCapacity = 0;
+   repeatCount  = 1;
+   attachCount  = 0;
+   
+}
 
-    delStepPtr = startOfSequencePtr;
-    while ( delStepPtr != NULL ) {
-      nextStepPtr = delStepPtr->nextStepPtr;
-      delete delStepPtr;
-      delStepPtr = nextStepPtr;
-    }
+// ----------------------------------------------------------------------------
 
-    startOfSequencePtr = NULL;
-    repeatCount = 1;
+CwwLedSequence::~CwwLedSequence () {
+
+  discardAll ();
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+void CwwLedSequence::addStep (
+  unsigned long  timeToStepMs,
+  cwwEnumLedMode modeOfStep,
+  uint16_t       operandOfStep
+) {
+
+  appendStep ( timeToStepMs, STEP_KIND_MODE, modeOfStep, operandOfStep );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSequence::addParamStep (
+  unsigned long   timeToStepMs,
+  cwwEnumLedParam paramOfStep,
+  uint16_t        valueOfStep
+) {
+
+  appendStep ( timeToStepMs, STEP_KIND_PARAM, paramOfStep, valueOfStep );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSequence::discardAll ( boolean forceDiscard ) {
+
+  if ( attachCount == 0 || forceDiscard ) {
+
+    delete [] steps;
+
+    steps        = NULL;
+    tablePtr     = NULL;
+    stepCount    = 0;
+    stepCapacity = 0;
+    repeatCount  = 1;
+
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint8_t CwwLedSequence::validate ( boolean forPwm ) {
+
+  structSequenceStep prevStep;
+  structSequenceStep step;
+  uint16_t           stepIndex;
+  unsigned long      totalTimeMs;
+  uint8_t            issueFlags;
+
+  issueFlags  = SEQUENCE_ISSUE_NONE;
+  totalTimeMs = 0;
+
+  for ( stepIndex = 0; stepIndex < stepCount; stepIndex++ ) {
+    readStep ( stepIndex, &step );
+    issueFlags |= issuesOfStep ( &step, forPwm );
+    if ( stepIndex > 0 && stepRepeats  ( &prevStep, &step ) ) issueFlags |= SEQUENCE_ISSUE_REDUNDANT_STEP;
+    if ( stepIndex > 0 && stepIsHidden ( &prevStep, &step ) ) issueFlags |= SEQUENCE_ISSUE_HIDDEN_STEP;
+    totalTimeMs += step.timeToStepMs;
+    prevStep = step;
+  }
+
+  if ( stepCount > 0 && totalTimeMs == 0 && repeatCount != 1 ) issueFlags |= SEQUENCE_ISSUE_ZERO_LENGTH;
+
+  return issueFlags;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedSequence::optimize ( boolean forPwm ) {
+
+  structSequenceStep * stepPtr;
+  uint16_t             stepIndex;
+  uint16_t             keptCount;
+  cwwEnumLedMode       modeOfStep;
+
+  // Players keep positions in the sequence; tables are constant...
+  if ( attachCount > 0 || tablePtr != NULL ) return 0;
+
+  // Substitute modes requiring PWM first, so that substitutes can be
+  // merged with neighboring steps...
+  if ( ! forPwm ) {
+    for ( stepIndex = 0; stepIndex < stepCount; stepIndex++ ) {
+      stepPtr = &steps[stepIndex];
+      if ( stepPtr->kindOfStep != STEP_KIND_MODE || stepPtr->codeOfStep >= LED_MODE_COUNT ) continue;
+      modeOfStep = CwwLedController::digitalModeOf ( (cwwEnumLedMode) stepPtr->codeOfStep );
+      if ( modeOfStep != stepPtr->codeOfStep ) {
+        stepPtr->codeOfStep = modeOfStep;
+        if ( modeOfStep == LED_ON || modeOfStep == LED_OFF || modeOfStep == LED_TOGGLE_MAX ) stepPtr->operandOfStep = 0;
+      }
+    }
+  }
+
+  // Compact steps in place; a step is compared to the last step kept...
+  keptCount = 0;
+
+  for ( stepIndex = 0; stepIndex < stepCount; stepIndex++ ) {
+
+    stepPtr = &steps[stepIndex];
+
+    // A step hidden by a zero delay step (see stepIsHidden) is kept: it
+    // still shows for one refresh...
+    if ( stepIndex + 1 < stepCount
+      && keptCount > 0 && stepRepeats ( &steps[keptCount - 1], stepPtr ) ) {
+      // Remove step, passing its delay on to the following step...
+      ( stepPtr + 1 )->timeToStepMs += stepPtr->timeToStepMs;
+    }
+    else {
+      steps[keptCount++] = *stepPtr;
+    }
 
   }
 
+  stepIndex = stepCount - keptCount;
+  stepCount = keptCount;
+
+  return stepIndex;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedSequence::useTable ( const uint8_t * tablePtr ) {
+
+  if ( attachCount > 0 ) return false;
+
+  discardAll ();
+
+  this->tablePtr = tablePtr;
+  stepCount      = pgm_read_byte ( tablePtr ) | (uint16_t) pgm_read_byte ( tablePtr + 1 ) << 8;
+  repeatCount    = pgm_read_byte ( tablePtr + 2 );
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedSequence::isTable () {
+
+  return tablePtr != NULL;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedSequence::valueOfStepCount () {
+
+  return stepCount;
+
 }
 
 // ----------------------------------------------------------------------------
@@ -1207,6 +1829,198 @@ void  CwwLedSequence::detachPlayer () {
 
 }
 
+// ----------------------------------------------------------------------------
+
+void CwwLedSequence::appendStep (
+  unsigned long timeToStepMs,
+  uint8_t       kindOfStep,
+  uint8_t       codeOfStep,
+  uint16_t      operandOfStep
+) {
+
+  structSequenceStep * newSteps;
+  uint16_t             newCapacity;
+  uint16_t             stepIndex;
+
+  if ( tablePtr != NULL ) copyTable ();
+
+  if ( stepCount >= stepCapacity ) {
+
+    if ( stepCapacity == 0xFFFF ) return;
+
+    newCapacity = stepCapacity == 0 ? 4 : stepCapacity < 0x8000 ? stepCapacity * 2 : 0xFFFF;
+    newSteps    = new structSequenceStep [ newCapacity ];
+    for ( stepIndex = 0; stepIndex < stepCount; stepIndex++ ) newSteps[stepIndex] = steps[stepIndex];
+
+    delete [] steps;
+    steps        = newSteps;
+    stepCapacity = newCapacity;
+
+  }
+
+  steps[stepCount].timeToStepMs  = timeToStepMs;
+  steps[stepCount].kindOfStep    = kindOfStep;
+  steps[stepCount].codeOfStep    = codeOfStep;
+  steps[stepCount].operandOfStep = operandOfStep;
+  stepCount++;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSequence::readStep (
+  uint16_t             stepIndex,
+  structSequenceStep * stepPtr
+) {
+
+  const cwwStructLedPackedStep * packedPtr;
+  uint8_t                        kindAndCode;
+
+  if ( tablePtr == NULL ) {
+    *stepPtr = steps[stepIndex];
+  }
+  else {
+    packedPtr   = (const cwwStructLedPackedStep *) ( tablePtr + SEQUENCE_TABLE_HEADER_BYTES ) + stepIndex;
+    kindAndCode = pgm_read_byte ( &packedPtr->kindAndCode );
+    stepPtr->timeToStepMs  = pgm_read_byte ( &packedPtr->delayLow   ) | (uint16_t) pgm_read_byte ( &packedPtr->delayHigh   ) << 8;
+    stepPtr->operandOfStep = pgm_read_byte ( &packedPtr->operandLow ) | (uint16_t) pgm_read_byte ( &packedPtr->operandHigh ) << 8;
+    stepPtr->kindOfStep    = kindAndCode & SEQUENCE_TABLE_PARAM_FLAG ? STEP_KIND_PARAM : STEP_KIND_MODE;
+    stepPtr->codeOfStep    = kindAndCode & ~SEQUENCE_TABLE_PARAM_FLAG;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSequence::copyTable () {
+
+  uint16_t stepIndex;
+
+  stepCapacity = stepCount + 4;
+  steps        = new structSequenceStep [ stepCapacity ];
+  for ( stepIndex = 0; stepIndex < stepCount; stepIndex++ ) readStep ( stepIndex, &steps[stepIndex] );
+
+  tablePtr = NULL;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedSequence::timeToStep (
+  uint16_t stepIndex,
+  boolean  playReversed
+) {
+
+  structSequenceStep step;
+
+  // In reverse, a step follows the delay preceding its successor (the
+  // first step's delay for the last step, like the gap between iterations)...
+  if ( playReversed ) stepIndex = stepIndex + 1 < stepCount ? stepIndex + 1 : 0;
+
+  if ( tablePtr == NULL ) return steps[stepIndex].timeToStepMs;
+
+  readStep ( stepIndex, &step );
+
+  return step.timeToStepMs;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint8_t CwwLedSequence::issuesOfStep (
+  structSequenceStep * stepPtr,
+  boolean              forPwm
+) {
+
+  uint16_t operandOfStep;
+
+  operandOfStep = stepPtr->operandOfStep;
+
+  if ( stepPtr->kindOfStep == STEP_KIND_PARAM ) {
+    switch ( stepPtr->codeOfStep ) {
+      case LED_PARAM_BLINK_PERIOD:
+      case LED_PARAM_OSCILLATE_PERIOD:
+        return operandOfStep < 2 ? SEQUENCE_ISSUE_BAD_VALUE : SEQUENCE_ISSUE_NONE;
+      case LED_PARAM_REFRESH_INTERVAL:
+        return operandOfStep == 0 ? SEQUENCE_ISSUE_BAD_VALUE : SEQUENCE_ISSUE_NONE;
+      case LED_PARAM_LEVEL_MIN:
+      case LED_PARAM_LEVEL_MAX:
+        return operandOfStep > 255 ? SEQUENCE_ISSUE_BAD_VALUE : SEQUENCE_ISSUE_NONE;
+      case LED_PARAM_LEVEL_RANGE:
+        return ( operandOfStep & 0xFF ) >= ( operandOfStep >> 8 ) ? SEQUENCE_ISSUE_BAD_VALUE : SEQUENCE_ISSUE_NONE;
+      default:
+        return SEQUENCE_ISSUE_BAD_CODE;
+    }
+  }
+
+  if ( stepPtr->codeOfStep >= LED_MODE_COUNT ) return SEQUENCE_ISSUE_BAD_CODE;
+
+  switch ( stepPtr->codeOfStep ) {
+    case LED_STEP_DOWN:
+    case LED_STEP_UP:
+    case LED_HOLD_LEVEL:
+      if ( operandOfStep > 255 ) return SEQUENCE_ISSUE_BAD_VALUE;
+      break;
+  }
+
+  if ( ! forPwm && CwwLedController::digitalModeOf ( (cwwEnumLedMode) stepPtr->codeOfStep ) != stepPtr->codeOfStep ) {
+    return SEQUENCE_ISSUE_NEEDS_PWM;
+  }
+
+  return SEQUENCE_ISSUE_NONE;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedSequence::stepIsAbsolute ( structSequenceStep * stepPtr ) {
+
+  // True if step sets a state independent of the state before it...
+  if ( stepPtr->kindOfStep != STEP_KIND_MODE ) return false;
+
+  switch ( stepPtr->codeOfStep ) {
+    case LED_OFF:
+    case LED_ON:
+    case LED_LOW:
+    case LED_HIGH:
+      return stepPtr->operandOfStep == 0;
+    case LED_HOLD_LEVEL:
+      return stepPtr->operandOfStep > 0;
+    default:
+      return false;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedSequence::stepRepeats (
+  structSequenceStep * prevStepPtr,
+  structSequenceStep * stepPtr
+) {
+
+  // Repeating a parameter step or an absolute mode step has no effect;
+  // repeating e.g. a toggle or a step up does...
+  return stepPtr->kindOfStep    == prevStepPtr->kindOfStep
+      && stepPtr->codeOfStep    == prevStepPtr->codeOfStep
+      && stepPtr->operandOfStep == prevStepPtr->operandOfStep
+      && ( stepPtr->kindOfStep == STEP_KIND_PARAM || stepIsAbsolute ( stepPtr ) );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedSequence::stepIsHidden (
+  structSequenceStep * stepPtr,
+  structSequenceStep * nextStepPtr
+) {
+
+  return stepPtr->kindOfStep == STEP_KIND_MODE
+      && nextStepPtr->timeToStepMs == 0
+      && stepIsAbsolute ( nextStepPtr );
+
+}
+
 // ****************************************************************************
 // LED Action Sequence Player Class (manages advancing through sequence)
 // ****************************************************************************
@@ -1215,10 +2029,19 @@ void  CwwLedSequence::detachPlayer () {
 // Constructors, Destructor
 // ============================================================================
 
-CwwLedSequencePlayer::CwwLedSequencePlayer () {
+CwwLedSequencePlayer::CwwLedSequencePlayer ( CwwLedController * ownerPtr ) {
+
+  this->ownerPtr = ownerPtr;
 
   attachedSequencePtr = NULL;
-  currentStepPtr      = NULL;
+
+  stepIndex     = 0;
+  stepStartTime = 0;
+  stepWaitMs    = 0;
+  stepRemainMs  = 0;
+  playerState   = PLAYER_IDLE;
+  playbackRate  = SEQUENCE_RATE_NORMAL;
+  playReversed  = false;
 
   iterationsToPlay = 1;
   currentIteration = 0;
@@ -1243,7 +2066,8 @@ void CwwLedSequencePlayer::attachSequence ( CwwLedSequence * sequencePtr ) {
 
   attachedSequencePtr = sequencePtr;
   attachedSequencePtr->attachPlayer ();
-  currentStepPtr = attachedSequencePtr->startOfSequencePtr;
+  stepIndex   = 0;
+  playerState = PLAYER_IDLE;
 
 }
 
@@ -1252,8 +2076,9 @@ void CwwLedSequencePlayer::attachSequence ( CwwLedSequence * sequencePtr ) {
 void CwwLedSequencePlayer::detachSequence () {
 
   if ( attachedSequencePtr != NULL ) attachedSequencePtr->detachPlayer ();
-  
+
   attachedSequencePtr = NULL;
+  playerState         = PLAYER_IDLE;
 
 }
 
@@ -1278,10 +2103,12 @@ uint8_t CwwLedSequencePlayer::valueOfRepeatCount () {
 
 boolean CwwLedSequencePlayer::startFirstStep () {
 
-  if ( attachedSequencePtr->startOfSequencePtr != NULL ) {
-    currentStepPtr = attachedSequencePtr->startOfSequencePtr;
+  if ( attachedSequencePtr != NULL && attachedSequencePtr->stepCount > 0 ) {
+    stepIndex        = playReversed ? attachedSequencePtr->stepCount - 1 : 0;
     currentIteration = 1;
-    delayToStepTimer.start( currentStepPtr->timeToStepMs );
+    playerState      = PLAYER_RUNNING;
+    attachedSequencePtr->readStep ( stepIndex, &currentStep );
+    startWait ( attachedSequencePtr->timeToStep ( stepIndex, playReversed ), CwwLedTimebase::now () );
     return true;
   }
   else {
@@ -1294,28 +2121,44 @@ boolean CwwLedSequencePlayer::startFirstStep () {
 
 boolean CwwLedSequencePlayer::advanceOneStep () {
 
+  uint16_t stepCount;
   uint16_t effectiveIterations;
+  boolean  atEndOfSequence;
   boolean  stepSuccess;
 
-  if ( attachedSequencePtr->startOfSequencePtr == NULL ) return false;
+  stepCount = attachedSequencePtr->stepCount;
+  if ( stepIndex >= stepCount ) return false;
 
-  if ( currentStepPtr->nextStepPtr != NULL ) {
-    currentStepPtr = currentStepPtr->nextStepPtr;
+  atEndOfSequence = playReversed ? stepIndex == 0 : stepIndex + 1 >= stepCount;
+
+  if ( ! atEndOfSequence ) {
+    if ( playReversed ) stepIndex--;
+    else                stepIndex++;
     stepSuccess = true;
   }
   else {
     effectiveIterations = iterationsToPlay * attachedSequencePtr->repeatCount;
     stepSuccess = effectiveIterations == 0 || currentIteration < effectiveIterations;
     if ( stepSuccess ) {
-      currentStepPtr = attachedSequencePtr->startOfSequencePtr;
-      currentIteration++;
+      stepIndex = playReversed ? stepCount - 1 : 0;
+      // Endless play needs no count, which would wrap around to 0 after
+      // 65535 iterations...
+      if ( effectiveIterations > 0 ) currentIteration++;
+      if ( ownerPtr != NULL ) ownerPtr->queueEvent ( LED_EVENT_ITERATION );
     }
     else {
-      stop ();
+      playerState = PLAYER_IDLE;
+      if ( ownerPtr != NULL ) ownerPtr->queueEvent ( LED_EVENT_SEQUENCE_END );
     };
   }
 
-  if ( stepSuccess ) delayToStepTimer.start( currentStepPtr->timeToStepMs );
+  if ( stepSuccess ) {
+    // Time the next step from when the previous one was due rather than
+    // from now, so that late updates do not accumulate...
+    attachedSequencePtr->readStep ( stepIndex, &currentStep );
+    startWait ( attachedSequencePtr->timeToStep ( stepIndex, playReversed ), stepStartTime + stepWaitMs );
+    if ( ownerPtr != NULL ) ownerPtr->queueEvent ( LED_EVENT_STEP );
+  }
 
   return stepSuccess;
 
@@ -1324,30 +2167,91 @@ boolean CwwLedSequencePlayer::advanceOneStep () {
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
 void CwwLedSequencePlayer::stop () {
-  
-  delayToStepTimer.stop ();
+
+  if ( playerState == PLAYER_RUNNING ) freezeWait ();
+  if ( playerState != PLAYER_IDLE    ) playerState = PLAYER_STOPPED;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSequencePlayer::pause () {
+
+  if ( playerState == PLAYER_RUNNING ) {
+    freezeWait ();
+    playerState = PLAYER_PAUSED;
+  }
 
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
 boolean CwwLedSequencePlayer::resume () {
-  
-  if ( isPaused() ) {
-    delayToStepTimer.resume ();
+
+  if ( playerState == PLAYER_STOPPED || playerState == PLAYER_PAUSED ) {
+    playerState = PLAYER_RUNNING;
+    startWait ( stepRemainMs, CwwLedTimebase::now () );
     return true;
   }
   else {
-    return true;
+    return playerState == PLAYER_RUNNING;
   }
 
 }
 
 // ----------------------------------------------------------------------------
 
+boolean CwwLedSequencePlayer::setRate ( uint16_t playbackRate ) {
+
+  boolean setIsClean;
+
+  setIsClean = playbackRate > 0;
+  if ( ! setIsClean ) playbackRate = 1;
+
+  // Rebase the step in progress, so that the part of its delay already
+  // played keeps the old rate...
+  if ( playerState == PLAYER_RUNNING ) {
+    freezeWait ();
+    this->playbackRate = playbackRate;
+    startWait ( stepRemainMs, CwwLedTimebase::now () );
+  }
+  else {
+    this->playbackRate = playbackRate;
+  }
+
+  return setIsClean;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedSequencePlayer::valueOfRate () {
+
+  return playbackRate;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSequencePlayer::setReverse ( boolean playReversed ) {
+
+  this->playReversed = playReversed;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedSequencePlayer::isReversed () {
+
+  return playReversed;
+
+}
+
+// ----------------------------------------------------------------------------
+
 boolean CwwLedSequencePlayer::isRunning () {
 
-  return delayToStepTimer.isRunning ();
+  return playerState == PLAYER_RUNNING;
 
 }
 
@@ -1355,7 +2259,7 @@ boolean CwwLedSequencePlayer::isRunning () {
 
 boolean CwwLedSequencePlayer::isPaused () {
 
-  return delayToStepTimer.isPaused ();
+  return playerState == PLAYER_PAUSED;
 
 }
 
@@ -1363,29 +2267,129 @@ boolean CwwLedSequencePlayer::isPaused () {
 
 boolean CwwLedSequencePlayer::stepDelayIsDone () {
 
-  boolean delayIsDone;
+  if ( playerState != PLAYER_RUNNING ) return false;
+
+  // Sequence discarded while attached (see CwwLedSequence::discardAll)...
+  if ( stepIndex >= attachedSequencePtr->stepCount ) {
+    playerState = PLAYER_IDLE;
+    return false;
+  }
+
+  return CwwLedTimebase::now () - stepStartTime >= stepWaitMs;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedSequencePlayer::millisUntilStep () {
+
+  unsigned long elapsedTime;
 
-  delayIsDone = delayToStepTimer.hasElapsed() && delayToStepTimer.isRunning();
+  if ( playerState != PLAYER_RUNNING ) return UPDATE_NOT_SCHEDULED;
 
-  if ( delayIsDone && atEndOfSequence() ) delayToStepTimer.stop ();
+  // Sequence discarded while attached; stepDelayIsDone() cleans up...
+  if ( stepIndex >= attachedSequencePtr->stepCount ) return 0;
 
-  return delayIsDone;
+  elapsedTime = CwwLedTimebase::now () - stepStartTime;
+  return elapsedTime >= stepWaitMs ? 0 : stepWaitMs - elapsedTime;
 
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-boolean CwwLedSequencePlayer::atEndOfSequence () {
+boolean CwwLedSequencePlayer::stateIsValid () {
+
+  if ( playerState == PLAYER_IDLE ) return true;
 
-  return currentStepPtr->nextStepPtr == NULL;
+  return attachedSequencePtr != NULL
+      && currentIteration > 0
+      && ( stepIndex < attachedSequencePtr->stepCount || attachedSequencePtr->stepCount == 0 );
 
 }
 
 // ----------------------------------------------------------------------------
 
+void CwwLedSequencePlayer::startWait (
+  unsigned long delayMs,
+  unsigned long startTime
+) {
+
+  stepStartTime = startTime;
+  stepRemainMs  = delayMs;
+  stepWaitMs    = scaleToWait ( delayMs );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSequencePlayer::freezeWait () {
+
+  unsigned long elapsedTime;
+  unsigned long playedMs;
+
+  elapsedTime = CwwLedTimebase::now () - stepStartTime;
+
+  if ( elapsedTime >= stepWaitMs ) {
+    stepRemainMs = 0;
+  }
+  else {
+    playedMs     = scaleToDelay ( elapsedTime );
+    stepRemainMs = playedMs < stepRemainMs ? stepRemainMs - playedMs : 0;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedSequencePlayer::scaleToWait ( unsigned long delayMs ) {
+
+  // Sequence time to real time; split to avoid overflow of long delays...
+  if ( playbackRate == SEQUENCE_RATE_NORMAL ) return delayMs;
+
+  return ( delayMs / playbackRate << 8 ) + ( ( delayMs % playbackRate ) << 8 ) / playbackRate;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedSequencePlayer::scaleToDelay ( unsigned long waitMs ) {
+
+  // Real time to sequence time...
+  if ( playbackRate == SEQUENCE_RATE_NORMAL ) return waitMs;
+
+  return ( waitMs >> 8 ) * playbackRate + ( ( waitMs & 0xFF ) * playbackRate >> 8 );
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedSequencePlayer::isParamStep () {
+
+  return currentStep.kindOfStep == CwwLedSequence::STEP_KIND_PARAM;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
 cwwEnumLedMode CwwLedSequencePlayer::modeOfStep () {
 
-  return currentStepPtr->modeOfStep;
+  return (cwwEnumLedMode) currentStep.codeOfStep;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwEnumLedParam CwwLedSequencePlayer::paramOfStep () {
+
+  return (cwwEnumLedParam) currentStep.codeOfStep;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedSequencePlayer::operandOfStep () {
+
+  return currentStep.operandOfStep;
 
 }
 
@@ -24,11 +24,73 @@
 // may be any series of LED states (see cwwEnumLedMode) separated by
 // arbitrary delays.
 //
+// Each step may carry an optional operand, whose meaning depends on the
+// mode of the step:
+//
+//   LED_BLINK, LED_BLINK_MAX,    phase count (e.g. 6 for three blinks);
+//   LED_BLINK_LEVEL,             0 to continue indefinitely
+//   LED_OSCILLATE
+//   LED_STEP_DOWN, LED_STEP_UP   step amount in levels; 0 for default step
+//   LED_HOLD_LEVEL               target level to go to; 0 to hold current level
+//
+// A step with an operand (and any step up/down) is always applied, even if
+// the LED is already in the mode of the step.
+//
+// Parameter steps (see addParamStep and cwwEnumLedParam) change timing or
+// level range parameters of the controller mid-sequence. Parameter steps
+// that are due together (e.g. separated by zero delays) and the mode step
+// following them are applied in one update, with a single recomputation
+// of derived values (e.g. the level step) and a single pin update.
+//
+// Sequences built at runtime may contain redundant steps. validate()
+// reports such steps and other problems (see cwwEnumLedSequenceIssue);
+// optimize() rewrites a sequence into an equivalent one with fewer steps
+// for a target controller with or without PWM:
+//
+// - modes requiring PWM are replaced by the modes a non-PWM controller
+//   would substitute anyway (see digitalModeOf),
+// - steps repeating the previous step are removed (e.g. LED_ON following
+//   LED_ON).
+//
+// Removed steps pass their delay on to the following step, so the timing
+// of all remaining steps is unchanged. The last step of a sequence is
+// never removed, as its delay is part of the sequence duration. Only the
+// number of LED_EVENT_STEP events changes, as removed steps send none.
+//
+// A mode step immediately followed by a zero delay step setting an
+// absolute state is reported by validate() but not removed: an update
+// applies one mode step, so the step still shows for one refresh (and
+// sends its step event).
+//
+// Playback of a sequence may be paused and resumed (resumeSequence also
+// continues a sequence stopped by stopSequence, e.g. by a setMode call,
+// from where it was stopped), sped up or slowed down (setSequenceRate)
+// and reversed (setSequenceReverse). In reverse, steps are applied last
+// to first, each after the delay that precedes its successor in forward
+// order; the modes themselves are not inverted (e.g. a fade up remains a
+// fade up). A change of direction takes effect with the next step.
+//
+// Instead of its own steps, a sequence may play a constant table (see
+// useTable), e.g. one built at compile time by CwwLedSequenceBuilder and
+// placed in flash memory. Such a sequence needs no memory for its steps;
+// adding a step copies the table into memory first.
+//
 // User code needs to use instances of CwwLedSequence to create
 // sequences. A sequence may then be attached to a CwwLedController
 // instance. The CwwLedSequencePlayer class is helper code for
 // CwwLedController and not intended for user code.
 //
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+//
+// The CwwLedOutput class is the interface for output backends. By
+// default a CwwLedController drives its microcontroller pin directly.
+// Alternatively it may be bound to an output backend (e.g. a multiplexed
+// LED matrix, see CwwLedMatrix), in which case the pin argument of the
+// controller is the channel number on that backend. Backends receive
+// effective (i.e. already inverted, if so configured) 8-bit levels and
+// may defer the physical output until the end of a frame (see
+// CwwLedBank).
+//
 // ****************************************************************************
 
 #ifndef CwwLedController_h
@@ -36,10 +98,9 @@
 
 // ****************************************************************************
 
+#include <limits.h>
 #include <Arduino.h>
 
-#include <CwwElapseTimer.h>
-
 // ============================================================================
 
 enum cwwEnumLedMode {
@@ -59,7 +120,10 @@ enum cwwEnumLedMode {
   LED_FADE_UP,       // Fade the LED up until it reaches LED_HIGH (PWM) (2) (3)
   LED_FADE_REVERSE,  // Reverse the direction of the last fade (PWM) (3)
   LED_OSCILLATE,     // Oscillate the LED, repeatedly fading up, down, up, etc. (PWM) (3)
-  LED_HOLD_LEVEL     // Stop the LED at the current level
+  LED_HOLD_LEVEL,    // Stop the LED at the current level
+  LED_ENVELOPE_ON,   // Gate envelope on: attack to maximum, decay to sustain level, hold (see setEnvelope) (PWM) (3)
+  LED_ENVELOPE_OFF,  // Gate envelope off: release to LED_LOW (see setEnvelope) (PWM) (3)
+  LED_MODE_COUNT     // Not a mode: number of modes, for range checks (keep last)
 };
 // 1: Default step is derived from a) distance between minimum and
 //    maxium brightness levels, b) oscillation period, and c) refresh
@@ -71,6 +135,86 @@ enum cwwEnumLedMode {
 //    between calls should not exceed the refresh interval, although
 //    for blink mode, one call per phase is sufficient.
 
+enum cwwEnumLedEvent {
+  LED_EVENT_PHASES_DONE,   // A finite blink or oscillation completed its phases
+  LED_EVENT_STEP,          // Sequence advanced to its next step
+  LED_EVENT_ITERATION,     // Sequence started its next iteration (repeat)
+  LED_EVENT_SEQUENCE_END   // Sequence finished its last iteration
+};
+
+class CwwLedController;
+
+typedef void ( * cwwLedEventCallback ) ( CwwLedController * controllerPtr, cwwEnumLedEvent ledEvent, void * contextPtr );
+// Event callbacks are invoked once the controller has completed the call
+// in which the event occurred (e.g. updateNow), so a callback may safely
+// change the mode of the controller or start a sequence.
+
+enum cwwEnumLedParam {
+  LED_PARAM_BLINK_PERIOD,      // Blink period in ms (see setBlinkPeriod)
+  LED_PARAM_OSCILLATE_PERIOD,  // Oscillation period in ms (see setOscillatePeriod)
+  LED_PARAM_REFRESH_INTERVAL,  // Refresh interval in ms (see setRefreshInterval)
+  LED_PARAM_LEVEL_MIN,         // Minimum level (see setLevelMin)
+  LED_PARAM_LEVEL_MAX,         // Maximum level (see setLevelMax)
+  LED_PARAM_LEVEL_RANGE        // Minimum level in low byte, maximum level in high byte (see setLevelRange)
+};
+
+#define SEQUENCE_RATE_NORMAL  256  // playback rate 1.0; 8.8 fixed point (e.g. 512 for double speed)
+
+// Sequence tables (see CwwLedSequence::useTable and CwwLedSequenceBuilder)
+// consist of a header (step count, low byte first, and repeat count)
+// followed by one packed step per sequence step...
+#define SEQUENCE_TABLE_HEADER_BYTES  3
+#define SEQUENCE_TABLE_STEP_BYTES    5
+#define SEQUENCE_TABLE_PARAM_FLAG    0x80  // in kindAndCode; set for parameter steps
+#define SEQUENCE_TABLE_MAX_DELAY     0xFFFF
+
+struct cwwStructLedPackedStep {
+  uint8_t delayLow;     // timeToStepMs
+  uint8_t delayHigh;
+  uint8_t kindAndCode;  // cwwEnumLedMode, or cwwEnumLedParam | SEQUENCE_TABLE_PARAM_FLAG
+  uint8_t operandLow;
+  uint8_t operandHigh;
+};
+
+enum cwwEnumLedSequenceIssue {         // Bit flags; see CwwLedSequence::validate
+  SEQUENCE_ISSUE_NONE           = 0x00,
+  SEQUENCE_ISSUE_BAD_CODE       = 0x01,  // Unknown mode or parameter
+  SEQUENCE_ISSUE_BAD_VALUE      = 0x02,  // Operand out of range; will be clamped
+  SEQUENCE_ISSUE_NEEDS_PWM      = 0x04,  // Mode requires PWM; will be substituted
+  SEQUENCE_ISSUE_REDUNDANT_STEP = 0x08,  // Step repeats previous step
+  SEQUENCE_ISSUE_HIDDEN_STEP    = 0x10,  // Mode step overridden by following zero delay step; shows for one refresh only
+  SEQUENCE_ISSUE_ZERO_LENGTH    = 0x20   // Repeating sequence with total duration of zero
+};
+
+enum cwwEnumLedStateIssue {            // Bit flags; see CwwLedController::checkInvariants
+  STATE_ISSUE_NONE        = 0x00,
+  STATE_ISSUE_LEVEL_RANGE = 0x01,  // Minimum not below maximum, or derived level step of zero
+  STATE_ISSUE_LEVEL       = 0x02,  // Level does not match active mode
+  STATE_ISSUE_MODE        = 0x04,  // Active mode is a transient mode (e.g. toggle, step)
+  STATE_ISSUE_SCHEDULE    = 0x08,  // Update interval does not match active mode
+  STATE_ISSUE_PHASES      = 0x10,  // Phases remaining in a mode without phases
+  STATE_ISSUE_SEQUENCE    = 0x20   // Sequence player running without sequence, or past its iterations
+};
+
+#define UPDATE_NOT_SCHEDULED  ULONG_MAX  // see CwwLedController::millisUntilUpdate
+
+// ============================================================================
+
+class CwwLedOutput {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedOutput ();
+    virtual ~CwwLedOutput ();
+
+    virtual void writeLevel  ( uint8_t ledChannel, uint8_t ledLevel, boolean usePwm ) = 0;
+    virtual void beginFrame  ();  // called before a batch of writeLevel() calls
+    virtual void commitFrame ();  // called after a batch of writeLevel() calls
+
+};
+
 // ============================================================================
 
 class CwwLedSequence {
@@ -84,9 +228,18 @@ class CwwLedSequence {
              CwwLedSequence ();
     virtual ~CwwLedSequence ();
 
-    void addStep    ( unsigned long timeToStepMs, cwwEnumLedMode modeOfStep );
+    void addStep      ( unsigned long timeToStepMs, cwwEnumLedMode  modeOfStep, uint16_t operandOfStep = 0 );
+    void addParamStep ( unsigned long timeToStepMs, cwwEnumLedParam paramOfStep, uint16_t valueOfStep );
     void discardAll ( boolean forceDiscard = false );
 
+    uint8_t  validate ( boolean forPwm );  // returns cwwEnumLedSequenceIssue flags
+    uint16_t optimize ( boolean forPwm );  // returns number of steps removed; sequence must not be attached
+
+    boolean useTable ( const uint8_t * tablePtr );  // play from table (e.g. in flash); false if attached
+    boolean isTable  ();
+
+    uint16_t valueOfStepCount ();
+
     void    setRepeatCount     ( uint8_t repeatCount );
     uint8_t valueOfRepeatCount ();
 
@@ -96,15 +249,24 @@ class CwwLedSequence {
 
     // Private Types:
 
+    enum enumStepKind {
+      STEP_KIND_MODE,   // codeOfStep is a cwwEnumLedMode
+      STEP_KIND_PARAM   // codeOfStep is a cwwEnumLedParam
+    };
+
     struct structSequenceStep {
-      unsigned long        timeToStepMs;
-      cwwEnumLedMode       modeOfStep;
-      structSequenceStep * nextStepPtr;
+      unsigned long timeToStepMs;
+      uint8_t       kindOfStep;
+      uint8_t       codeOfStep;
+      uint16_t      operandOfStep;
     };
 
     // Private Variables:
 
-    structSequenceStep * startOfSequencePtr;
+    structSequenceStep * steps;     // array of stepCapacity steps, unless table is used
+    const uint8_t      * tablePtr;  // table in program memory, if used
+    uint16_t             stepCount;
+    uint16_t             stepCapacity;
     uint8_t              repeatCount;
     
     uint8_t attachCount;
@@ -114,6 +276,17 @@ class CwwLedSequence {
     void attachPlayer ();
     void detachPlayer ();
 
+    void appendStep ( unsigned long timeToStepMs, uint8_t kindOfStep, uint8_t codeOfStep, uint16_t operandOfStep );
+
+    static uint8_t issuesOfStep   ( structSequenceStep * stepPtr, boolean forPwm );
+    static boolean stepIsAbsolute ( structSequenceStep * stepPtr );
+    static boolean stepRepeats    ( structSequenceStep * prevStepPtr, structSequenceStep * stepPtr );
+    static boolean stepIsHidden   ( structSequenceStep * stepPtr, structSequenceStep * nextStepPtr );
+
+    void          readStep   ( uint16_t stepIndex, structSequenceStep * stepPtr );
+    void          copyTable  ();
+    unsigned long timeToStep ( uint16_t stepIndex, boolean playReversed );
+
 };
 
 // ----------------------------------------------------------------------------
@@ -126,19 +299,36 @@ class CwwLedSequencePlayer {
 
     // Public Functions:
 
-             CwwLedSequencePlayer ();
+             CwwLedSequencePlayer ( CwwLedController * ownerPtr = NULL );
     virtual ~CwwLedSequencePlayer ();
 
   private:
 
+    // Private Types:
+
+    enum enumPlayerState {
+      PLAYER_IDLE,     // not started, or played to its end
+      PLAYER_RUNNING,
+      PLAYER_STOPPED,  // stopped; position kept for resume()
+      PLAYER_PAUSED    // paused; position kept for resume()
+    };
+
     // Private Variables:
 
-    CwwLedSequence                     * attachedSequencePtr;
-    CwwLedSequence::structSequenceStep * currentStepPtr;
+    CwwLedController * ownerPtr;
+    CwwLedSequence   * attachedSequencePtr;
+
+    uint16_t      stepIndex;       // index of step waiting for its delay
+    CwwLedSequence::structSequenceStep currentStep;  // copy of step at stepIndex
+    unsigned long stepStartTime;   // time when waiting started or was last rebased (see CwwLedTimebase)
+    unsigned long stepWaitMs;      // ms after stepStartTime when step is due
+    unsigned long stepRemainMs;    // sequence time of delay remaining at stepStartTime
+    uint8_t       playerState;
+    uint16_t      playbackRate;    // 8.8 fixed point; see SEQUENCE_RATE_NORMAL
+    boolean       playReversed;
 
-    CwwElapseTimer       delayToStepTimer;
-    uint8_t              iterationsToPlay;
-    uint16_t             currentIteration;
+    uint8_t  iterationsToPlay;
+    uint16_t currentIteration;
 
     // Private Functions:
 
@@ -151,14 +341,29 @@ class CwwLedSequencePlayer {
     boolean startFirstStep ();
     boolean advanceOneStep ();
     void    stop           ();
+    void    pause          ();
     boolean resume         ();
 
-    boolean isRunning       ();
-    boolean isPaused        ();
-    boolean stepDelayIsDone ();
-    boolean atEndOfSequence ();
+    boolean  setRate     ( uint16_t playbackRate );
+    uint16_t valueOfRate ();
+    void     setReverse  ( boolean playReversed );
+    boolean  isReversed  ();
 
-    cwwEnumLedMode modeOfStep ();
+    boolean       isRunning       ();
+    boolean       isPaused        ();
+    boolean       stepDelayIsDone ();
+    unsigned long millisUntilStep ();
+    boolean       stateIsValid    ();
+
+    void          startWait    ( unsigned long delayMs, unsigned long startTime );
+    void          freezeWait   ();
+    unsigned long scaleToWait  ( unsigned long delayMs );
+    unsigned long scaleToDelay ( unsigned long waitMs );
+
+    boolean         isParamStep   ();
+    cwwEnumLedMode  modeOfStep    ();
+    cwwEnumLedParam paramOfStep   ();
+    uint16_t        operandOfStep ();
 
 };
 
@@ -166,6 +371,8 @@ class CwwLedSequencePlayer {
 
 class CwwLedController {
 
+  friend class CwwLedSequencePlayer;
+
   public:
 
     // Public Types:
@@ -183,6 +390,14 @@ class CwwLedController {
                                 unsigned long oscillatePeriod =  1000,  // Smooth oscillation period in ms (one period is two phases)
                                 uint16_t      refreshInterval =    20   // Interval in ms between updates of LED level (e.g. for fade and oscillate) 
                               );
+             CwwLedController ( CwwLedOutput & ledOutput,               // Output backend to drive instead of a pin
+                                uint8_t       ledChannel,               // Channel number on output backend
+                                boolean       usePwn          = false,
+                                boolean       invertSignal    = false,
+                                unsigned long blinkPeriod     =  1000,
+                                unsigned long oscillatePeriod =  1000,
+                                uint16_t      refreshInterval =    20
+                              );
     virtual ~CwwLedController ();
 
     void  turnOff     ();                             // Turn LED completely off
@@ -203,6 +418,8 @@ class CwwLedController {
     void  fadeUp      ();                             // Start LED on a fade towards is highest setting (2) (3)
     void  oscillate   ( uint16_t phaseCount = 0 );    // Oscillate the LED, repeatedly fading up, down, up, etc. (3)
     void  hold        ();                             // Stop the LED at the current level
+    void  envelopeOn  ();                             // Gate envelope on: attack, decay, then sustain (see setEnvelope) (3)
+    void  envelopeOff ();                             // Gate envelope off: release (see setEnvelope) (3)
 
     boolean isOn      ();  // true if LED is not off
     boolean isLow     ();  // true if LED is at its lowest level (see setLevelMin)
@@ -216,8 +433,16 @@ class CwwLedController {
     void    setSequenceRepeatCount ( uint8_t repeatCount ); 
     void    startSequence          ();
     void    stopSequence           ();
+    void    pauseSequence          ();
+    boolean resumeSequence         ();  // continue after pause or stop; false if nothing to resume
     uint8_t valueOfSequenceRepeatCount ();
     boolean isPlayingSequence          ();
+    boolean isSequencePaused           ();
+
+    boolean  setSequenceRate     ( uint16_t playbackRate );  // 8.8 fixed point; SEQUENCE_RATE_NORMAL is 1.0
+    uint16_t valueOfSequenceRate ();
+    void     setSequenceReverse  ( boolean playReversed );
+    boolean  isSequenceReversed  ();
 
     boolean  setLevel     ( uint8_t ledLevelNew );  // Force LED level to specified value
     uint8_t  currentLevel ();
@@ -236,8 +461,24 @@ class CwwLedController {
     boolean  setRefreshInterval     ( uint16_t newInterval );  // interval in ms
     uint16_t valueOfRefreshInterval ();
 
-    boolean updateIsDue ();  // if true, updateNow() needs to be called
-    boolean updateNow   ();  // prior test of updateIsDue() is not required; will only update if due 
+    boolean setEnvelope ( uint16_t attackMs, uint16_t decayMs, uint8_t sustainLevel, uint16_t releaseMs );
+    // Attack time is for the full range from minimum to maximum level,
+    // decay time from maximum to sustain level, and release time from
+    // sustain to minimum level (full range if sustain is the minimum).
+    // Times are rounded to whole refresh intervals. Sustain level is
+    // clamped to the level range; false if clamped. Defaults: 0 ms
+    // attack, 0 ms decay, sustain at 255, 500 ms release.
+
+    static cwwEnumLedMode digitalModeOf ( cwwEnumLedMode ledMode );
+    // Mode substituted for ledMode on a controller without PWM. Modes
+    // whose substitute depends on the state of the controller (LED_TOGGLE,
+    // LED_BLINK, LED_HOLD_LEVEL) are returned unchanged.
+
+    boolean       updateIsDue       ();  // if true, updateNow() needs to be called
+    boolean       updateNow         ();  // prior test of updateIsDue() is not required; will only update if due 
+    unsigned long millisUntilUpdate ();  // 0 if due; UPDATE_NOT_SCHEDULED if nothing is pending
+
+    uint8_t checkInvariants ();  // returns cwwEnumLedStateIssue flags; for tests
 
     boolean setLevelMin   ( uint8_t levelMinNew );  // pwm level in range of 0 to 254
     boolean setLevelMax   ( uint8_t levelMaxNew );  // pwm level in range of 1 to 255
@@ -252,11 +493,15 @@ class CwwLedController {
     void    setInvert  ( boolean invertNew );
     boolean isInverted ();
 
+    void setEventCallback ( cwwLedEventCallback callback, void * contextPtr = NULL );  // NULL callback to disable
+
   private:
 
     // Private Variables:
 
-    uint8_t ledPin;
+    CwwLedOutput * ledOutputPtr;  // NULL if driving ledPin directly
+
+    uint8_t ledPin;  // pin number, or channel number on ledOutputPtr
     boolean usePwm;
     boolean invertSignal;
 
@@ -276,29 +521,59 @@ class CwwLedController {
     unsigned long oscillatePeriod;
     uint16_t      remainingPhases;
 
+    uint16_t envelopeAttackMs;
+    uint16_t envelopeDecayMs;
+    uint16_t envelopeReleaseMs;
+    uint8_t  envelopeSustainLevel;  // as set; see envelopeSustain for level in range
+    uint16_t envelopeSustain;       // derived, like the steps below
+    uint16_t envelopeAttackStep;    // level change per refresh interval
+    uint16_t envelopeDecayStep;
+    uint16_t envelopeReleaseStep;
+    boolean  envelopeInDecay;       // attack done; decaying towards sustain level
+
     unsigned long updateInterval;
     unsigned long lastDriveTime;
 
+    boolean derivedIsStale;  // level mid and step need recomputation
+
     CwwLedSequencePlayer * sequencePlayerPtr;
 
+    cwwLedEventCallback eventCallback;
+    void              * eventContextPtr;
+    uint8_t             eventsPending;  // bit per cwwEnumLedEvent
+
     // Private Functions:
 
+    void initialize ( boolean usePwm, boolean invertSignal, unsigned long blinkPeriod, unsigned long oscillatePeriod, uint16_t refreshInterval );
+
     void setMode ( cwwEnumLedMode ledModeNew, uint16_t phaseCount, uint16_t stepAmount, boolean forceSet );
 
+    void    applyStep      ( cwwEnumLedMode modeOfStep, uint16_t operandOfStep );
+    void    applyParamStep ( cwwEnumLedParam paramOfStep, uint16_t valueOfStep );
+    boolean applyLevel     ( uint16_t levelNew );
+    void    refreshDerived ();
+
     cwwEnumLedMode adjustMode   ( cwwEnumLedMode ledModeNew );
     void           computeState ( cwwEnumLedMode ledModeNew, uint16_t phaseCount = 0, uint16_t stepAmount = 0 );
 
-    boolean calcLevelStep  ();
+    boolean  calcLevelStep     ();
+    void     calcEnvelopeSteps ();
+    uint16_t calcSegmentStep   ( uint16_t levelDistance, uint16_t segmentMs );
     void    decrementLevel ();
     void    decrementLevel ( uint16_t delta );
     void    incrementLevel ();
     void    incrementLevel ( uint16_t delta );
  
+    boolean changeLevelRange  ( uint16_t levelMinNew, uint16_t levelMaxNew );
     void    calcLevelMid      ();
     boolean levelIsNearMax    ();
     boolean levelIsNearAbsMax ();
 
-    void drivePin ( boolean markDriveTime = true );
+    boolean refreshIsDue ();
+    void    drivePin     ( boolean markDriveTime = true );
+
+    void queueEvent     ( cwwEnumLedEvent ledEvent );
+    void dispatchEvents ();
 
 };
 
@@ -0,0 +1,288 @@
+// ****************************************************************************
+//
+// LED Cue List Class
+// ------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedCueList, a theatre style cue list with
+// tracking cues, split fade times and follow cues on a bank.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedCueList.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define CUE_MAX_CUES  254  // LED_CUE_NONE is not an index
+
+// ****************************************************************************
+// LED Cue List Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedCueList::CwwLedCueList (
+  CwwLedBank & bank,
+  uint8_t      cueCapacity
+) {
+
+  if ( cueCapacity > CUE_MAX_CUES ) cueCapacity = CUE_MAX_CUES;
+
+  this->scenesPtr = new CwwLedScenes ( bank, cueCapacity );
+
+  this->cues        = new structCue [ cueCapacity ];
+  this->cueCapacity = cueCapacity;
+  this->cueCount    = 0;
+  this->currentCue  = LED_CUE_NONE;
+  this->loopList    = false;
+  this->backMs      = 1000;
+
+  this->followIsArmed = false;
+  this->cueStartTime  = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedCueList::~CwwLedCueList () {
+
+  delete scenesPtr;
+  delete [] cues;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+uint8_t CwwLedCueList::addCue (
+  const cwwStructLedSceneEntry * entries,
+  uint16_t                       entryCount,
+  uint16_t                       fadeInMs,
+  uint16_t                       fadeOutMs,
+  uint16_t                       followMs
+) {
+
+  uint8_t sceneIndex;
+
+  if ( cueCount >= cueCapacity ) return LED_CUE_NONE;
+
+  // Each cue tracks from the one before...
+  sceneIndex = scenesPtr->addScene ( entries, entryCount, cueCount > 0 ? cueCount - 1 : LED_SCENE_NONE );
+  if ( sceneIndex == LED_SCENE_NONE ) return LED_CUE_NONE;
+
+  cues[cueCount].fadeInMs  = fadeInMs;
+  cues[cueCount].fadeOutMs = fadeOutMs;
+  cues[cueCount].followMs  = followMs;
+
+  return cueCount++;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedCueList::go () {
+
+  uint8_t cueIndex;
+
+  if ( cueCount == 0 ) return false;
+
+  if      ( currentCue == LED_CUE_NONE ) cueIndex = 0;
+  else if ( currentCue + 1 < cueCount  ) cueIndex = currentCue + 1;
+  else if ( loopList                   ) cueIndex = 0;
+  else                                   return false;
+
+  startCue ( cueIndex, cues[cueIndex].fadeInMs, cues[cueIndex].fadeOutMs, true );
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedCueList::back () {
+
+  if ( currentCue == LED_CUE_NONE || currentCue == 0 ) return false;
+
+  // Going back does not follow on...
+  startCue ( currentCue - 1, backMs, backMs, false );
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedCueList::goTo ( uint8_t cueIndex ) {
+
+  if ( cueIndex >= cueCount ) return false;
+
+  startCue ( cueIndex, cues[cueIndex].fadeInMs, cues[cueIndex].fadeOutMs, true );
+
+  return true;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint8_t CwwLedCueList::valueOfCue () {
+
+  return currentCue;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedCueList::valueOfCueCount () {
+
+  return cueCount;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedCueList::setLoop ( boolean loopList ) {
+
+  this->loopList = loopList;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedCueList::isLooping () {
+
+  return loopList;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedCueList::setBackTime ( uint16_t backMs ) {
+
+  this->backMs = backMs;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedCueList::valueOfBackTime () {
+
+  return backMs;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedCueList::isFading () {
+
+  return scenesPtr->isFading ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedCueList::isFollowing () {
+
+  return followIsArmed;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedCueList::updateIsDue () {
+
+  return ( followIsArmed && CwwLedTimebase::now () - cueStartTime >= cues[currentCue].followMs )
+      || scenesPtr->updateIsDue ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedCueList::updateNow () {
+
+  boolean       didUpdate;
+  uint8_t       followCount;
+  unsigned long followTime;
+
+  didUpdate = false;
+
+  // A followed cue starts when the follow was due, even if this call
+  // comes late (e.g. from a busy loop), so that chains of follow cues keep
+  // their timing. Follows due together (e.g. zero follow times) are taken
+  // in one call, but at most once around the list...
+  for ( followCount = 0; followCount < cueCount; followCount++ ) {
+    if ( ! followIsArmed || CwwLedTimebase::now () - cueStartTime < cues[currentCue].followMs ) break;
+    followTime    = cueStartTime + cues[currentCue].followMs;
+    followIsArmed = false;
+    if ( go () ) cueStartTime = followTime;
+    didUpdate = true;
+  }
+
+  if ( scenesPtr->updateNow () ) didUpdate = true;
+
+  return didUpdate;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedCueList::millisUntilUpdate () {
+
+  unsigned long untilUpdate;
+  unsigned long elapsedTime;
+
+  untilUpdate = scenesPtr->millisUntilUpdate ();
+
+  if ( followIsArmed ) {
+    elapsedTime = CwwLedTimebase::now () - cueStartTime;
+    if ( elapsedTime >= cues[currentCue].followMs ) return 0;
+    if ( cues[currentCue].followMs - elapsedTime < untilUpdate ) untilUpdate = cues[currentCue].followMs - elapsedTime;
+  }
+
+  return untilUpdate;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedCueList::setRefreshInterval ( uint16_t newInterval ) {
+
+  return scenesPtr->setRefreshInterval ( newInterval );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedCueList::valueOfRefreshInterval () {
+
+  return scenesPtr->valueOfRefreshInterval ();
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedCueList::startCue (
+  uint8_t  cueIndex,
+  uint16_t fadeInMs,
+  uint16_t fadeOutMs,
+  boolean  armFollow
+) {
+
+  cueStartTime = CwwLedTimebase::now ();
+
+  scenesPtr->recall ( cueIndex, fadeInMs, fadeOutMs );
+
+  currentCue    = cueIndex;
+  followIsArmed = armFollow && cues[cueIndex].followMs != LED_CUE_NO_FOLLOW;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,130 @@
+// ****************************************************************************
+//
+// LED Cue List Class
+// ------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedCueList class runs the channels of a CwwLedBank through a list
+// of cues, as a theatre lighting desk does: go() moves on to the next cue,
+// back() returns to the previous one, goTo() jumps to any cue.
+//
+// Cues track: a cue lists only the channels it changes (see
+// cwwStructLedSceneEntry), and all other channels keep what earlier cues
+// gave them. The first cue should thus set every channel the list uses
+// (e.g. all off). Each cue has its own fade times, one for levels that
+// rise (fade in) and one for levels that fall (fade out); modes change at
+// once. A cue may follow automatically, a given time after it started:
+//
+//   list.addCue ( preset,  presetCount );                     // manual
+//   list.addCue ( doorsUp, doorsUpCount, 3000, 1000, 5000 );  // 3 s in, 1 s out, next cue after 5 s
+//   list.addCue ( spots,   spotsCount,   2000, 2000 );
+//   ...
+//   list.go ();
+//
+// With setLoop(), the list continues from its first cue after its last,
+// e.g. for an exhibit running unattended on follow cues.
+//
+// Cues are recalled as scenes based on each other (see CwwLedScenes):
+// each transition is computed once, at the moment of the go, from the
+// delta lists between the two cues, and only the channels that change get
+// an entry in the fade table. The fades of all channels are then ticked
+// together, in one pass over the fade table per refresh (see updateNow).
+// Neither timing nor memory grows with the number of LEDs that do not
+// change; a cue takes a few bytes besides its (constant) entries.
+//
+// ****************************************************************************
+
+#ifndef CwwLedCueList_h
+#define CwwLedCueList_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedBank.h>
+#include <CwwLedScenes.h>
+
+// ============================================================================
+
+#define LED_CUE_NONE       0xFF    // no cue; see addCue, valueOfCue
+#define LED_CUE_NO_FOLLOW  0xFFFF  // cue waits for go(); see addCue
+
+// ============================================================================
+
+class CwwLedCueList {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedCueList ( CwwLedBank & bank,             // Bank to drive
+                             uint8_t      cueCapacity = 16  // Maximum number of cues; at most 254
+                           );
+    virtual ~CwwLedCueList ();
+
+    uint8_t addCue ( const cwwStructLedSceneEntry * entries,              // Channels the cue changes, sorted by channel
+                     uint16_t                       entryCount,
+                     uint16_t                       fadeInMs  = 0,        // Fade time of rising levels
+                     uint16_t                       fadeOutMs = 0,        // Fade time of falling levels
+                     uint16_t                       followMs  = LED_CUE_NO_FOLLOW  // Time from start of cue to go of next cue
+                   );
+    // Returns the index of the new cue; LED_CUE_NONE if the list is full or
+    // the entries are invalid (see CwwLedScenes::addScene).
+
+    boolean go   ();                     // next cue, with its fade times; false at the end of the list
+    boolean back ();                     // previous cue, with the back time; false at the first cue
+    boolean goTo ( uint8_t cueIndex );   // any cue, with its fade times; false if no such cue
+
+    uint8_t valueOfCue      ();  // current cue; LED_CUE_NONE until the first go
+    uint8_t valueOfCueCount ();
+
+    void     setLoop         ( boolean loopList );  // go() after the last cue continues with the first
+    boolean  isLooping       ();
+    void     setBackTime     ( uint16_t backMs );   // fade time of back(); default 1000 ms
+    uint16_t valueOfBackTime ();
+
+    boolean       isFading          ();
+    boolean       isFollowing       ();  // true if a follow is pending
+    boolean       updateIsDue       ();  // true if a fade needs a refresh or a follow is due
+    boolean       updateNow         ();  // go on follow, refresh fades; true if anything was done
+    unsigned long millisUntilUpdate ();  // 0 if due; UPDATE_NOT_SCHEDULED if neither fading nor following
+
+    boolean  setRefreshInterval     ( uint16_t newInterval );  // interval in ms between fade refreshes; default 20
+    uint16_t valueOfRefreshInterval ();
+
+  private:
+
+    // Private Types:
+
+    struct structCue {
+      uint16_t fadeInMs;
+      uint16_t fadeOutMs;
+      uint16_t followMs;
+    };
+
+    // Private Variables:
+
+    CwwLedScenes * scenesPtr;  // one scene per cue, each based on the one before
+
+    structCue   * cues;
+    uint8_t       cueCapacity;
+    uint8_t       cueCount;
+    uint8_t       currentCue;
+    boolean       loopList;
+    uint16_t      backMs;
+
+    boolean       followIsArmed;
+    unsigned long cueStartTime;
+
+    // Private Functions:
+
+    void startCue ( uint8_t cueIndex, uint16_t fadeInMs, uint16_t fadeOutMs, boolean armFollow );
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
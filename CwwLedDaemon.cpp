@@ -0,0 +1,527 @@
+// ****************************************************************************
+//
+// LED Daemon and LED Daemon Client Classes
+// ----------------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements classes CwwLedDaemon and CwwLedDaemonClient, which
+// share the LEDs of one bank between processes via a shared memory
+// command ring and state mirror.
+//
+// The command ring is a bounded multi-producer, single-consumer queue:
+// each slot carries a sequence number telling whether it is free for the
+// producer claiming position pos (sequence == pos) or holds a command
+// ready for the consumer (sequence == pos + 1). Producers claim positions
+// with a compare-and-swap on the ring head; the daemon is the only
+// consumer and advances the ring tail without atomic read-modify-write.
+//
+// The state mirror is protected by a sequence lock: the daemon makes the
+// mirror sequence odd while updating, and readers retry if the sequence
+// was odd or changed while they read.
+//
+// A daemon holds an exclusive flock() on a lock object next to the shared
+// memory object (see CWW_LED_DAEMON_LOCK_SUFFIX) from before it creates
+// the object until after it removes it. A daemon starting up removes an
+// existing object only once it holds the lock, i.e. when no other daemon
+// is running or still setting up its object, so that a second daemon
+// cannot pull the shared memory from under a live one and its clients.
+// The lock is released by the kernel when its holder dies, and the lock
+// object itself is never removed, as removing it would let two daemons
+// lock two different objects of the same name.
+//
+// ****************************************************************************
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stddef.h>
+
+#include <Arduino.h>
+
+#include <CwwLedDaemon.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define DAEMON_SHM_MAGIC   0x43574C44UL  // "CWLD"
+#define DAEMON_RING_MASK   ( CWW_LED_DAEMON_RING_SIZE - 1 )
+#define DAEMON_CACHE_LINE  64
+
+// ============================================================================
+// Shared Memory Layout:
+// ============================================================================
+
+struct cwwStructLedDaemonSlot {
+  uint32_t            sequence;
+  cwwStructLedCommand command;
+};
+
+struct cwwStructLedDaemonState {
+  uint8_t mode;
+  uint8_t level;
+};
+
+struct cwwStructLedDaemonShm {
+  uint32_t magic;           // set last by daemon, once shared memory is ready
+  int32_t  ownerPid;        // process id of daemon; for diagnostics
+  uint16_t channelCount;
+  uint16_t ringSize;
+  uint32_t droppedCount;
+  alignas ( DAEMON_CACHE_LINE ) uint32_t ringHead;        // next position to claim; clients
+  alignas ( DAEMON_CACHE_LINE ) uint32_t ringTail;        // next position to drain; daemon
+  alignas ( DAEMON_CACHE_LINE ) uint32_t mirrorSequence;  // odd while mirror is updated
+  cwwStructLedDaemonSlot  ring[CWW_LED_DAEMON_RING_SIZE];
+  cwwStructLedDaemonState mirror[1];                      // channelCount entries
+};
+
+// ============================================================================
+// Private Functions (file scope)
+// ============================================================================
+
+static size_t daemonShmSize ( uint16_t channelCount ) {
+
+  if ( channelCount == 0 ) channelCount = 1;
+
+  return offsetof ( cwwStructLedDaemonShm, mirror )
+       + channelCount * sizeof ( cwwStructLedDaemonState );
+
+}
+
+// ----------------------------------------------------------------------------
+
+static int daemonLock ( const char * shmName ) {
+
+  char lockName[NAME_MAX + 1];
+  int  fd;
+
+  if ( snprintf ( lockName, sizeof lockName, "%s" CWW_LED_DAEMON_LOCK_SUFFIX, shmName ) >= (int) sizeof lockName ) return -1;
+
+  fd = shm_open ( lockName, O_CREAT | O_RDWR, 0660 );
+  if ( fd < 0 ) return -1;
+
+  // Held by a running daemon, or by one still setting up its object...
+  if ( flock ( fd, LOCK_EX | LOCK_NB ) != 0 ) {
+    close ( fd );
+    return -1;
+  }
+
+  return fd;
+
+}
+
+// ****************************************************************************
+// LED Daemon Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedDaemon::CwwLedDaemon (
+  CwwLedBank & bank,
+  const char * shmName
+) {
+
+  this->bankPtr = &bank;
+  this->shmName = shmName;
+  this->shmPtr  = NULL;
+  this->shmSize = 0;
+  this->lockFd  = -1;
+
+  appliedCount = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedDaemon::~CwwLedDaemon () {
+
+  end ();
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+boolean CwwLedDaemon::begin () {
+
+  int      fd;
+  void   * mapPtr;
+  uint16_t channelCount;
+  uint32_t position;
+
+  if ( shmPtr != NULL ) return true;
+
+  channelCount = bankPtr->valueOfChannelCount ();
+  shmSize = daemonShmSize ( channelCount );
+
+  // With the lock held, an existing object is a stale one left behind by
+  // a daemon that did not exit cleanly; it is removed, so that clients
+  // never attach to an outdated layout...
+  lockFd = daemonLock ( shmName );
+  if ( lockFd < 0 ) return false;
+  shm_unlink ( shmName );
+
+  fd = shm_open ( shmName, O_CREAT | O_EXCL | O_RDWR, 0660 );
+  if ( fd < 0 ) {
+    unlock ();
+    return false;
+  }
+
+  if ( ftruncate ( fd, shmSize ) != 0 ) {
+    close ( fd );
+    shm_unlink ( shmName );
+    unlock ();
+    return false;
+  }
+
+  mapPtr = mmap ( NULL, shmSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  close ( fd );
+  if ( mapPtr == MAP_FAILED ) {
+    shm_unlink ( shmName );
+    unlock ();
+    return false;
+  }
+
+  shmPtr = (cwwStructLedDaemonShm *) mapPtr;
+  __atomic_store_n ( &shmPtr->ownerPid, (int32_t) getpid (), __ATOMIC_RELEASE );
+  shmPtr->channelCount   = channelCount;
+  shmPtr->ringSize       = CWW_LED_DAEMON_RING_SIZE;
+  shmPtr->droppedCount   = 0;
+  shmPtr->ringHead       = 0;
+  shmPtr->ringTail       = 0;
+  shmPtr->mirrorSequence = 0;
+  for ( position = 0; position < CWW_LED_DAEMON_RING_SIZE; position++ ) {
+    shmPtr->ring[position].sequence = position;
+  }
+
+  updateMirror ();
+
+  __atomic_store_n ( &shmPtr->magic, DAEMON_SHM_MAGIC, __ATOMIC_RELEASE );
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedDaemon::end () {
+
+  if ( shmPtr == NULL ) return;
+
+  __atomic_store_n ( &shmPtr->magic, 0, __ATOMIC_RELEASE );
+  munmap ( shmPtr, shmSize );
+  shm_unlink ( shmName );
+  shmPtr = NULL;
+
+  unlock ();  // only once the object is gone
+
+}
+
+// ============================================================================
+
+boolean CwwLedDaemon::serviceNow () {
+
+  uint16_t commandCount;
+  boolean  anyUpdated;
+
+  if ( shmPtr == NULL ) return false;
+
+  // Apply commands and refresh as one frame, so that the output backend
+  // sees every channel change of this refresh together...
+  bankPtr->beginFrame ();
+  commandCount = drainCommands ();
+  appliedCount += bankPtr->applyCommands ( commandBatch, commandCount );
+  anyUpdated = bankPtr->updateNow ();
+  bankPtr->commitFrame ();
+
+  updateMirror ();
+
+  return commandCount > 0 || anyUpdated;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint32_t CwwLedDaemon::valueOfAppliedCount () {
+
+  return appliedCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint32_t CwwLedDaemon::valueOfDroppedCount () {
+
+  if ( shmPtr == NULL ) return 0;
+
+  return __atomic_load_n ( &shmPtr->droppedCount, __ATOMIC_RELAXED );
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+uint16_t CwwLedDaemon::drainCommands () {
+
+  cwwStructLedDaemonSlot * slotPtr;
+  uint32_t                 position;
+  uint16_t                 commandCount;
+
+  position     = shmPtr->ringTail;
+  commandCount = 0;
+
+  while ( commandCount < CWW_LED_DAEMON_RING_SIZE ) {
+    slotPtr = &shmPtr->ring[position & DAEMON_RING_MASK];
+    if ( __atomic_load_n ( &slotPtr->sequence, __ATOMIC_ACQUIRE ) != position + 1 ) break;
+    commandBatch[commandCount++] = slotPtr->command;
+    __atomic_store_n ( &slotPtr->sequence, position + CWW_LED_DAEMON_RING_SIZE, __ATOMIC_RELEASE );
+    position++;
+  }
+
+  shmPtr->ringTail = position;
+
+  return commandCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedDaemon::updateMirror () {
+
+  CwwLedController        * controllerPtr;
+  cwwStructLedDaemonState * statePtr;
+  uint16_t                  channelIndex;
+  uint32_t                  sequence;
+
+  sequence = shmPtr->mirrorSequence;
+  __atomic_store_n ( &shmPtr->mirrorSequence, sequence + 1, __ATOMIC_RELAXED );
+  __atomic_thread_fence ( __ATOMIC_RELEASE );
+
+  for ( channelIndex = 0; channelIndex < shmPtr->channelCount; channelIndex++ ) {
+    controllerPtr = bankPtr->channel ( channelIndex );
+    statePtr = &shmPtr->mirror[channelIndex];
+    __atomic_store_n ( &statePtr->mode,  (uint8_t) controllerPtr->currentMode  (), __ATOMIC_RELAXED );
+    __atomic_store_n ( &statePtr->level,           controllerPtr->currentLevel (), __ATOMIC_RELAXED );
+  }
+
+  __atomic_store_n ( &shmPtr->mirrorSequence, sequence + 2, __ATOMIC_RELEASE );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedDaemon::unlock () {
+
+  if ( lockFd < 0 ) return;
+
+  close ( lockFd );  // releases the flock
+  lockFd = -1;
+
+}
+
+// ****************************************************************************
+// LED Daemon Client Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedDaemonClient::CwwLedDaemonClient () {
+
+  shmPtr  = NULL;
+  shmSize = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedDaemonClient::~CwwLedDaemonClient () {
+
+  detach ();
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+boolean CwwLedDaemonClient::attach ( const char * shmName ) {
+
+  int           fd;
+  struct stat   shmStat;
+  void        * mapPtr;
+
+  detach ();
+
+  fd = shm_open ( shmName, O_RDWR, 0 );
+  if ( fd < 0 ) return false;
+
+  if ( fstat ( fd, &shmStat ) != 0 || (size_t) shmStat.st_size < daemonShmSize ( 0 ) ) {
+    close ( fd );
+    return false;
+  }
+
+  mapPtr = mmap ( NULL, shmStat.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  close ( fd );
+  if ( mapPtr == MAP_FAILED ) return false;
+
+  shmPtr  = (cwwStructLedDaemonShm *) mapPtr;
+  shmSize = shmStat.st_size;
+
+  if ( __atomic_load_n ( &shmPtr->magic, __ATOMIC_ACQUIRE ) != DAEMON_SHM_MAGIC
+    || shmPtr->ringSize != CWW_LED_DAEMON_RING_SIZE
+    || daemonShmSize ( shmPtr->channelCount ) > shmSize ) {
+    detach ();
+    return false;
+  }
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedDaemonClient::detach () {
+
+  if ( shmPtr != NULL ) munmap ( shmPtr, shmSize );
+
+  shmPtr  = NULL;
+  shmSize = 0;
+
+}
+
+// ============================================================================
+
+boolean CwwLedDaemonClient::postCommand ( const cwwStructLedCommand & command ) {
+
+  cwwStructLedDaemonSlot * slotPtr;
+  uint32_t                 position;
+  uint32_t                 sequence;
+  int32_t                  difference;
+
+  if ( shmPtr == NULL ) return false;
+
+  position = __atomic_load_n ( &shmPtr->ringHead, __ATOMIC_RELAXED );
+
+  for ( ;; ) {
+    slotPtr    = &shmPtr->ring[position & DAEMON_RING_MASK];
+    sequence   = __atomic_load_n ( &slotPtr->sequence, __ATOMIC_ACQUIRE );
+    difference = (int32_t) ( sequence - position );
+    if ( difference == 0 ) {
+      // Slot is free; claim it (on failure, position is reloaded)...
+      if ( __atomic_compare_exchange_n ( &shmPtr->ringHead, &position, position + 1, true,
+                                         __ATOMIC_RELAXED, __ATOMIC_RELAXED ) ) break;
+    }
+    else if ( difference < 0 ) {
+      // Slot still holds a command not drained yet; ring is full...
+      __atomic_fetch_add ( &shmPtr->droppedCount, 1, __ATOMIC_RELAXED );
+      return false;
+    }
+    else {
+      position = __atomic_load_n ( &shmPtr->ringHead, __ATOMIC_RELAXED );
+    }
+  }
+
+  slotPtr->command = command;
+  __atomic_store_n ( &slotPtr->sequence, position + 1, __ATOMIC_RELEASE );
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedDaemonClient::setMode (
+  uint16_t       channel,
+  cwwEnumLedMode mode,
+  uint16_t       phaseCount,
+  uint8_t        stepAmount
+) {
+
+  cwwStructLedCommand command;
+
+  command.channel    = channel;
+  command.command    = LED_COMMAND_MODE;
+  command.mode       = mode;
+  command.phaseCount = phaseCount;
+  command.stepAmount = stepAmount;
+  command.level      = 0;
+
+  return postCommand ( command );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedDaemonClient::setLevel ( uint16_t channel, uint8_t level ) {
+
+  cwwStructLedCommand command;
+
+  command.channel    = channel;
+  command.command    = LED_COMMAND_LEVEL;
+  command.mode       = 0;
+  command.phaseCount = 0;
+  command.stepAmount = 0;
+  command.level      = level;
+
+  return postCommand ( command );
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedDaemonClient::readState (
+  uint16_t         channel,
+  cwwEnumLedMode * modePtr,
+  uint8_t        * levelPtr
+) {
+
+  cwwStructLedDaemonState * statePtr;
+  uint32_t                  sequenceBefore;
+  uint32_t                  sequenceAfter;
+  uint8_t                   mode;
+  uint8_t                   level;
+
+  if ( shmPtr == NULL || channel >= shmPtr->channelCount ) return false;
+
+  statePtr = &shmPtr->mirror[channel];
+
+  do {
+    sequenceBefore = __atomic_load_n ( &shmPtr->mirrorSequence, __ATOMIC_ACQUIRE );
+    mode  = __atomic_load_n ( &statePtr->mode,  __ATOMIC_RELAXED );
+    level = __atomic_load_n ( &statePtr->level, __ATOMIC_RELAXED );
+    __atomic_thread_fence ( __ATOMIC_ACQUIRE );
+    sequenceAfter = __atomic_load_n ( &shmPtr->mirrorSequence, __ATOMIC_RELAXED );
+  } while ( ( sequenceBefore & 1 ) || sequenceBefore != sequenceAfter );
+
+  if ( modePtr  != NULL ) *modePtr  = (cwwEnumLedMode) mode;
+  if ( levelPtr != NULL ) *levelPtr = level;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedDaemonClient::valueOfChannelCount () {
+
+  return shmPtr != NULL ? shmPtr->channelCount : 0;
+
+}
+
+// ****************************************************************************
+
+#endif  // __linux__
+
+// ****************************************************************************
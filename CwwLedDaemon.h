@@ -0,0 +1,127 @@
+// ****************************************************************************
+//
+// LED Daemon and LED Daemon Client Classes
+// ----------------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedDaemon class lets several processes on a Linux host share the
+// LEDs of one CwwLedBank. The daemon process owns the bank (and thus all
+// controllers) and creates a POSIX shared memory object containing:
+//
+// - a lock-free command ring, to which any number of client processes
+//   append commands (see cwwStructLedCommand), and
+// - a state mirror holding the current mode and level of every channel.
+//
+// Clients (see CwwLedDaemonClient) attach to the shared memory object by
+// name; posting a command or reading the state mirror is plain memory
+// access without any system call. The daemon drains the ring once per
+// refresh (see serviceNow), applying all pending commands and the regular
+// refresh as one frame, and then updates the state mirror.
+//
+// Only one daemon runs per shared memory object name: while it runs, a
+// daemon holds a lock on a second object named after the first (see
+// CWW_LED_DAEMON_LOCK_SUFFIX), which is left in place when it ends.
+//
+// Both classes are only available when building for Linux.
+//
+// ****************************************************************************
+
+#ifndef CwwLedDaemon_h
+#define CwwLedDaemon_h
+
+#if defined(__linux__)
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+
+// ============================================================================
+
+#define CWW_LED_DAEMON_RING_SIZE    256      // commands; must be a power of two
+#define CWW_LED_DAEMON_LOCK_SUFFIX  ".lock"  // appended to shmName for the lock object of the daemon
+
+struct cwwStructLedDaemonShm;  // shared memory layout; private to implementation
+
+// ============================================================================
+
+class CwwLedDaemon {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedDaemon ( CwwLedBank & bank,        // Bank owning all controllers
+                            const char * shmName      // Name of shared memory object, e.g. "/cwwled"
+                          );
+    virtual ~CwwLedDaemon ();
+
+    boolean begin ();  // lock, create shared memory object; false on failure or if another daemon holds the lock
+    void    end   ();  // unmap and remove shared memory object, unlock
+
+    boolean serviceNow ();  // apply pending commands, refresh bank, update mirror; true if anything changed
+
+    uint32_t valueOfAppliedCount ();  // total number of commands applied
+    uint32_t valueOfDroppedCount ();  // total number of commands clients failed to post (ring full)
+
+  private:
+
+    // Private Variables:
+
+    CwwLedBank            * bankPtr;
+    const char            * shmName;
+    cwwStructLedDaemonShm * shmPtr;
+    size_t                  shmSize;
+    int                     lockFd;   // flock()ed while the daemon runs; -1 if none
+
+    cwwStructLedCommand commandBatch[CWW_LED_DAEMON_RING_SIZE];
+    uint32_t            appliedCount;
+
+    // Private Functions:
+
+    uint16_t drainCommands ();
+    void     updateMirror  ();
+    void     unlock        ();
+
+};
+
+// ----------------------------------------------------------------------------
+
+class CwwLedDaemonClient {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedDaemonClient ();
+    virtual ~CwwLedDaemonClient ();
+
+    boolean attach ( const char * shmName );  // false if daemon is not running
+    void    detach ();
+
+    boolean postCommand ( const cwwStructLedCommand & command );  // false if ring is full
+    boolean setMode     ( uint16_t channel, cwwEnumLedMode mode, uint16_t phaseCount = 0, uint8_t stepAmount = 0 );
+    boolean setLevel    ( uint16_t channel, uint8_t level );
+
+    boolean readState ( uint16_t channel, cwwEnumLedMode * modePtr, uint8_t * levelPtr );
+
+    uint16_t valueOfChannelCount ();
+
+  private:
+
+    // Private Variables:
+
+    cwwStructLedDaemonShm * shmPtr;
+    size_t                  shmSize;
+
+};
+
+// ****************************************************************************
+
+#endif  // __linux__
+
+#endif
+
+// ****************************************************************************
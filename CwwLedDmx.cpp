@@ -0,0 +1,512 @@
+// ****************************************************************************
+//
+// LED DMX Receiver and DMX Port Classes
+// -------------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedDmx, which receives DMX512 frames into
+// double buffers from a UART interrupt and applies changed slots to the
+// channels of a bank, and class CwwLedDmxPort, which feeds it from a
+// serial device on Linux.
+//
+// ****************************************************************************
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#endif
+
+#include <Arduino.h>
+
+#include <CwwLedDmx.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define DMX_START_CODE_DIMMER  0x00
+#define DMX_MODE_WIDTH         10  // slot values per mode of LED_DMX_MODE slots
+
+#define DMX_MARK_NONE   0  // parity marking: no sequence in progress
+#define DMX_MARK_ESCAPE 1  // 0xFF seen
+#define DMX_MARK_ERROR  2  // 0xFF 0x00 seen
+
+// ****************************************************************************
+// LED DMX Receiver Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedDmx::CwwLedDmx (
+  CwwLedBank & bank,
+  uint16_t     startAddress,
+  uint16_t     slotCount
+) {
+
+  uint16_t slotIndex;
+
+  if ( slotCount == 0                  ) slotCount = bank.valueOfChannelCapacity ();
+  if ( slotCount == 0                  ) slotCount = 1;
+  if ( slotCount >  CWW_LED_DMX_SLOTS  ) slotCount = CWW_LED_DMX_SLOTS;
+
+  this->bankPtr   = &bank;
+  this->slotCount = slotCount;
+  this->slotKinds = new uint8_t [ slotCount ];
+  this->buffers   = new uint8_t [ 3 * slotCount ];
+
+  for ( slotIndex = 0; slotIndex < slotCount; slotIndex++ ) slotKinds[slotIndex] = LED_DMX_LEVEL;
+  memset ( buffers, 0, 3 * slotCount );
+
+  this->fillIndex      = 0;
+  this->waitingIndex   = 1;
+  this->appliedIndex   = 2;
+  this->fillPtr        = buffers;
+  this->receiveState   = DMX_RECEIVE_IDLE;
+  this->receiveAddress = 0;
+  this->filledCount    = 0;
+  this->frameIsWaiting = false;
+  this->dropCount      = 0;
+
+  this->frameIsFirst = true;
+  this->frameCount   = 0;
+  this->changeCount  = 0;
+
+  if ( ! setStartAddress ( startAddress ) ) setStartAddress ( startAddress < 1 ? 1 : CWW_LED_DMX_SLOTS + 1 - slotCount );
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedDmx::~CwwLedDmx () {
+
+  delete [] slotKinds;
+  delete [] buffers;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+boolean CwwLedDmx::setStartAddress ( uint16_t startAddress ) {
+
+  if ( startAddress < 1 || startAddress + slotCount - 1 > CWW_LED_DMX_SLOTS ) return false;
+
+  // Slots of a frame in progress (or waiting) belong to the old block, and
+  // all slots of the next frame are applied...
+  noInterrupts ();
+  this->startAddress = startAddress;
+  receiveState   = DMX_RECEIVE_IDLE;
+  frameIsWaiting = false;
+  frameIsFirst   = true;
+  interrupts ();
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedDmx::valueOfStartAddress () {
+
+  return startAddress;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedDmx::valueOfSlotCount () {
+
+  return slotCount;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedDmx::setSlotKind (
+  uint16_t          channelIndex,
+  cwwEnumLedDmxSlot slotKind
+) {
+
+  if ( channelIndex >= slotCount || slotKind > LED_DMX_MODE ) return false;
+
+  slotKinds[channelIndex] = slotKind;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwEnumLedDmxSlot CwwLedDmx::valueOfSlotKind ( uint16_t channelIndex ) {
+
+  if ( channelIndex >= slotCount ) return LED_DMX_IGNORE;
+
+  return (cwwEnumLedDmxSlot) slotKinds[channelIndex];
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedDmx::receiveBreak () {
+
+  // A break also ends a frame shorter than the block; the frame it starts
+  // goes into the third buffer, so that it is not lost while the short
+  // frame waits for updateNow()...
+  if ( receiveState == DMX_RECEIVE_SLOTS ) finishFrame ();
+
+  receiveState = DMX_RECEIVE_START;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedDmx::receiveByte ( uint8_t dataByte ) {
+
+  switch ( receiveState ) {
+
+    case DMX_RECEIVE_START:
+      if ( dataByte == DMX_START_CODE_DIMMER ) {
+        receiveState   = DMX_RECEIVE_SLOTS;
+        receiveAddress = 1;
+        fillPtr        = buffers + fillIndex * slotCount;
+      }
+      else {
+        receiveState = DMX_RECEIVE_IDLE;
+      }
+      break;
+
+    case DMX_RECEIVE_SLOTS:
+      if ( receiveAddress >= startAddress ) fillPtr[receiveAddress - startAddress] = dataByte;
+      if ( ++receiveAddress >= startAddress + slotCount ) {
+        finishFrame ();
+        receiveState = DMX_RECEIVE_IDLE;
+      }
+      break;
+
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedDmx::updateIsDue () {
+
+  return frameIsWaiting;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedDmx::updateNow () {
+
+  uint8_t          * filledPtr;
+  uint8_t          * appliedPtr;
+  uint16_t           slotIndex;
+  uint8_t            slotValue;
+  CwwLedController * controllerPtr;
+
+  if ( ! frameIsWaiting ) return false;
+
+  // The interrupt leaves the waiting and applied buffers alone while a
+  // frame is waiting...
+  filledPtr  = buffers + waitingIndex * slotCount;
+  appliedPtr = buffers + appliedIndex * slotCount;
+
+  // Slots missing from a short frame keep their values...
+  if ( filledCount < slotCount ) memcpy ( filledPtr + filledCount, appliedPtr + filledCount, slotCount - filledCount );
+
+  bankPtr->beginFrame ();
+
+  for ( slotIndex = 0; slotIndex < slotCount; slotIndex++ ) {
+
+    slotValue = filledPtr[slotIndex];
+    if ( slotValue == appliedPtr[slotIndex] && ! frameIsFirst ) continue;
+
+    controllerPtr = bankPtr->channel ( slotIndex );
+    if ( controllerPtr == NULL ) continue;
+
+    switch ( slotKinds[slotIndex] ) {
+
+      case LED_DMX_LEVEL:
+        controllerPtr->setLevel ( slotValue );
+        changeCount++;
+        break;
+
+      case LED_DMX_MODE:
+        // Trigger on a change of range only, so that a fader moving
+        // within the range of a mode does not restart it...
+        if ( slotValue / DMX_MODE_WIDTH == appliedPtr[slotIndex] / DMX_MODE_WIDTH && ! frameIsFirst ) break;
+        if ( slotValue / DMX_MODE_WIDTH >= LED_MODE_COUNT ) break;
+        controllerPtr->setMode ( (cwwEnumLedMode) ( slotValue / DMX_MODE_WIDTH ) );
+        changeCount++;
+        break;
+
+    }
+
+  }
+
+  bankPtr->commitFrame ();
+
+  frameIsFirst = false;
+  frameCount++;
+
+  // The buffer applied before receives a later frame...
+  appliedIndex   = waitingIndex;
+  frameIsWaiting = false;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedDmx::valueOfSlot ( uint16_t channelIndex ) {
+
+  if ( channelIndex >= slotCount ) return 0;
+
+  return buffers[appliedIndex * slotCount + channelIndex];
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint32_t CwwLedDmx::valueOfFrameCount () {
+
+  return frameCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint32_t CwwLedDmx::valueOfDropCount () {
+
+  uint32_t dropCountNow;
+
+  noInterrupts ();
+  dropCountNow = dropCount;
+  interrupts ();
+
+  return dropCountNow;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint32_t CwwLedDmx::valueOfChangeCount () {
+
+  return changeCount;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedDmx::finishFrame () {
+
+  uint16_t slotsFilled;
+
+  if ( receiveAddress <= startAddress ) return;  // frame ended before the block
+
+  // A frame completed while another still waits is dropped; its buffer
+  // receives the next frame...
+  if ( frameIsWaiting ) {
+    dropCount++;
+    return;
+  }
+
+  slotsFilled = receiveAddress - startAddress;
+  if ( slotsFilled > slotCount ) slotsFilled = slotCount;
+
+  // Hand the filled buffer over; the third one (neither waiting nor
+  // applied) receives from now on...
+  waitingIndex   = fillIndex;
+  fillIndex      = 3 - waitingIndex - appliedIndex;
+  filledCount    = slotsFilled;
+  frameIsWaiting = true;
+
+}
+
+// ****************************************************************************
+// LED DMX Port Class
+// ****************************************************************************
+
+#if defined(__linux__)
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedDmxPort::CwwLedDmxPort () {
+
+  this->deviceFd  = -1;
+  this->markState = DMX_MARK_NONE;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedDmxPort::~CwwLedDmxPort () {
+
+  close ();
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+boolean CwwLedDmxPort::open (
+  const char * devicePath,
+  boolean      isPseudoTerminal
+) {
+
+  int            fd;
+  struct termios settings;
+
+  close ();
+
+  fd = ::open ( devicePath, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC );
+  if ( fd < 0 ) return false;
+
+  // Raw 8N2, with breaks and framing errors marked in the byte stream
+  // (which a pseudo terminal would apply to bytes already marked)...
+  if ( tcgetattr ( fd, &settings ) != 0 ) {
+    ::close ( fd );
+    return false;
+  }
+  cfmakeraw ( &settings );
+  settings.c_cflag |= CSTOPB | CLOCAL | CREAD;
+  if ( ! isPseudoTerminal ) {
+    settings.c_iflag &= ~( IGNBRK | BRKINT | IGNPAR | ISTRIP );
+    settings.c_iflag |=    PARMRK | INPCK;
+  }
+  if ( tcsetattr ( fd, TCSANOW, &settings ) != 0 ) {
+    ::close ( fd );
+    return false;
+  }
+
+  deviceFd  = fd;
+  markState = DMX_MARK_NONE;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedDmxPort::close () {
+
+  if ( deviceFd >= 0 ) ::close ( deviceFd );
+  deviceFd = -1;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedDmxPort::isOpen () {
+
+  return deviceFd >= 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint16_t CwwLedDmxPort::receive ( CwwLedDmx & dmx ) {
+
+  uint8_t  readBuffer[256];
+  ssize_t  readCount;
+  ssize_t  byteIndex;
+  uint8_t  dataByte;
+  uint16_t breakCount;
+
+  breakCount = 0;
+  if ( deviceFd < 0 ) return 0;
+
+  while ( ( readCount = read ( deviceFd, readBuffer, sizeof readBuffer ) ) > 0 ) {
+
+    for ( byteIndex = 0; byteIndex < readCount; byteIndex++ ) {
+
+      dataByte = readBuffer[byteIndex];
+
+      switch ( markState ) {
+
+        case DMX_MARK_NONE:
+          if ( dataByte == 0xFF ) markState = DMX_MARK_ESCAPE;
+          else                    dmx.receiveByte ( dataByte );
+          break;
+
+        case DMX_MARK_ESCAPE:
+          if ( dataByte == 0x00 ) {
+            markState = DMX_MARK_ERROR;
+          }
+          else {
+            dmx.receiveByte ( dataByte );  // 0xFF 0xFF is a data byte 0xFF
+            markState = DMX_MARK_NONE;
+          }
+          break;
+
+        case DMX_MARK_ERROR:
+          // 0xFF 0x00 0x00 is a break; a framing error on any other byte is
+          // taken as one too, so the receiver waits for a clean frame...
+          dmx.receiveBreak ();
+          breakCount++;
+          markState = DMX_MARK_NONE;
+          break;
+
+      }
+
+    }
+
+  }
+
+  return breakCount;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedDmxPort::writeFrame (
+  int             fd,
+  const uint8_t * slots,
+  uint16_t        slotCount,
+  uint8_t         startCode
+) {
+
+  uint8_t  frameBuffer[3 + 2 * ( 1 + CWW_LED_DMX_SLOTS )];
+  uint16_t frameLength;
+  uint16_t slotIndex;
+  uint16_t writtenLength;
+  ssize_t  writeCount;
+
+  if ( slotCount > CWW_LED_DMX_SLOTS ) return false;
+
+  frameBuffer[0] = 0xFF;
+  frameBuffer[1] = 0x00;
+  frameBuffer[2] = 0x00;
+  frameLength    = 3;
+
+  frameBuffer[frameLength++] = startCode;
+  if ( startCode == 0xFF ) frameBuffer[frameLength++] = 0xFF;
+
+  for ( slotIndex = 0; slotIndex < slotCount; slotIndex++ ) {
+    frameBuffer[frameLength++] = slots[slotIndex];
+    if ( slots[slotIndex] == 0xFF ) frameBuffer[frameLength++] = 0xFF;
+  }
+
+  for ( writtenLength = 0; writtenLength < frameLength; writtenLength += writeCount ) {
+    writeCount = write ( fd, frameBuffer + writtenLength, frameLength - writtenLength );
+    if ( writeCount <= 0 ) return false;
+  }
+
+  return true;
+
+}
+
+#endif  // __linux__
+
+// ****************************************************************************
@@ -0,0 +1,180 @@
+// ****************************************************************************
+//
+// LED DMX Receiver and DMX Port Classes
+// -------------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedDmx class lets a lighting console control the channels of a
+// CwwLedBank over DMX512. Like a DMX fixture, the bank occupies a block
+// of consecutive slots from a start address (see setStartAddress): bank
+// channel 0 is slot startAddress, channel 1 the next slot, and so on. Each
+// slot either sets the level of its channel (LED_DMX_LEVEL, the default)
+// or triggers a mode (LED_DMX_MODE): values 0 to 9 select mode 0 (LED_OFF),
+// 10 to 19 mode 1 (LED_ON), etc. (see cwwEnumLedMode), as on fixtures with
+// function channels.
+//
+// DMX512 is sent at 250 kbaud, 8N2; each frame starts with a break (a low
+// level longer than a character, seen by a UART as a framing error), then
+// a start code (0 for dimmer data) and up to 512 slots. The UART receive
+// interrupt passes breaks and bytes on, e.g. on an AVR with USART0:
+//
+//   ISR ( USART_RX_vect ) {
+//     if ( UCSR0A & _BV ( FE0 ) ) { UDR0; dmx.receiveBreak (); }
+//     else                        dmx.receiveByte ( UDR0 );
+//   }
+//
+// The interrupt only stores slots within the block of the bank (slots
+// before and after it just advance a counter), into one of three buffers.
+// Once the last slot of the block has arrived (or the frame ended early,
+// i.e. at the next break), the buffer is handed to updateNow(), which
+// compares it with the buffer of the frame applied before, in one pass
+// over the block, and applies only the slots that changed, as one bank
+// frame. The third buffer receives the next frame meanwhile, so a frame
+// shorter than the block, which only ends at the break starting the next
+// one, loses no frames. Frames completed while a frame is still waiting
+// for updateNow() are dropped (see valueOfDropCount); the next one is
+// taken, so the bank always follows the console with at most one frame of
+// delay. Frames with other start codes (e.g. RDM, text) are ignored.
+//
+// The CwwLedDmxPort class feeds a CwwLedDmx from a serial device on
+// Linux, e.g. a USB DMX adapter, or a pseudo terminal standing in for one
+// in host tests. The device is put into raw mode with parity marking, so
+// that the terminal driver reports breaks in the byte stream (as the
+// sequence 0xFF 0x00 0x00, with data bytes 0xFF doubled). A pseudo
+// terminal cannot send breaks, so it is opened without parity marking
+// (its bytes pass as written) and the test playing the console on the
+// master side writes the marked stream itself (see writeFrame). The baud
+// rate of real devices must be set up beforehand (250 kbaud is not a
+// standard POSIX rate).
+//
+// ****************************************************************************
+
+#ifndef CwwLedDmx_h
+#define CwwLedDmx_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+
+// ============================================================================
+
+#define CWW_LED_DMX_SLOTS  512  // slots per universe
+
+enum cwwEnumLedDmxSlot {
+  LED_DMX_IGNORE,  // Slot does not change its channel
+  LED_DMX_LEVEL,   // Slot sets the level of its channel (see setLevel)
+  LED_DMX_MODE     // Slot value / 10 sets the mode of its channel, when it changes
+};
+
+// ============================================================================
+
+class CwwLedDmx {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedDmx ( CwwLedBank & bank,              // Bank to drive
+                         uint16_t     startAddress = 1,  // Slot of bank channel 0; 1 to 512
+                         uint16_t     slotCount    = 0   // Slots (channels) used; 0 for channel capacity of bank
+                       );
+    virtual ~CwwLedDmx ();
+
+    boolean  setStartAddress     ( uint16_t startAddress );  // false if the block does not fit the universe
+    uint16_t valueOfStartAddress ();
+    uint16_t valueOfSlotCount    ();
+
+    boolean           setSlotKind     ( uint16_t channelIndex, cwwEnumLedDmxSlot slotKind );
+    cwwEnumLedDmxSlot valueOfSlotKind ( uint16_t channelIndex );
+
+    void receiveBreak ();                    // from UART interrupt, on framing error
+    void receiveByte  ( uint8_t dataByte );  // from UART interrupt
+
+    boolean updateIsDue ();  // true if a frame is waiting
+    boolean updateNow   ();  // apply changed slots of waiting frame as one bank frame; true if a frame was applied
+    uint8_t valueOfSlot ( uint16_t channelIndex );  // value last applied; 0 until the first frame
+
+    uint32_t valueOfFrameCount  ();  // frames applied
+    uint32_t valueOfDropCount   ();  // frames completed while a frame was waiting, and dropped
+    uint32_t valueOfChangeCount ();  // slots applied
+
+  private:
+
+    // Private Types:
+
+    enum enumDmxReceive {
+      DMX_RECEIVE_IDLE,   // waiting for break
+      DMX_RECEIVE_START,  // waiting for start code
+      DMX_RECEIVE_SLOTS   // receiving slots
+    };
+
+    // Private Variables:
+
+    CwwLedBank * bankPtr;
+
+    uint16_t  startAddress;
+    uint16_t  slotCount;
+    uint8_t * slotKinds;
+    uint8_t * buffers;         // three buffers of slotCount bytes
+    uint8_t * fillPtr;         // buffer receiving slots; set by the interrupt at each start code
+
+    volatile uint8_t  receiveState;
+    volatile uint16_t receiveAddress;  // address of next slot
+    volatile uint8_t  fillIndex;       // buffer receiving slots
+    volatile uint8_t  waitingIndex;    // buffer of waiting frame
+    volatile uint8_t  appliedIndex;    // buffer of slots applied last
+    volatile uint16_t filledCount;     // slots received into waiting frame
+    volatile boolean  frameIsWaiting;
+    volatile uint32_t dropCount;
+
+    boolean  frameIsFirst;
+    uint32_t frameCount;
+    uint32_t changeCount;
+
+    // Private Functions:
+
+    void finishFrame ();
+
+};
+
+// ============================================================================
+
+#if defined(__linux__)
+
+class CwwLedDmxPort {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedDmxPort ();
+    virtual ~CwwLedDmxPort ();
+
+    boolean  open    ( const char * devicePath, boolean isPseudoTerminal = false );  // false on error (see errno)
+    void     close   ();
+    boolean  isOpen  ();
+    uint16_t receive ( CwwLedDmx & dmx );  // pass all available bytes on; returns number of breaks seen
+
+    static boolean writeFrame ( int fd, const uint8_t * slots, uint16_t slotCount, uint8_t startCode = 0 );
+    // Writes a frame as a terminal driver reports it with parity marking,
+    // e.g. to the master side of a pseudo terminal; false on error.
+
+  private:
+
+    // Private Variables:
+
+    int     deviceFd;
+    uint8_t markState;  // progress through a 0xFF marking sequence
+
+};
+
+#endif  // __linux__
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
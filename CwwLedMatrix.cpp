@@ -0,0 +1,280 @@
+// ****************************************************************************
+//
+// LED Matrix Output Class
+// -----------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedMatrix, an output backend for
+// row/column-multiplexed LED matrices using bit plane modulation.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedMatrix.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define MATRIX_MAX_ROWS    16
+#define MATRIX_MAX_COLS    16  // limited by 16-bit column masks
+#define MATRIX_NO_ROW    0xFF
+
+// ****************************************************************************
+// LED Matrix Output Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedMatrix::CwwLedMatrix (
+  const uint8_t * rowPins,
+  uint8_t         rowCount,
+  const uint8_t * colPins,
+  uint8_t         colCount,
+  boolean         rowActiveLow,
+  boolean         colActiveLow,
+  uint8_t         bitDepth
+) {
+
+  uint16_t cellCount;
+  uint16_t planeCount;
+
+  if      ( rowCount == 0               ) rowCount = 1;
+  else if ( rowCount >  MATRIX_MAX_ROWS ) rowCount = MATRIX_MAX_ROWS;
+  if      ( colCount == 0               ) colCount = 1;
+  else if ( colCount >  MATRIX_MAX_COLS ) colCount = MATRIX_MAX_COLS;
+  if      ( bitDepth == 0               ) bitDepth = 1;
+  else if ( bitDepth >  8               ) bitDepth = 8;
+
+  this->rowPins      = rowPins;
+  this->colPins      = colPins;
+  this->rowCount     = rowCount;
+  this->colCount     = colCount;
+  this->rowActiveLow = rowActiveLow;
+  this->colActiveLow = colActiveLow;
+  this->bitDepth     = bitDepth;
+
+  cellCount  = (uint16_t) rowCount * colCount;
+  planeCount = (uint16_t) rowCount * bitDepth;
+
+  cellLevels = new uint8_t [ cellCount ];
+  memset ( cellLevels, 0, cellCount );
+  levelsChanged = false;
+
+  bitPlanes[0] = new uint16_t [ planeCount ];
+  bitPlanes[1] = new uint16_t [ planeCount ];
+  memset ( bitPlanes[0], 0, planeCount * sizeof ( uint16_t ) );
+  memset ( bitPlanes[1], 0, planeCount * sizeof ( uint16_t ) );
+  frontPlaneSet = 0;
+  scanPlaneSet  = 0;
+
+  // Position scan at last bit of last row, so that the first call of
+  // scanIsr() starts a new scan frame...
+  scanRow       = rowCount - 1;
+  scanBit       = bitDepth - 1;
+  selectedRow   = MATRIX_NO_ROW;
+  drivenColumns = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedMatrix::~CwwLedMatrix () {
+
+  delete [] cellLevels;
+  delete [] bitPlanes[0];
+  delete [] bitPlanes[1];
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+void CwwLedMatrix::begin () {
+
+  uint8_t index;
+
+  for ( index = 0; index < rowCount; index++ ) {
+    pinMode      ( rowPins[index], OUTPUT );
+    digitalWrite ( rowPins[index], rowActiveLow ? HIGH : LOW );
+  }
+
+  for ( index = 0; index < colCount; index++ ) {
+    pinMode      ( colPins[index], OUTPUT );
+    digitalWrite ( colPins[index], colActiveLow ? HIGH : LOW );
+  }
+
+  selectedRow   = MATRIX_NO_ROW;
+  drivenColumns = 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedMatrix::channelOf ( uint8_t row, uint8_t col ) {
+
+  return row * colCount + col;
+
+}
+
+// ============================================================================
+
+void CwwLedMatrix::writeLevel ( uint8_t ledChannel, uint8_t ledLevel, boolean usePwm ) {
+
+  if ( ledChannel >= (uint16_t) rowCount * colCount ) return;
+
+  if ( ! usePwm && ledLevel > 0 ) ledLevel = 255;
+
+  if ( cellLevels[ledChannel] != ledLevel ) {
+    cellLevels[ledChannel] = ledLevel;
+    levelsChanged = true;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedMatrix::commitFrame () {
+
+  uint8_t backPlaneSet;
+
+  if ( ! levelsChanged ) return;
+
+  // If the scan has not yet picked up the previously committed planes, the
+  // other set is still being displayed and must not be overwritten. The
+  // changes stay pending until the next commit...
+  if ( scanPlaneSet != frontPlaneSet ) return;
+
+  backPlaneSet = frontPlaneSet ^ 1;
+  buildBitPlanes ( bitPlanes[backPlaneSet] );
+  frontPlaneSet = backPlaneSet;
+  levelsChanged = false;
+
+}
+
+// ============================================================================
+
+uint16_t CwwLedMatrix::scanIsr () {
+
+  if ( ++scanBit >= bitDepth ) {
+    scanBit = 0;
+    if ( ++scanRow >= rowCount ) {
+      scanRow = 0;
+      scanPlaneSet = frontPlaneSet;  // latch new planes only at frame start
+    }
+    driveColumns ( 0 );  // blank before switching rows to avoid ghosting
+    selectRow ( scanRow );
+  }
+
+  driveColumns ( bitPlanes[scanPlaneSet][ (uint16_t) scanRow * bitDepth + scanBit ] );
+
+  return 1 << scanBit;
+
+}
+
+// ============================================================================
+
+uint8_t CwwLedMatrix::valueOfRowCount () {
+
+  return rowCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedMatrix::valueOfColCount () {
+
+  return colCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedMatrix::valueOfBitDepth () {
+
+  return bitDepth;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedMatrix::valueOfTicksPerFrame () {
+
+  return (uint16_t) rowCount * ( ( 1 << bitDepth ) - 1 );
+
+}
+
+// ============================================================================
+// Protected Functions
+// ============================================================================
+
+void CwwLedMatrix::selectRow ( uint8_t row ) {
+
+  if ( selectedRow != MATRIX_NO_ROW ) {
+    digitalWrite ( rowPins[selectedRow], rowActiveLow ? HIGH : LOW );
+  }
+
+  digitalWrite ( rowPins[row], rowActiveLow ? LOW : HIGH );
+  selectedRow = row;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedMatrix::driveColumns ( uint16_t columnMask ) {
+
+  uint16_t changedColumns;
+  uint8_t  col;
+  boolean  colIsLit;
+
+  // Only touch the pins of columns that actually change...
+  changedColumns = columnMask ^ drivenColumns;
+
+  for ( col = 0; changedColumns != 0; col++, changedColumns >>= 1 ) {
+    if ( changedColumns & 1 ) {
+      colIsLit = ( columnMask >> col ) & 1;
+      digitalWrite ( colPins[col], colIsLit != colActiveLow ? HIGH : LOW );
+    }
+  }
+
+  drivenColumns = columnMask;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedMatrix::buildBitPlanes ( uint16_t * planes ) {
+
+  uint8_t    row;
+  uint8_t    col;
+  uint8_t    bit;
+  uint8_t    level;
+  uint16_t   colBit;
+  uint8_t  * rowLevels;
+  uint16_t * rowPlanes;
+
+  for ( row = 0; row < rowCount; row++ ) {
+
+    rowLevels = cellLevels + (uint16_t) row * colCount;
+    rowPlanes = planes     + (uint16_t) row * bitDepth;
+
+    for ( bit = 0; bit < bitDepth; bit++ ) rowPlanes[bit] = 0;
+
+    for ( col = 0, colBit = 1; col < colCount; col++, colBit <<= 1 ) {
+      level = rowLevels[col] >> ( 8 - bitDepth );
+      for ( bit = 0; level != 0; bit++, level >>= 1 ) {
+        if ( level & 1 ) rowPlanes[bit] |= colBit;
+      }
+    }
+
+  }
+
+}
+
+// ****************************************************************************
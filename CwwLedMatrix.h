@@ -0,0 +1,114 @@
+// ****************************************************************************
+//
+// LED Matrix Output Class
+// -----------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedMatrix class is an output backend (see CwwLedOutput) for a
+// row/column-multiplexed LED matrix of up to 16 x 16 LEDs. Each matrix
+// cell is addressed by a channel number (see channelOf) and may be driven
+// by its own CwwLedController instance, giving every cell the full set
+// of modes (blink, fade, oscillate, sequences).
+//
+// Brightness is rendered with bit plane modulation (binary code
+// modulation): each row is shown once per bit of the cell levels, for a
+// time proportional to the weight of that bit. The bit planes are
+// prepared from the cell levels once per frame in commitFrame() (e.g. by
+// CwwLedBank::updateNow()), so that the scan itself only needs to output
+// one precomputed column mask per bit.
+//
+// The scan is driven by user code from a timer interrupt by calling
+// scanIsr(), which returns the number of timer ticks until it needs to be
+// called again. With a one-shot timer compare this results in only
+// rowCount * bitDepth interrupts per scan frame:
+//
+//   scan frame rate = tick rate / ( rowCount * ( 2^bitDepth - 1 ) )
+//
+// The default pin handling uses digitalWrite(). Hardware with shift
+// registers, row drivers or direct port access may override selectRow()
+// and driveColumns() in a derived class.
+//
+// ****************************************************************************
+
+#ifndef CwwLedMatrix_h
+#define CwwLedMatrix_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+
+// ============================================================================
+
+class CwwLedMatrix : public CwwLedOutput {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedMatrix ( const uint8_t * rowPins,                   // Row pins; array of rowCount pin numbers
+                            uint8_t         rowCount,                  // Number of rows (1 to 16)
+                            const uint8_t * colPins,                   // Column pins; array of colCount pin numbers
+                            uint8_t         colCount,                  // Number of columns (1 to 16)
+                            boolean         rowActiveLow  = false,     // Set to true if a row is selected by driving it low
+                            boolean         colActiveLow  = true,      // Set to true if a column is lit by driving it low
+                            uint8_t         bitDepth      = 8          // Number of most significant level bits rendered (1 to 8)
+                          );
+    virtual ~CwwLedMatrix ();
+
+    void    begin     ();                          // Configure pins; call once before scanning
+    uint8_t channelOf ( uint8_t row, uint8_t col );
+
+    virtual void writeLevel  ( uint8_t ledChannel, uint8_t ledLevel, boolean usePwm );
+    virtual void commitFrame ();  // prepare bit planes from cell levels, if changed
+
+    uint16_t scanIsr ();  // output next bit plane; returns ticks until next call
+
+    uint8_t  valueOfRowCount      ();
+    uint8_t  valueOfColCount      ();
+    uint8_t  valueOfBitDepth      ();
+    uint16_t valueOfTicksPerFrame ();  // timer ticks per complete scan of all rows
+
+  protected:
+
+    // Protected Functions:
+
+    virtual void selectRow    ( uint8_t row );          // deselect previously selected row and select row
+    virtual void driveColumns ( uint16_t columnMask );  // light columns of selected row per mask bits
+
+  private:
+
+    // Private Variables:
+
+    const uint8_t * rowPins;
+    const uint8_t * colPins;
+    uint8_t         rowCount;
+    uint8_t         colCount;
+    boolean         rowActiveLow;
+    boolean         colActiveLow;
+    uint8_t         bitDepth;
+
+    uint8_t  * cellLevels;    // rowCount * colCount levels
+    boolean    levelsChanged;
+
+    uint16_t * bitPlanes[2];  // two sets of rowCount * bitDepth column masks
+    volatile uint8_t frontPlaneSet;
+    volatile uint8_t scanPlaneSet;
+
+    uint8_t  scanRow;
+    uint8_t  scanBit;
+    uint8_t  selectedRow;
+    uint16_t drivenColumns;
+
+    // Private Functions:
+
+    void buildBitPlanes ( uint16_t * planes );
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
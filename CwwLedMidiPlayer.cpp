@@ -0,0 +1,700 @@
+// ****************************************************************************
+//
+// LED MIDI Player Class
+// ---------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedMidiPlayer, which streams the events
+// of a Standard MIDI File, merging its tracks through a heap, and maps
+// them onto LED controllers.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedMidiPlayer.h>
+#include <CwwLedTimebase.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(address)  ( * (const uint8_t *) ( address ) )  // cores without program memory space
+#endif
+
+#define MIDI_CHUNK_HEADER  0x4D546864UL  // "MThd"
+#define MIDI_CHUNK_TRACK   0x4D54726BUL  // "MTrk"
+
+#define MIDI_TEMPO_DEFAULT  500000UL  // 120 beats per minute
+
+#define MIDI_NOTE_OFF       0x80
+#define MIDI_NOTE_ON        0x90
+#define MIDI_CONTROL        0xB0
+#define MIDI_SYSEX          0xF0
+#define MIDI_SYSEX_ESCAPE   0xF7
+#define MIDI_META           0xFF
+#define MIDI_META_END       0x2F
+#define MIDI_META_TEMPO     0x51
+
+// ****************************************************************************
+// LED MIDI Player Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedMidiPlayer::CwwLedMidiPlayer (
+  uint8_t      trackCapacity,
+  uint8_t      mapCapacity,
+  CwwLedBank * bankPtr
+) {
+
+  if ( trackCapacity == 0 ) trackCapacity = 1;
+
+  this->filePtr    = NULL;
+  this->fileLength = 0;
+
+  this->tracks        = new structMidiTrack [ trackCapacity ];
+  this->heap          = new uint8_t [ trackCapacity ];
+  this->trackCapacity = trackCapacity;
+  this->trackCount    = 0;
+  this->heapCount     = 0;
+
+  this->maps        = new structMidiMap [ mapCapacity > 0 ? mapCapacity : 1 ];
+  this->mapCapacity = mapCapacity;
+  this->mapCount    = 0;
+
+  this->bankPtr = bankPtr;
+
+  this->ticksPerQuarter = 96;
+  this->tempoIsFixed    = false;
+  this->tempoAtStart    = MIDI_TEMPO_DEFAULT;
+
+  this->isActive  = false;
+  this->startTime = 0;
+
+  rewind ();
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedMidiPlayer::~CwwLedMidiPlayer () {
+
+  delete [] tracks;
+  delete [] heap;
+  delete [] maps;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+uint8_t CwwLedMidiPlayer::load (
+  const uint8_t * filePtr,
+  uint32_t        fileLength
+) {
+
+  uint8_t  loadIssues;
+  uint32_t chunkOffset;
+  uint32_t chunkLength;
+  uint16_t fileFormat;
+  uint16_t fileDivision;
+  uint8_t  framesPerSecond;
+
+  stop ();
+
+  this->filePtr    = filePtr;
+  this->fileLength = fileLength;
+  trackCount = 0;
+  loadIssues = MIDI_ISSUE_NONE;
+
+  if ( filePtr == NULL || fileLength < 14 || readWord ( 0, 4 ) != MIDI_CHUNK_HEADER || readWord ( 4, 4 ) < 6 ) {
+    this->fileLength = 0;
+    rewind ();
+    return MIDI_ISSUE_HEADER;
+  }
+
+  fileFormat   = readWord (  8, 2 );
+  fileDivision = readWord ( 12, 2 );
+  if ( fileFormat > 1 ) loadIssues |= MIDI_ISSUE_FORMAT;
+
+  if ( fileDivision & 0x8000 ) {
+    // SMPTE time: ticks per frame times frames per second (negated in the
+    // high byte), with 29 standing for 30 drop frame, i.e. 29.97...
+    framesPerSecond = - (int8_t) ( fileDivision >> 8 );
+    tempoIsFixed    = true;
+    tempoAtStart    = framesPerSecond == 29 ? 1001000UL : 1000000UL;
+    if ( framesPerSecond == 29 ) framesPerSecond = 30;
+    ticksPerQuarter = (uint16_t) framesPerSecond * ( fileDivision & 0xFF );
+  }
+  else {
+    tempoIsFixed    = false;
+    tempoAtStart    = MIDI_TEMPO_DEFAULT;
+    ticksPerQuarter = fileDivision;
+  }
+  if ( ticksPerQuarter == 0 ) ticksPerQuarter = 1;
+
+  // Find track chunks; chunks of unknown type are skipped...
+  chunkOffset = 8 + readWord ( 4, 4 );
+
+  while ( chunkOffset <= fileLength - 8 ) {
+
+    chunkLength = readWord ( chunkOffset + 4, 4 );
+    if ( chunkLength > fileLength - chunkOffset - 8 ) {
+      chunkLength = fileLength - chunkOffset - 8;
+      loadIssues |= MIDI_ISSUE_LENGTH;
+    }
+
+    if ( readWord ( chunkOffset, 4 ) == MIDI_CHUNK_TRACK ) {
+      if ( trackCount < trackCapacity ) {
+        tracks[trackCount].startOffset = chunkOffset + 8;
+        tracks[trackCount].endOffset   = chunkOffset + 8 + chunkLength;
+        trackCount++;
+      }
+      else {
+        loadIssues |= MIDI_ISSUE_TRACKS;
+      }
+    }
+
+    chunkOffset += 8 + chunkLength;
+
+  }
+
+  rewind ();
+
+  return loadIssues;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedMidiPlayer::valueOfTrackCount () {
+
+  return trackCount;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedMidiPlayer::mapNote (
+  uint8_t            midiChannel,
+  uint8_t            noteNumber,
+  CwwLedController * controllerPtr,
+  cwwEnumLedMode     onMode,
+  cwwEnumLedMode     offMode
+) {
+
+  return addMap ( MAP_NOTE, midiChannel, noteNumber, controllerPtr, onMode, offMode, 0, 0 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedMidiPlayer::mapControl (
+  uint8_t            midiChannel,
+  uint8_t            controlNumber,
+  CwwLedController * controllerPtr
+) {
+
+  return addMap ( MAP_CONTROL_LEVEL, midiChannel, controlNumber, controllerPtr, 0, 0, 0, 0 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedMidiPlayer::mapControl (
+  uint8_t            midiChannel,
+  uint8_t            controlNumber,
+  CwwLedController * controllerPtr,
+  cwwEnumLedParam    param,
+  uint16_t           valueMin,
+  uint16_t           valueMax
+) {
+
+  if ( param > LED_PARAM_LEVEL_RANGE ) return false;
+
+  return addMap ( MAP_CONTROL_PARAM, midiChannel, controlNumber, controllerPtr, param, 0, valueMin, valueMax );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedMidiPlayer::discardMaps () {
+
+  mapCount = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedMidiPlayer::start () {
+
+  rewind ();
+
+  startTime = CwwLedTimebase::now ();
+  isActive  = heapCount > 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedMidiPlayer::stop () {
+
+  isActive = false;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedMidiPlayer::isPlaying () {
+
+  return isActive;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedMidiPlayer::updateIsDue () {
+
+  return millisUntilUpdate () == 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedMidiPlayer::updateNow () {
+
+  unsigned long     elapsedMs;
+  structMidiTrack * trackPtr;
+
+  if ( ! updateIsDue () ) return false;
+
+  elapsedMs = CwwLedTimebase::now () - startTime;
+
+  if ( bankPtr != NULL ) bankPtr->beginFrame ();
+
+  // Events due, in time order over all tracks; ties go to the lower track
+  // (e.g. tempo changes in the first track of a format 1 file)...
+  while ( heapCount > 0 && timeOfTick ( tracks[heap[0]].nextTick ) <= elapsedMs ) {
+    trackPtr = &tracks[heap[0]];
+    readEvent ( trackPtr );
+    if ( readDelta ( trackPtr ) ) heapSift ( 0 );
+    else                          heapPop  ();
+  }
+
+  if ( bankPtr != NULL ) bankPtr->commitFrame ();
+
+  if ( heapCount == 0 ) isActive = false;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedMidiPlayer::millisUntilUpdate () {
+
+  unsigned long eventMs;
+  unsigned long elapsedMs;
+
+  if ( ! isActive || heapCount == 0 ) return UPDATE_NOT_SCHEDULED;
+
+  eventMs   = timeOfTick ( tracks[heap[0]].nextTick );
+  elapsedMs = CwwLedTimebase::now () - startTime;
+
+  return eventMs > elapsedMs ? eventMs - elapsedMs : 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+unsigned long CwwLedMidiPlayer::valueOfPosition () {
+
+  if ( ! isActive ) return 0;
+
+  return CwwLedTimebase::now () - startTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint32_t CwwLedMidiPlayer::valueOfTempo () {
+
+  return tempo;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+boolean CwwLedMidiPlayer::addMap (
+  uint8_t            mapKind,
+  uint8_t            midiChannel,
+  uint8_t            number,
+  CwwLedController * controllerPtr,
+  uint8_t            onMode,
+  uint8_t            offMode,
+  uint16_t           valueMin,
+  uint16_t           valueMax
+) {
+
+  structMidiMap * mapPtr;
+
+  if ( mapCount >= mapCapacity || controllerPtr == NULL ) return false;
+  if ( midiChannel > 15 && midiChannel != CWW_LED_MIDI_ANY ) return false;
+  if ( number > 127     && number      != CWW_LED_MIDI_ANY ) return false;
+
+  mapPtr = &maps[mapCount++];
+
+  mapPtr->controllerPtr = controllerPtr;
+  mapPtr->mapKind       = mapKind;
+  mapPtr->midiChannel   = midiChannel;
+  mapPtr->number        = number;
+  mapPtr->onMode        = onMode;
+  mapPtr->offMode       = offMode;
+  mapPtr->valueMin      = valueMin;
+  mapPtr->valueMax      = valueMax;
+
+  return true;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedMidiPlayer::rewind () {
+
+  uint8_t           trackIndex;
+  structMidiTrack * trackPtr;
+
+  tempo     = tempoAtStart;
+  tempoTick = 0;
+  tempoMs   = 0;
+  tempoUs   = 0;
+
+  heapCount = 0;
+
+  for ( trackIndex = 0; trackIndex < trackCount; trackIndex++ ) {
+    trackPtr = &tracks[trackIndex];
+    trackPtr->offset        = trackPtr->startOffset;
+    trackPtr->nextTick      = 0;
+    trackPtr->runningStatus = 0;
+    if ( readDelta ( trackPtr ) ) heapPush ( trackIndex );
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedMidiPlayer::timeOfTick (
+  uint32_t   tick,
+  uint16_t * microsPtr
+) {
+
+  uint64_t sinceTempoUs;
+
+  // Always from the last tempo change, so that rounding to ms does not add
+  // up from event to event...
+  sinceTempoUs = (uint64_t) ( tick - tempoTick ) * tempo / ticksPerQuarter + tempoUs;
+
+  if ( microsPtr != NULL ) *microsPtr = sinceTempoUs % 1000;
+
+  return tempoMs + (unsigned long) ( sinceTempoUs / 1000 );
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedMidiPlayer::readEvent ( structMidiTrack * trackPtr ) {
+
+  uint8_t  status;
+  uint8_t  metaType;
+  uint32_t dataLength;
+  uint8_t  data1;
+  uint8_t  data2;
+
+  status = readByte ( trackPtr->offset );
+
+  if ( status & 0x80 ) {
+    trackPtr->offset++;
+  }
+  else if ( trackPtr->runningStatus != 0 ) {
+    status = trackPtr->runningStatus;
+  }
+  else {
+    // Data without status; the track cannot be read any further...
+    trackPtr->offset = trackPtr->endOffset;
+    return;
+  }
+
+  switch ( status ) {
+
+    case MIDI_META:
+      metaType   = readByte ( trackPtr->offset++ );
+      dataLength = readVarLength ( trackPtr );
+      if ( metaType == MIDI_META_END ) {
+        trackPtr->offset = trackPtr->endOffset;
+        return;
+      }
+      if ( metaType == MIDI_META_TEMPO && dataLength == 3 && ! tempoIsFixed ) {
+        tempoMs   = timeOfTick ( trackPtr->nextTick, &tempoUs );
+        tempoTick = trackPtr->nextTick;
+        tempo     = readWord ( trackPtr->offset, 3 );
+        if ( tempo == 0 ) tempo = 1;
+      }
+      trackPtr->runningStatus = 0;
+      break;
+
+    case MIDI_SYSEX:
+    case MIDI_SYSEX_ESCAPE:
+      dataLength = readVarLength ( trackPtr );
+      trackPtr->runningStatus = 0;
+      break;
+
+    default:
+      if ( status >= 0xF0 ) {
+        // System common and real time messages are not allowed in files...
+        trackPtr->offset = trackPtr->endOffset;
+        return;
+      }
+      trackPtr->runningStatus = status;
+      // Program change (0xCn) and channel pressure (0xDn) have one data
+      // byte, all other channel messages two...
+      data1 = readByte ( trackPtr->offset++ );
+      data2 = ( status & 0xE0 ) == 0xC0 ? 0 : readByte ( trackPtr->offset++ );
+      if ( trackPtr->offset <= trackPtr->endOffset ) applyChannelEvent ( status, data1 & 0x7F, data2 & 0x7F );
+      return;
+
+  }
+
+  if ( dataLength > trackPtr->endOffset - trackPtr->offset ) trackPtr->offset  = trackPtr->endOffset;
+  else                                                       trackPtr->offset += dataLength;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedMidiPlayer::readDelta ( structMidiTrack * trackPtr ) {
+
+  if ( trackPtr->offset >= trackPtr->endOffset ) return false;
+
+  trackPtr->nextTick += readVarLength ( trackPtr );
+
+  return trackPtr->offset < trackPtr->endOffset;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint32_t CwwLedMidiPlayer::readVarLength ( structMidiTrack * trackPtr ) {
+
+  uint32_t value;
+  uint8_t  byteIndex;
+  uint8_t  byteRead;
+
+  // Seven bits per byte, most significant first; at most four bytes...
+  value = 0;
+
+  for ( byteIndex = 0; byteIndex < 4 && trackPtr->offset < trackPtr->endOffset; byteIndex++ ) {
+    byteRead = readByte ( trackPtr->offset++ );
+    value    = value << 7 | ( byteRead & 0x7F );
+    if ( ! ( byteRead & 0x80 ) ) break;
+  }
+
+  return value;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint32_t CwwLedMidiPlayer::readWord (
+  uint32_t offset,
+  uint8_t  byteCount
+) {
+
+  uint32_t value;
+
+  value = 0;
+  while ( byteCount-- > 0 ) value = value << 8 | readByte ( offset++ );
+
+  return value;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedMidiPlayer::readByte ( uint32_t offset ) {
+
+  if ( offset >= fileLength ) return 0;
+
+  return pgm_read_byte ( filePtr + offset );
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedMidiPlayer::applyChannelEvent (
+  uint8_t status,
+  uint8_t data1,
+  uint8_t data2
+) {
+
+  uint8_t         messageKind;
+  uint8_t         midiChannel;
+  uint8_t         mapIndex;
+  structMidiMap * mapPtr;
+
+  messageKind = status & 0xF0;
+  midiChannel = status & 0x0F;
+
+  // Note on with velocity 0 is note off...
+  if ( messageKind == MIDI_NOTE_ON && data2 == 0 ) messageKind = MIDI_NOTE_OFF;
+
+  for ( mapIndex = 0; mapIndex < mapCount; mapIndex++ ) {
+
+    mapPtr = &maps[mapIndex];
+    if ( mapPtr->midiChannel != CWW_LED_MIDI_ANY && mapPtr->midiChannel != midiChannel ) continue;
+    if ( mapPtr->number      != CWW_LED_MIDI_ANY && mapPtr->number      != data1       ) continue;
+
+    switch ( mapPtr->mapKind ) {
+
+      case MAP_NOTE:
+        if ( messageKind == MIDI_NOTE_ON ) {
+          if ( mapPtr->onMode == LED_HOLD_LEVEL ) mapPtr->controllerPtr->setLevel ( data2 << 1 | data2 >> 6 );
+          else                                    mapPtr->controllerPtr->setMode  ( (cwwEnumLedMode) mapPtr->onMode );
+        }
+        else if ( messageKind == MIDI_NOTE_OFF ) {
+          mapPtr->controllerPtr->setMode ( (cwwEnumLedMode) mapPtr->offMode );
+        }
+        break;
+
+      case MAP_CONTROL_LEVEL:
+        if ( messageKind == MIDI_CONTROL ) mapPtr->controllerPtr->setLevel ( data2 << 1 | data2 >> 6 );
+        break;
+
+      case MAP_CONTROL_PARAM:
+        if ( messageKind != MIDI_CONTROL ) break;
+        // A level range is two levels; scaling the packed word would carry
+        // from one into the other...
+        if ( mapPtr->onMode == LED_PARAM_LEVEL_RANGE ) {
+          applyParam ( mapPtr->controllerPtr, mapPtr->onMode,
+                       scaleControl ( mapPtr->valueMin & 0xFF, mapPtr->valueMax & 0xFF, data2 )
+                     | scaleControl ( mapPtr->valueMin >> 8,   mapPtr->valueMax >> 8,   data2 ) << 8 );
+        }
+        else {
+          applyParam ( mapPtr->controllerPtr, mapPtr->onMode, scaleControl ( mapPtr->valueMin, mapPtr->valueMax, data2 ) );
+        }
+        break;
+
+    }
+
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedMidiPlayer::applyParam (
+  CwwLedController * controllerPtr,
+  uint8_t            param,
+  uint16_t           value
+) {
+
+  switch ( param ) {
+    case LED_PARAM_BLINK_PERIOD:     controllerPtr->setBlinkPeriod     ( value ); break;
+    case LED_PARAM_OSCILLATE_PERIOD: controllerPtr->setOscillatePeriod ( value ); break;
+    case LED_PARAM_REFRESH_INTERVAL: controllerPtr->setRefreshInterval ( value ); break;
+    case LED_PARAM_LEVEL_MIN:        controllerPtr->setLevelMin        ( value ); break;
+    case LED_PARAM_LEVEL_MAX:        controllerPtr->setLevelMax        ( value ); break;
+    case LED_PARAM_LEVEL_RANGE:      controllerPtr->setLevelRange      ( value & 0xFF, value >> 8 ); break;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedMidiPlayer::scaleControl (
+  uint16_t valueMin,
+  uint16_t valueMax,
+  uint8_t  controlValue
+) {
+
+  return valueMin + ( (int32_t) valueMax - valueMin ) * controlValue / 127;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedMidiPlayer::heapPush ( uint8_t trackIndex ) {
+
+  uint8_t heapIndex;
+  uint8_t parentIndex;
+  uint8_t swapIndex;
+
+  heapIndex = heapCount++;
+  heap[heapIndex] = trackIndex;
+
+  while ( heapIndex > 0 ) {
+    parentIndex = ( heapIndex - 1 ) / 2;
+    if ( ! heapLess ( heapIndex, parentIndex ) ) break;
+    swapIndex         = heap[parentIndex];
+    heap[parentIndex] = heap[heapIndex];
+    heap[heapIndex]   = swapIndex;
+    heapIndex = parentIndex;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedMidiPlayer::heapPop () {
+
+  if ( heapCount == 0 ) return;
+
+  heap[0] = heap[--heapCount];
+  heapSift ( 0 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedMidiPlayer::heapSift ( uint8_t heapIndex ) {
+
+  uint16_t childIndex;
+  uint8_t  swapIndex;
+
+  for ( ;; ) {
+    childIndex = 2 * heapIndex + 1;
+    if ( childIndex >= heapCount ) break;
+    if ( childIndex + 1 < heapCount && heapLess ( childIndex + 1, childIndex ) ) childIndex++;
+    if ( ! heapLess ( childIndex, heapIndex ) ) break;
+    swapIndex        = heap[childIndex];
+    heap[childIndex] = heap[heapIndex];
+    heap[heapIndex]  = swapIndex;
+    heapIndex = childIndex;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedMidiPlayer::heapLess (
+  uint8_t heapIndexA,
+  uint8_t heapIndexB
+) {
+
+  uint32_t tickA;
+  uint32_t tickB;
+
+  tickA = tracks[heap[heapIndexA]].nextTick;
+  tickB = tracks[heap[heapIndexB]].nextTick;
+
+  return tickA < tickB || ( tickA == tickB && heap[heapIndexA] < heap[heapIndexB] );
+
+}
+
+// ****************************************************************************
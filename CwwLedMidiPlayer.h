@@ -0,0 +1,183 @@
+// ****************************************************************************
+//
+// LED MIDI Player Class
+// ---------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedMidiPlayer class plays a Standard MIDI File (format 0 or 1) on
+// LED controllers, so that shows can be composed in any sequencer or DAW.
+// Events are mapped to controllers by MIDI channel and note or controller
+// number (see mapNote, mapControl):
+//
+// - note on sets a mode (e.g. LED_ON, LED_BLINK, LED_ENVELOPE_ON), or the
+//   level given by the velocity (LED_HOLD_LEVEL), and note off sets
+//   another mode (e.g. LED_OFF, LED_ENVELOPE_OFF), and
+// - control changes set the level, or a parameter (see cwwEnumLedParam)
+//   scaled from a range of values.
+//
+// The file is read in place (e.g. from flash; declare it PROGMEM on AVR
+// cores) and never copied: each track keeps only a cursor and its running
+// status, and the tracks are merged in time order through a small heap of
+// track indexes, so memory does not depend on the length of the file.
+//
+// Event times are converted from ticks to ms from the last tempo change,
+// with microsecond resolution, so rounding does not accumulate over a long
+// show, whatever the tempo map. Each call to updateNow() applies all events
+// due as one batch (as one bank frame, if a bank is given).
+//
+// Call updateNow() before CwwLedBank::updateNow() so that the commands
+// reach the output in the same frame as the regular refresh.
+//
+// ****************************************************************************
+
+#ifndef CwwLedMidiPlayer_h
+#define CwwLedMidiPlayer_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+
+// ============================================================================
+
+#define CWW_LED_MIDI_ANY  0xFF  // matches any MIDI channel, note or controller number in maps
+
+enum cwwEnumLedMidiIssue {  // flags returned by load()
+  MIDI_ISSUE_NONE   = 0x00,
+  MIDI_ISSUE_HEADER = 0x01,  // No MThd header chunk; nothing loaded
+  MIDI_ISSUE_FORMAT = 0x02,  // Format 2 file; sequences are played together
+  MIDI_ISSUE_TRACKS = 0x04,  // More tracks than trackCapacity; extra tracks ignored
+  MIDI_ISSUE_LENGTH = 0x08   // Chunk extends past end of file; truncated
+};
+
+// ============================================================================
+
+class CwwLedMidiPlayer {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedMidiPlayer ( uint8_t      trackCapacity = 2,     // Maximum number of tracks played
+                                uint8_t      mapCapacity   = 8,     // Maximum number of note and control maps
+                                CwwLedBank * bankPtr       = NULL   // Bank to frame batches of events with, if any
+                              );
+    virtual ~CwwLedMidiPlayer ();
+
+    uint8_t load ( const uint8_t * filePtr, uint32_t fileLength );  // returns cwwEnumLedMidiIssue flags; stops playback
+    uint8_t valueOfTrackCount ();
+
+    // All map functions return false if the map could not be added; an
+    // event applies every map it matches, in order of addition.
+    boolean mapNote    ( uint8_t midiChannel, uint8_t noteNumber, CwwLedController * controllerPtr,
+                         cwwEnumLedMode onMode = LED_HOLD_LEVEL, cwwEnumLedMode offMode = LED_OFF );
+    boolean mapControl ( uint8_t midiChannel, uint8_t controlNumber, CwwLedController * controllerPtr );  // value to level
+    boolean mapControl ( uint8_t midiChannel, uint8_t controlNumber, CwwLedController * controllerPtr,
+                         cwwEnumLedParam param, uint16_t valueMin, uint16_t valueMax );  // value 0 to 127 to valueMin to valueMax
+    // For LED_PARAM_LEVEL_RANGE, valueMin and valueMax pack two levels
+    // each (minimum in the low byte, maximum in the high byte), and both
+    // levels are scaled separately.
+    void    discardMaps ();
+    // MIDI channels are 0 to 15 (i.e. MIDI channel 1 is 0).
+
+    void    start     ();
+    void    stop      ();
+    boolean isPlaying ();  // false once all tracks have ended
+
+    boolean       updateIsDue       ();  // true if an event is due
+    boolean       updateNow         ();  // apply all events due as one batch; true if any were applied
+    unsigned long millisUntilUpdate ();  // 0 if due; UPDATE_NOT_SCHEDULED if not playing
+
+    unsigned long valueOfPosition ();  // ms from start of file; 0 if not playing
+    uint32_t      valueOfTempo    ();  // microseconds per quarter note
+
+  private:
+
+    // Private Types:
+
+    enum enumMidiMapKind {
+      MAP_NOTE,
+      MAP_CONTROL_LEVEL,
+      MAP_CONTROL_PARAM
+    };
+
+    struct structMidiTrack {
+      uint32_t startOffset;    // file offset of first event
+      uint32_t offset;         // file offset of next event, after its delta time
+      uint32_t endOffset;      // file offset of end of chunk
+      uint32_t nextTick;       // absolute time of next event in ticks
+      uint8_t  runningStatus;
+    };
+
+    struct structMidiMap {
+      CwwLedController * controllerPtr;
+      uint8_t            mapKind;
+      uint8_t            midiChannel;
+      uint8_t            number;      // note or controller number
+      uint8_t            onMode;      // or param
+      uint8_t            offMode;
+      uint16_t           valueMin;
+      uint16_t           valueMax;
+    };
+
+    // Private Variables:
+
+    const uint8_t * filePtr;
+    uint32_t        fileLength;
+
+    structMidiTrack * tracks;
+    uint8_t         * heap;        // indexes of tracks with events left, by nextTick
+    uint8_t           trackCapacity;
+    uint8_t           trackCount;
+    uint8_t           heapCount;
+
+    structMidiMap * maps;
+    uint8_t         mapCapacity;
+    uint8_t         mapCount;
+
+    CwwLedBank * bankPtr;
+
+    uint16_t      ticksPerQuarter;  // or ticks per tempoAtStart microseconds, for SMPTE time
+    boolean       tempoIsFixed;     // SMPTE time; tempo events ignored
+    uint32_t      tempoAtStart;
+    uint32_t      tempo;            // microseconds per quarter note
+    uint32_t      tempoTick;        // tick of last tempo change
+    unsigned long tempoMs;          // time of last tempo change
+    uint16_t      tempoUs;          // microseconds past tempoMs
+
+    boolean       isActive;
+    unsigned long startTime;        // see CwwLedTimebase
+
+    // Private Functions:
+
+    boolean addMap ( uint8_t mapKind, uint8_t midiChannel, uint8_t number, CwwLedController * controllerPtr,
+                     uint8_t onMode, uint8_t offMode, uint16_t valueMin, uint16_t valueMax );
+
+    void          rewind     ();
+    unsigned long timeOfTick ( uint32_t tick, uint16_t * microsPtr = NULL );
+
+    void     readEvent     ( structMidiTrack * trackPtr );
+    boolean  readDelta     ( structMidiTrack * trackPtr );  // false at end of track
+    uint32_t readVarLength ( structMidiTrack * trackPtr );
+    uint32_t readWord      ( uint32_t offset, uint8_t byteCount );  // big endian
+    uint8_t  readByte      ( uint32_t offset );
+
+    void applyChannelEvent ( uint8_t status, uint8_t data1, uint8_t data2 );
+    void applyParam        ( CwwLedController * controllerPtr, uint8_t param, uint16_t value );
+
+    static uint16_t scaleControl ( uint16_t valueMin, uint16_t valueMax, uint8_t controlValue );
+
+    void    heapPush ( uint8_t trackIndex );
+    void    heapPop  ();
+    void    heapSift ( uint8_t heapIndex );  // down, from heapIndex
+    boolean heapLess ( uint8_t heapIndexA, uint8_t heapIndexB );
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
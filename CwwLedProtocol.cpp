@@ -0,0 +1,502 @@
+// ****************************************************************************
+//
+// LED Protocol Decoder and Encoder Classes
+// ----------------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements classes CwwLedProtocol and CwwLedProtocolEncoder
+// for the COBS framed, CRC protected binary LED command protocol.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedProtocol.h>
+#include <CwwLedTimeSync.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define PROTOCOL_CRC_INIT  0xFFFF
+
+// ****************************************************************************
+// LED Protocol Decoder Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedProtocol::CwwLedProtocol ( CwwLedBank & bank ) {
+
+  bankPtr     = &bank;
+  timeSyncPtr = NULL;
+
+  frameCount   = 0;
+  errorCount   = 0;
+  commandCount = 0;
+
+  resetFrame ();
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedProtocol::~CwwLedProtocol () {
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+boolean CwwLedProtocol::receiveByte ( uint8_t dataByte ) {
+
+  boolean frameIsValid;
+
+  if ( dataByte == 0 ) {
+
+    // End of frame; back-to-back delimiters (empty frames) are ignored...
+    frameIsValid = false;
+    if ( ! frameIsBad && blockRemaining == 0 && frameLength > 0 ) {
+      frameIsValid = processFrame ();
+    }
+    else if ( frameIsBad || frameLength > 0 || blockRemaining > 0 ) {
+      errorCount++;
+    }
+    if ( frameIsValid ) frameCount++;
+    resetFrame ();
+    return frameIsValid;
+
+  }
+
+  if ( frameIsBad ) return false;
+
+  if ( blockRemaining == 0 ) {
+    // COBS code byte: the previous block (if any and if shorter than the
+    // maximum) stood for a zero byte...
+    if ( blockAddsZero ) appendByte ( 0 );
+    blockRemaining = dataByte - 1;
+    blockAddsZero  = dataByte != 0xFF;
+  }
+  else {
+    appendByte ( dataByte );
+    blockRemaining--;
+  }
+
+  return false;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedProtocol::receiveFrom ( Stream & stream ) {
+
+  uint16_t validFrames;
+  int      dataByte;
+
+  validFrames = 0;
+
+  while ( stream.available () > 0 ) {
+    dataByte = stream.read ();
+    if ( dataByte < 0 ) break;
+    if ( receiveByte ( dataByte ) ) validFrames++;
+  }
+
+  return validFrames;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedProtocol::setTimeSync ( CwwLedTimeSync * timeSync ) {
+
+  timeSyncPtr = timeSync;
+
+}
+
+// ============================================================================
+
+uint32_t CwwLedProtocol::valueOfFrameCount () {
+
+  return frameCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint32_t CwwLedProtocol::valueOfErrorCount () {
+
+  return errorCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint32_t CwwLedProtocol::valueOfCommandCount () {
+
+  return commandCount;
+
+}
+
+// ============================================================================
+
+uint16_t CwwLedProtocol::crcUpdate ( uint16_t crc, uint8_t dataByte ) {
+
+  uint8_t x;
+
+  // CRC-16/CCITT, polynomial 0x1021, one byte at a time without table...
+  x = ( crc >> 8 ) ^ dataByte;
+  x ^= x >> 4;
+
+  return ( crc << 8 ) ^ ( (uint16_t) x << 12 ) ^ ( (uint16_t) x << 5 ) ^ x;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedProtocol::appendByte ( uint8_t dataByte ) {
+
+  if ( frameLength >= sizeof ( frameBuffer ) ) {
+    frameIsBad = true;
+    return;
+  }
+
+  frameBuffer[frameLength++] = dataByte;
+  frameCrc = crcUpdate ( frameCrc, dataByte );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedProtocol::processFrame () {
+
+  cwwStructLedCommand command;
+  uint8_t             payloadEnd;
+  uint8_t             position;
+  uint16_t            commandSize;
+  uint8_t             levelIndex;
+  boolean             applyPass;
+
+  // The CRC over data and (big endian) CRC bytes leaves a zero remainder...
+  if ( frameCrc != 0 || frameLength < 3 || frameBuffer[0] != frameLength - 3 ) {
+    errorCount++;
+    return false;
+  }
+
+  payloadEnd = frameLength - 2;
+
+  // First pass validates all commands, so that a corrupt frame has no
+  // effect at all; second pass applies them as one bank frame...
+  for ( applyPass = false; ; applyPass = true ) {
+
+    if ( applyPass ) bankPtr->beginFrame ();
+
+    for ( position = 1; position < payloadEnd; position += commandSize ) {
+
+      switch ( frameBuffer[position] ) {
+        case LED_WIRE_MODE:     commandSize = 3; break;
+        case LED_WIRE_MODE_EX:  commandSize = 6; break;
+        case LED_WIRE_LEVEL:    commandSize = 3; break;
+        case LED_WIRE_SEQUENCE: commandSize = 3; break;
+        case LED_WIRE_TIME:     commandSize = 6; break;
+        case LED_WIRE_LEVELS:
+          commandSize = position + 2 < payloadEnd ? 3 + frameBuffer[position + 2] : 3;
+          break;
+        default:
+          errorCount++;
+          return false;
+      }
+
+      if ( position + commandSize > payloadEnd ) {
+        errorCount++;
+        return false;
+      }
+
+      if ( ! applyPass ) {
+        if ( ( frameBuffer[position] == LED_WIRE_MODE || frameBuffer[position] == LED_WIRE_MODE_EX )
+          && frameBuffer[position + 2] >= LED_MODE_COUNT ) {
+          errorCount++;
+          return false;
+        }
+        continue;
+      }
+
+      command.channel = frameBuffer[position + 1];
+
+      switch ( frameBuffer[position] ) {
+
+        case LED_WIRE_MODE:
+        case LED_WIRE_MODE_EX:
+          command.command = LED_COMMAND_MODE;
+          command.mode    = frameBuffer[position + 2];
+          if ( frameBuffer[position] == LED_WIRE_MODE_EX ) {
+            command.phaseCount = frameBuffer[position + 3] | ( (uint16_t) frameBuffer[position + 4] << 8 );
+            command.stepAmount = frameBuffer[position + 5];
+          }
+          else {
+            command.phaseCount = 0;
+            command.stepAmount = 0;
+          }
+          if ( bankPtr->applyCommand ( command ) ) commandCount++;
+          break;
+
+        case LED_WIRE_LEVEL:
+          command.command = LED_COMMAND_LEVEL;
+          command.level   = frameBuffer[position + 2];
+          if ( bankPtr->applyCommand ( command ) ) commandCount++;
+          break;
+
+        case LED_WIRE_LEVELS:
+          command.command = LED_COMMAND_LEVEL;
+          for ( levelIndex = 0; levelIndex < frameBuffer[position + 2]; levelIndex++ ) {
+            command.level = frameBuffer[position + 3 + levelIndex];
+            if ( bankPtr->applyCommand ( command ) ) commandCount++;
+            command.channel++;
+          }
+          break;
+
+        case LED_WIRE_SEQUENCE:
+          command.command = frameBuffer[position + 2] ? LED_COMMAND_START_SEQUENCE : LED_COMMAND_STOP_SEQUENCE;
+          if ( bankPtr->applyCommand ( command ) ) commandCount++;
+          break;
+
+        case LED_WIRE_TIME:
+          if ( timeSyncPtr != NULL ) {
+            timeSyncPtr->receiveBeacon ( frameBuffer[position + 1],
+                                            (unsigned long) frameBuffer[position + 2]
+                                         | ( (unsigned long) frameBuffer[position + 3] <<  8 )
+                                         | ( (unsigned long) frameBuffer[position + 4] << 16 )
+                                         | ( (unsigned long) frameBuffer[position + 5] << 24 ) );
+            commandCount++;
+          }
+          break;
+
+      }
+
+    }
+
+    if ( applyPass ) break;
+
+  }
+
+  bankPtr->commitFrame ();
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedProtocol::resetFrame () {
+
+  frameLength    = 0;
+  blockRemaining = 0;
+  blockAddsZero  = false;
+  frameIsBad     = false;
+  frameCrc       = PROTOCOL_CRC_INIT;
+
+}
+
+// ****************************************************************************
+// LED Protocol Encoder Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedProtocolEncoder::CwwLedProtocolEncoder () {
+
+  payloadLength = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedProtocolEncoder::~CwwLedProtocolEncoder () {
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+void CwwLedProtocolEncoder::beginFrame () {
+
+  payloadLength = 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedProtocolEncoder::addMode (
+  uint8_t        channel,
+  cwwEnumLedMode mode,
+  uint16_t       phaseCount,
+  uint8_t        stepAmount
+) {
+
+  if ( phaseCount == 0 && stepAmount == 0 ) {
+    if ( ! hasRoom ( 3 ) ) return false;
+    payload[payloadLength++] = LED_WIRE_MODE;
+    payload[payloadLength++] = channel;
+    payload[payloadLength++] = mode;
+  }
+  else {
+    if ( ! hasRoom ( 6 ) ) return false;
+    payload[payloadLength++] = LED_WIRE_MODE_EX;
+    payload[payloadLength++] = channel;
+    payload[payloadLength++] = mode;
+    payload[payloadLength++] = phaseCount & 0xFF;
+    payload[payloadLength++] = phaseCount >> 8;
+    payload[payloadLength++] = stepAmount;
+  }
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedProtocolEncoder::addLevel ( uint8_t channel, uint8_t level ) {
+
+  if ( ! hasRoom ( 3 ) ) return false;
+
+  payload[payloadLength++] = LED_WIRE_LEVEL;
+  payload[payloadLength++] = channel;
+  payload[payloadLength++] = level;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedProtocolEncoder::addLevels (
+  uint8_t         firstChannel,
+  uint8_t         count,
+  const uint8_t * levels
+) {
+
+  if ( ! hasRoom ( 3 + (uint16_t) count ) ) return false;
+
+  payload[payloadLength++] = LED_WIRE_LEVELS;
+  payload[payloadLength++] = firstChannel;
+  payload[payloadLength++] = count;
+  memcpy ( payload + payloadLength, levels, count );
+  payloadLength += count;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedProtocolEncoder::addSequence ( uint8_t channel, boolean start ) {
+
+  if ( ! hasRoom ( 3 ) ) return false;
+
+  payload[payloadLength++] = LED_WIRE_SEQUENCE;
+  payload[payloadLength++] = channel;
+  payload[payloadLength++] = start ? 1 : 0;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedProtocolEncoder::addTime ( uint8_t sequence, unsigned long time ) {
+
+  if ( ! hasRoom ( 6 ) ) return false;
+
+  payload[payloadLength++] = LED_WIRE_TIME;
+  payload[payloadLength++] = sequence;
+  payload[payloadLength++] =   time         & 0xFF;
+  payload[payloadLength++] = ( time >>  8 ) & 0xFF;
+  payload[payloadLength++] = ( time >> 16 ) & 0xFF;
+  payload[payloadLength++] = ( time >> 24 ) & 0xFF;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedProtocolEncoder::finishFrame ( uint8_t * encodedFrame ) {
+
+  uint16_t crc;
+  uint16_t frameLength;
+  uint16_t frameIndex;
+  uint8_t  dataByte;
+  uint8_t  codeIndex;
+  uint8_t  encodedLength;
+  uint8_t  code;
+
+  crc = PROTOCOL_CRC_INIT;
+  crc = CwwLedProtocol::crcUpdate ( crc, payloadLength );
+  for ( frameIndex = 0; frameIndex < payloadLength; frameIndex++ ) {
+    crc = CwwLedProtocol::crcUpdate ( crc, payload[frameIndex] );
+  }
+
+  // COBS encode length, payload and CRC in one pass...
+  frameLength   = payloadLength + 3;
+  codeIndex     = 0;
+  encodedLength = 1;
+  code          = 1;
+
+  for ( frameIndex = 0; frameIndex < frameLength; frameIndex++ ) {
+
+    if      ( frameIndex == 0               ) dataByte = payloadLength;
+    else if ( frameIndex == frameLength - 2 ) dataByte = crc >> 8;
+    else if ( frameIndex == frameLength - 1 ) dataByte = crc & 0xFF;
+    else                                      dataByte = payload[frameIndex - 1];
+
+    if ( dataByte == 0 ) {
+      encodedFrame[codeIndex] = code;
+      codeIndex = encodedLength++;
+      code = 1;
+    }
+    else {
+      encodedFrame[encodedLength++] = dataByte;
+      if ( ++code == 0xFF ) {
+        encodedFrame[codeIndex] = code;
+        codeIndex = encodedLength++;
+        code = 1;
+      }
+    }
+
+  }
+
+  encodedFrame[codeIndex]       = code;
+  encodedFrame[encodedLength++] = 0;
+
+  payloadLength = 0;
+
+  return encodedLength;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint8_t CwwLedProtocolEncoder::valueOfPayloadLength () {
+
+  return payloadLength;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+boolean CwwLedProtocolEncoder::hasRoom ( uint16_t byteCount ) {
+
+  return (uint16_t) payloadLength + byteCount <= CWW_LED_PROTOCOL_MAX_PAYLOAD;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,161 @@
+// ****************************************************************************
+//
+// LED Protocol Decoder and Encoder Classes
+// ----------------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedProtocol class receives LED commands in a framed binary format
+// (e.g. from a host PC over a UART) and applies them to the channels of a
+// CwwLedBank. The CwwLedProtocolEncoder class builds such frames (e.g. on
+// the host side).
+//
+// Frame format, before COBS encoding:
+//
+//   [length] [command] [command] ... [crc high] [crc low]
+//
+//   length: number of command bytes
+//   crc:    CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF) over
+//           the length and command bytes
+//
+// The frame is COBS encoded (consistent overhead byte stuffing), so that
+// it contains no zero bytes, and terminated by a single zero byte. A
+// receiver can thus always resynchronize at the next zero byte.
+//
+// Commands (channel is the channel index in the bank):
+//
+//   LED_WIRE_MODE      channel mode                          (3 bytes)
+//   LED_WIRE_MODE_EX   channel mode phaseLo phaseHi step     (6 bytes)
+//   LED_WIRE_LEVEL     channel level                         (3 bytes)
+//   LED_WIRE_LEVELS    firstChannel count level ...          (3 + count bytes)
+//   LED_WIRE_SEQUENCE  channel start (1) or stop (0)         (3 bytes)
+//   LED_WIRE_TIME      sequence time0 time1 time2 time3      (6 bytes)
+//
+// LED_WIRE_TIME is a time sync beacon: the timebase time of the sender in
+// ms (little endian) and a sequence number. It is passed on to the time
+// sync set with setTimeSync(), if any (see CwwLedTimeSync), at the moment
+// the frame is complete, and ignored otherwise.
+//
+// The decoder removes the COBS encoding and checks the CRC while bytes
+// arrive, writing each byte exactly once into its frame buffer. Complete
+// frames are then parsed in place and all their commands applied as one
+// bank frame; there is no copying and no dynamic memory.
+//
+// ****************************************************************************
+
+#ifndef CwwLedProtocol_h
+#define CwwLedProtocol_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+
+class CwwLedTimeSync;
+
+// ============================================================================
+
+#ifndef CWW_LED_PROTOCOL_MAX_PAYLOAD
+#define CWW_LED_PROTOCOL_MAX_PAYLOAD  64  // command bytes per frame; at most 250
+#endif
+
+#define CWW_LED_PROTOCOL_MAX_FRAME  ( CWW_LED_PROTOCOL_MAX_PAYLOAD + 3 + ( CWW_LED_PROTOCOL_MAX_PAYLOAD + 3 ) / 254 + 2 )
+// Maximum size of an encoded frame including COBS overhead and delimiter
+
+enum cwwEnumLedWireCommand {
+  LED_WIRE_MODE     = 0x01,
+  LED_WIRE_MODE_EX  = 0x02,
+  LED_WIRE_LEVEL    = 0x03,
+  LED_WIRE_LEVELS   = 0x04,
+  LED_WIRE_SEQUENCE = 0x05,
+  LED_WIRE_TIME     = 0x06
+};
+
+// ============================================================================
+
+class CwwLedProtocol {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedProtocol ( CwwLedBank & bank );
+    virtual ~CwwLedProtocol ();
+
+    boolean  receiveByte ( uint8_t dataByte );  // true if byte completed a valid frame
+    uint16_t receiveFrom ( Stream & stream );   // process all available bytes; returns valid frames
+
+    void setTimeSync ( CwwLedTimeSync * timeSync );  // receiver of time beacons; NULL for none
+
+    uint32_t valueOfFrameCount   ();  // valid frames received
+    uint32_t valueOfErrorCount   ();  // frames rejected (overflow, CRC, length or command errors)
+    uint32_t valueOfCommandCount ();  // commands applied
+
+    static uint16_t crcUpdate ( uint16_t crc, uint8_t dataByte );
+
+  private:
+
+    // Private Variables:
+
+    CwwLedBank     * bankPtr;
+    CwwLedTimeSync * timeSyncPtr;
+
+    uint8_t  frameBuffer[CWW_LED_PROTOCOL_MAX_PAYLOAD + 3];  // decoded frame
+    uint8_t  frameLength;
+    uint8_t  blockRemaining;  // data bytes remaining in current COBS block
+    boolean  blockAddsZero;   // current COBS block is followed by an implicit zero
+    boolean  frameIsBad;
+    uint16_t frameCrc;
+
+    uint32_t frameCount;
+    uint32_t errorCount;
+    uint32_t commandCount;
+
+    // Private Functions:
+
+    void    appendByte   ( uint8_t dataByte );
+    boolean processFrame ();
+    void    resetFrame   ();
+
+};
+
+// ----------------------------------------------------------------------------
+
+class CwwLedProtocolEncoder {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedProtocolEncoder ();
+    virtual ~CwwLedProtocolEncoder ();
+
+    void    beginFrame  ();
+    boolean addMode     ( uint8_t channel, cwwEnumLedMode mode, uint16_t phaseCount = 0, uint8_t stepAmount = 0 );
+    boolean addLevel    ( uint8_t channel, uint8_t level );
+    boolean addLevels   ( uint8_t firstChannel, uint8_t count, const uint8_t * levels );
+    boolean addSequence ( uint8_t channel, boolean start );
+    boolean addTime     ( uint8_t sequence, unsigned long time );
+    uint8_t finishFrame ( uint8_t * encodedFrame );  // buffer of CWW_LED_PROTOCOL_MAX_FRAME bytes; returns size
+
+    uint8_t valueOfPayloadLength ();
+
+  private:
+
+    // Private Variables:
+
+    uint8_t payload[CWW_LED_PROTOCOL_MAX_PAYLOAD];
+    uint8_t payloadLength;
+
+    // Private Functions:
+
+    boolean hasRoom ( uint16_t byteCount );
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
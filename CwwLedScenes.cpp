@@ -0,0 +1,526 @@
+// ****************************************************************************
+//
+// LED Scenes Class
+// ----------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedScenes, which recalls scenes stored as
+// delta lists against each other on a bank, optionally crossfading.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedScenes.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(address)  ( * (const uint8_t *) ( address ) )  // cores without program memory space
+#endif
+
+#define SCENE_MAX_SCENES     254   // LED_SCENE_NONE is not an index
+#define SCENE_STATE_UNKNOWN  0xFE  // applied state of a channel not set by a scene
+
+// ****************************************************************************
+// LED Scenes Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedScenes::CwwLedScenes (
+  CwwLedBank & bank,
+  uint8_t      sceneCapacity
+) {
+
+  if ( sceneCapacity > SCENE_MAX_SCENES ) sceneCapacity = SCENE_MAX_SCENES;
+
+  this->bankPtr         = &bank;
+  this->channelCapacity = bank.valueOfChannelCapacity ();
+
+  this->scenes        = new structScene [ sceneCapacity ];
+  this->sceneCapacity = sceneCapacity;
+  this->sceneCount    = 0;
+  this->currentScene  = LED_SCENE_NONE;
+
+  this->appliedStates = new uint8_t [ channelCapacity ];
+  this->appliedLevels = new uint8_t [ channelCapacity ];
+  this->channelMarks  = new uint8_t [ ( channelCapacity + 7 ) / 8 ];
+  memset ( this->appliedStates, SCENE_STATE_UNKNOWN, channelCapacity );
+  memset ( this->appliedLevels, 0, channelCapacity );
+  memset ( this->channelMarks, 0, ( channelCapacity + 7 ) / 8 );
+
+  this->fadeChannels    = new uint16_t [ channelCapacity ];
+  this->fadeFroms       = new uint8_t  [ channelCapacity ];
+  this->fadeDeltas      = new int16_t  [ channelCapacity ];
+  this->fadeGroupOf     = new uint8_t  [ channelCapacity ];
+  this->fadeCount       = 0;
+  this->recallGroup     = 0;
+  this->recallUpMs      = 0;
+  this->recallDownMs    = 0;
+  this->fadeRefreshTime = 0;
+  memset ( this->fadeGroups, 0, sizeof ( this->fadeGroups ) );
+  this->refreshInterval = 20;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedScenes::~CwwLedScenes () {
+
+  delete [] scenes;
+  delete [] appliedStates;
+  delete [] appliedLevels;
+  delete [] channelMarks;
+  delete [] fadeChannels;
+  delete [] fadeFroms;
+  delete [] fadeDeltas;
+  delete [] fadeGroupOf;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+uint8_t CwwLedScenes::addScene (
+  const cwwStructLedSceneEntry * entries,
+  uint16_t                       entryCount,
+  uint8_t                        baseScene
+) {
+
+  uint16_t entryIndex;
+  uint16_t channelIndex;
+  uint8_t  state;
+  structScene * scenePtr;
+
+  if ( sceneCount >= sceneCapacity ) return LED_SCENE_NONE;
+  if ( baseScene != LED_SCENE_NONE && baseScene >= sceneCount ) return LED_SCENE_NONE;
+  if ( baseScene != LED_SCENE_NONE && scenes[baseScene].depth == 255 ) return LED_SCENE_NONE;
+
+  for ( entryIndex = 0; entryIndex < entryCount; entryIndex++ ) {
+    channelIndex = channelOf ( &entries[entryIndex] );
+    state        = pgm_read_byte ( &entries[entryIndex].state );
+    if ( channelIndex >= channelCapacity ) return LED_SCENE_NONE;
+    if ( entryIndex > 0 && channelIndex <= channelOf ( &entries[entryIndex - 1] ) ) return LED_SCENE_NONE;
+    if ( state >= LED_MODE_COUNT && state != LED_SCENE_LEVEL ) return LED_SCENE_NONE;
+  }
+
+  scenePtr = &scenes[sceneCount];
+  scenePtr->entries    = entries;
+  scenePtr->entryCount = entryCount;
+  scenePtr->baseScene  = baseScene;
+  scenePtr->depth      = baseScene != LED_SCENE_NONE ? scenes[baseScene].depth + 1 : 0;
+
+  return sceneCount++;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint16_t CwwLedScenes::recall ( uint8_t sceneIndex, uint16_t fadeMs ) {
+
+  return recall ( sceneIndex, fadeMs, fadeMs );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedScenes::recall (
+  uint8_t  sceneIndex,
+  uint16_t fadeUpMs,
+  uint16_t fadeDownMs
+) {
+
+  uint8_t  fromScene;
+  uint8_t  toScene;
+  uint8_t  baseScene;
+  uint16_t fadeIndex;
+  uint16_t keptCount;
+  uint16_t channelIndex;
+  uint8_t  groupIndex;
+  uint8_t  levelTo;
+  uint8_t  state;
+  uint8_t  level;
+  uint16_t changedCount;
+  unsigned long timeNow;
+  CwwLedController * controllerPtr;
+
+  if ( sceneIndex >= sceneCount || sceneIndex == currentScene ) return 0;
+
+  // Scene both the current and the recalled scene are based on, if any;
+  // only the delta lists below it differ...
+  baseScene = LED_SCENE_NONE;
+  if ( currentScene != LED_SCENE_NONE ) {
+    fromScene = currentScene;
+    toScene   = sceneIndex;
+    while ( scenes[fromScene].depth > scenes[toScene].depth ) fromScene = scenes[fromScene].baseScene;
+    while ( scenes[toScene].depth > scenes[fromScene].depth ) toScene   = scenes[toScene].baseScene;
+    while ( fromScene != toScene ) {
+      fromScene = scenes[fromScene].baseScene;
+      toScene   = scenes[toScene].baseScene;
+    }
+    baseScene = fromScene;
+  }
+
+  markDeltas ( sceneIndex, baseScene );
+  if ( currentScene != LED_SCENE_NONE ) markDeltas ( currentScene, baseScene );
+
+  bankPtr->beginFrame ();
+
+  timeNow = CwwLedTimebase::now ();
+
+  // Channels still fading from an earlier recall, and not changed by this
+  // one, finish their fades as started. A channel this recall sets anew
+  // (a different value, or an applied state no longer known) gets a new
+  // entry, so its old one goes; a channel has one entry at most...
+  keptCount = 0;
+  for ( fadeIndex = 0; fadeIndex < fadeCount; fadeIndex++ ) {
+    channelIndex = fadeChannels[fadeIndex];
+    levelTo      = fadeFroms[fadeIndex] + fadeDeltas[fadeIndex];
+    if ( ( channelMarks[channelIndex >> 3] & ( 1 << ( channelIndex & 7 ) ) )
+      && resolveChannel ( channelIndex, sceneIndex, &state, &level )
+      && ( state != LED_SCENE_LEVEL || level != levelTo || appliedStates[channelIndex] == SCENE_STATE_UNKNOWN ) ) {
+      fadeGroups[fadeGroupOf[fadeIndex]].entryCount--;
+      continue;
+    }
+    fadeChannels[keptCount] = channelIndex;
+    fadeFroms[keptCount]    = fadeFroms[fadeIndex];
+    fadeDeltas[keptCount]   = fadeDeltas[fadeIndex];
+    fadeGroupOf[keptCount]  = fadeGroupOf[fadeIndex];
+    keptCount++;
+  }
+  fadeCount = keptCount;
+
+  // Fades of this recall go into a free group. With all groups in use, the
+  // oldest one is taken over: its channels go on from where they are, over
+  // the fade times of this recall...
+  recallUpMs   = fadeUpMs;
+  recallDownMs = fadeDownMs;
+  if ( fadeUpMs > 0 || fadeDownMs > 0 ) {
+    recallGroup = 0;
+    for ( groupIndex = 1; groupIndex < SCENE_FADE_GROUPS && fadeGroups[recallGroup].entryCount > 0; groupIndex++ ) {
+      if ( fadeGroups[groupIndex].entryCount == 0
+        || timeNow - fadeGroups[groupIndex].startTime > timeNow - fadeGroups[recallGroup].startTime ) recallGroup = groupIndex;
+    }
+    if ( fadeGroups[recallGroup].entryCount > 0 ) {
+      for ( fadeIndex = 0; fadeIndex < fadeCount; fadeIndex++ ) {
+        if ( fadeGroupOf[fadeIndex] != recallGroup ) continue;
+        controllerPtr         = bankPtr->channel ( fadeChannels[fadeIndex] );
+        levelTo               = fadeFroms[fadeIndex] + fadeDeltas[fadeIndex];
+        fadeFroms[fadeIndex]  = controllerPtr->currentLevel ();
+        fadeDeltas[fadeIndex] = (int16_t) levelTo - fadeFroms[fadeIndex];
+      }
+    }
+    fadeGroups[recallGroup].startTime = timeNow;
+    fadeGroups[recallGroup].upMs      = fadeUpMs;
+    fadeGroups[recallGroup].downMs    = fadeDownMs;
+  }
+
+  // The recalled side first, nearest scene first, so that its entries win;
+  // then the channels only the current side lists...
+  changedCount = applyDeltas ( sceneIndex, baseScene, false );
+  if ( currentScene != LED_SCENE_NONE ) changedCount += applyDeltas ( currentScene, baseScene, true );
+
+  currentScene = sceneIndex;
+
+  if ( ( fadeUpMs > 0 || fadeDownMs > 0 ) && fadeGroups[recallGroup].entryCount > 0 ) {
+    fadeRefreshTime = timeNow - refreshInterval;
+    updateNow ();
+  }
+
+  bankPtr->commitFrame ();
+
+  return changedCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedScenes::valueOfScene () {
+
+  return currentScene;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedScenes::invalidate () {
+
+  // Fades in progress stop where they are; the next recall sets every
+  // channel of its scene anew...
+  currentScene = LED_SCENE_NONE;
+  memset ( appliedStates, SCENE_STATE_UNKNOWN, channelCapacity );
+
+  fadeCount = 0;
+  memset ( fadeGroups, 0, sizeof ( fadeGroups ) );
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedScenes::isFading () {
+
+  return fadeCount > 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedScenes::updateIsDue () {
+
+  return fadeCount > 0 && CwwLedTimebase::now () - fadeRefreshTime >= refreshInterval;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedScenes::updateNow () {
+
+  unsigned long timeNow;
+  unsigned long elapsedTime;
+  uint32_t      fractionsUp[SCENE_FADE_GROUPS];
+  uint32_t      fractionsDown[SCENE_FADE_GROUPS];
+  uint32_t      fadeFraction;
+  uint8_t       groupIndex;
+  uint16_t      fadeIndex;
+  uint16_t      keptCount;
+  uint8_t       fadeLevel;
+  CwwLedController * controllerPtr;
+
+  if ( ! updateIsDue () ) return false;
+
+  timeNow         = CwwLedTimebase::now ();
+  fadeRefreshTime = timeNow;
+
+  // Share of each fade done for rising and falling levels, 16.16 fixed
+  // point; two divisions per group, whatever the number of channels...
+  for ( groupIndex = 0; groupIndex < SCENE_FADE_GROUPS; groupIndex++ ) {
+    if ( fadeGroups[groupIndex].entryCount == 0 ) continue;
+    elapsedTime = timeNow - fadeGroups[groupIndex].startTime;
+    fractionsUp[groupIndex]   = elapsedTime >= fadeGroups[groupIndex].upMs   ? 65536UL : ( elapsedTime << 16 ) / fadeGroups[groupIndex].upMs;
+    fractionsDown[groupIndex] = elapsedTime >= fadeGroups[groupIndex].downMs ? 65536UL : ( elapsedTime << 16 ) / fadeGroups[groupIndex].downMs;
+  }
+
+  bankPtr->beginFrame ();
+
+  // One pass over the fade table; finished entries are dropped on the way...
+  keptCount = 0;
+  for ( fadeIndex = 0; fadeIndex < fadeCount; fadeIndex++ ) {
+    groupIndex    = fadeGroupOf[fadeIndex];
+    fadeFraction  = fadeDeltas[fadeIndex] > 0 ? fractionsUp[groupIndex] : fractionsDown[groupIndex];
+    fadeLevel     = fadeFroms[fadeIndex] + (int16_t) ( ( (int32_t) fadeDeltas[fadeIndex] * (int32_t) fadeFraction ) >> 16 );
+    controllerPtr = bankPtr->channel ( fadeChannels[fadeIndex] );
+    if ( controllerPtr != NULL ) controllerPtr->setLevel ( fadeLevel );
+    if ( fadeFraction == 65536UL ) {
+      fadeGroups[groupIndex].entryCount--;
+      continue;
+    }
+    fadeChannels[keptCount] = fadeChannels[fadeIndex];
+    fadeFroms[keptCount]    = fadeFroms[fadeIndex];
+    fadeDeltas[keptCount]   = fadeDeltas[fadeIndex];
+    fadeGroupOf[keptCount]  = groupIndex;
+    keptCount++;
+  }
+  fadeCount = keptCount;
+
+  bankPtr->commitFrame ();
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedScenes::millisUntilUpdate () {
+
+  unsigned long elapsedTime;
+
+  if ( fadeCount == 0 ) return UPDATE_NOT_SCHEDULED;
+
+  elapsedTime = CwwLedTimebase::now () - fadeRefreshTime;
+
+  return elapsedTime >= refreshInterval ? 0 : refreshInterval - elapsedTime;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedScenes::setRefreshInterval ( uint16_t newInterval ) {
+
+  boolean setIsClean;
+
+  setIsClean = newInterval > 0;
+  refreshInterval = setIsClean ? newInterval : 1;
+
+  return setIsClean;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedScenes::valueOfRefreshInterval () {
+
+  return refreshInterval;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedScenes::markDeltas ( uint8_t fromScene, uint8_t toScene ) {
+
+  uint8_t  sceneIndex;
+  uint16_t entryIndex;
+  uint16_t channelIndex;
+
+  for ( sceneIndex = fromScene; sceneIndex != toScene; sceneIndex = scenes[sceneIndex].baseScene ) {
+    for ( entryIndex = 0; entryIndex < scenes[sceneIndex].entryCount; entryIndex++ ) {
+      channelIndex = channelOf ( &scenes[sceneIndex].entries[entryIndex] );
+      channelMarks[channelIndex >> 3] |= 1 << ( channelIndex & 7 );
+    }
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedScenes::applyDeltas (
+  uint8_t fromScene,
+  uint8_t toScene,
+  boolean resolveFromBase
+) {
+
+  uint8_t  sceneIndex;
+  uint16_t entryIndex;
+  uint16_t channelIndex;
+  uint8_t  state;
+  uint8_t  level;
+  uint16_t changedCount;
+  const cwwStructLedSceneEntry * entryPtr;
+
+  changedCount = 0;
+
+  // Each marked channel is applied once, at its first entry, and unmarked;
+  // all marks are clear again when both sides are done...
+  for ( sceneIndex = fromScene; sceneIndex != toScene; sceneIndex = scenes[sceneIndex].baseScene ) {
+    for ( entryIndex = 0; entryIndex < scenes[sceneIndex].entryCount; entryIndex++ ) {
+
+      entryPtr     = &scenes[sceneIndex].entries[entryIndex];
+      channelIndex = channelOf ( entryPtr );
+      if ( ! ( channelMarks[channelIndex >> 3] & ( 1 << ( channelIndex & 7 ) ) ) ) continue;
+      channelMarks[channelIndex >> 3] &= ~ ( 1 << ( channelIndex & 7 ) );
+
+      if ( resolveFromBase ) {
+        if ( ! resolveChannel ( channelIndex, toScene, &state, &level ) ) {
+          // Not set by the recalled scene; left as it is...
+          appliedStates[channelIndex] = SCENE_STATE_UNKNOWN;
+          continue;
+        }
+      }
+      else {
+        state = pgm_read_byte ( &entryPtr->state );
+        level = pgm_read_byte ( &entryPtr->level );
+      }
+
+      if ( applyChannel ( channelIndex, state, level ) ) changedCount++;
+
+    }
+  }
+
+  return changedCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedScenes::resolveChannel (
+  uint16_t  channelIndex,
+  uint8_t   sceneIndex,
+  uint8_t * statePtr,
+  uint8_t * levelPtr
+) {
+
+  uint16_t lowIndex;
+  uint16_t highIndex;
+  uint16_t midIndex;
+  uint16_t midChannel;
+  const cwwStructLedSceneEntry * entries;
+
+  // Nearest scene listing the channel; entries are sorted by channel...
+  for ( ; sceneIndex != LED_SCENE_NONE; sceneIndex = scenes[sceneIndex].baseScene ) {
+    entries   = scenes[sceneIndex].entries;
+    lowIndex  = 0;
+    highIndex = scenes[sceneIndex].entryCount;
+    while ( lowIndex < highIndex ) {
+      midIndex   = lowIndex + ( highIndex - lowIndex ) / 2;
+      midChannel = channelOf ( &entries[midIndex] );
+      if ( midChannel == channelIndex ) {
+        *statePtr = pgm_read_byte ( &entries[midIndex].state );
+        *levelPtr = pgm_read_byte ( &entries[midIndex].level );
+        return true;
+      }
+      if ( midChannel < channelIndex ) lowIndex  = midIndex + 1;
+      else                             highIndex = midIndex;
+    }
+  }
+
+  return false;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedScenes::applyChannel (
+  uint16_t channelIndex,
+  uint8_t  state,
+  uint8_t  level
+) {
+
+  CwwLedController * controllerPtr;
+  uint8_t            levelFrom;
+
+  if ( state == appliedStates[channelIndex] && ( state != LED_SCENE_LEVEL || level == appliedLevels[channelIndex] ) ) return false;
+
+  controllerPtr = bankPtr->channel ( channelIndex );
+  if ( controllerPtr == NULL ) return false;
+
+  appliedStates[channelIndex] = state;
+  appliedLevels[channelIndex] = level;
+
+  if ( state != LED_SCENE_LEVEL ) {
+    controllerPtr->setMode ( (cwwEnumLedMode) state );
+    return true;
+  }
+
+  levelFrom = controllerPtr->currentLevel ();
+  if ( ( level > levelFrom ? recallUpMs : recallDownMs ) > 0 ) {
+    fadeChannels[fadeCount] = channelIndex;
+    fadeFroms[fadeCount]    = levelFrom;
+    fadeDeltas[fadeCount]   = (int16_t) level - levelFrom;
+    fadeGroupOf[fadeCount]  = recallGroup;
+    fadeCount++;
+    fadeGroups[recallGroup].entryCount++;
+  }
+  else {
+    controllerPtr->setLevel ( level );
+  }
+
+  return true;
+
+}
+
+// ----------------------------------------------------------------------------
+
+uint16_t CwwLedScenes::channelOf ( const cwwStructLedSceneEntry * entryPtr ) {
+
+  return pgm_read_byte ( &entryPtr->channelLow ) | (uint16_t) pgm_read_byte ( &entryPtr->channelHigh ) << 8;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,171 @@
+// ****************************************************************************
+//
+// LED Scenes Class
+// ----------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedScenes class switches the channels of a CwwLedBank between
+// predefined scenes (e.g. idle, alarm, maintenance), each setting a mode
+// or a level for any number of channels.
+//
+// A scene is a constant table of entries (see cwwStructLedSceneEntry and
+// the CWW_LED_SCENE_MODE and CWW_LED_SCENE_LEVEL macros), sorted by
+// channel. It may be based on another scene, in which case it only lists
+// the channels that differ from its base scene (a delta list):
+//
+//   const cwwStructLedSceneEntry idleScene[] PROGMEM = {
+//     CWW_LED_SCENE_MODE  ( 0, LED_ON ),
+//     CWW_LED_SCENE_LEVEL ( 1, 40 ),
+//     ...                                   // all channels
+//   };
+//   const cwwStructLedSceneEntry alarmScene[] PROGMEM = {
+//     CWW_LED_SCENE_MODE  ( 0, LED_BLINK ), // only the channels that differ
+//   };
+//
+//   idle  = scenes.addScene ( idleScene,  sizeof ( idleScene  ) / sizeof ( idleScene[0]  ) );
+//   alarm = scenes.addScene ( alarmScene, sizeof ( alarmScene ) / sizeof ( alarmScene[0] ), idle );
+//
+// The tables are read in place (e.g. from flash; declare them PROGMEM on
+// AVR) and need to outlive the scenes. Channels a scene and its bases do
+// not list are left alone by the scene.
+//
+// Scenes based on each other form a tree. To recall a scene, only the
+// delta lists between the current scene and the recalled one are visited
+// (up to the scene both are based on), not the channels of the whole bank:
+// each listed channel is set once, to its value in the recalled scene, and
+// only if that differs from the value applied before. All changes are
+// applied as one bank frame, so every LED switches in the same frame.
+//
+// A recall may crossfade: levels then move from the current level of each
+// channel to their new levels over the given time, all in one integer
+// pass over a fade table per refresh (see updateNow); mode changes apply
+// at once. Rising and falling levels may fade over different times (a
+// split fade, as on lighting consoles). Channels still fading from an
+// earlier recall, and not changed by this one, finish their fades as
+// started; up to four fades with their own times run at once, after which
+// the oldest continues from where it is over the times of the new one.
+//
+// The scenes keep the values they applied; if channels are changed by
+// other means, invalidate() makes the next recall apply the whole scene.
+//
+// ****************************************************************************
+
+#ifndef CwwLedScenes_h
+#define CwwLedScenes_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+
+// ============================================================================
+
+#define LED_SCENE_NONE   0xFF  // no scene; see addScene, valueOfScene
+#define LED_SCENE_LEVEL  0xFF  // state of an entry setting a level
+
+struct cwwStructLedSceneEntry {
+  uint8_t channelLow;   // channel index in bank
+  uint8_t channelHigh;
+  uint8_t state;        // cwwEnumLedMode, or LED_SCENE_LEVEL
+  uint8_t level;        // for LED_SCENE_LEVEL
+};
+
+#define CWW_LED_SCENE_MODE(channel, mode)    { (uint8_t) ( (channel) & 0xFF ), (uint8_t) ( (channel) >> 8 ), (uint8_t) ( mode ), 0 }
+#define CWW_LED_SCENE_LEVEL(channel, level)  { (uint8_t) ( (channel) & 0xFF ), (uint8_t) ( (channel) >> 8 ), LED_SCENE_LEVEL, (uint8_t) ( level ) }
+
+// ============================================================================
+
+class CwwLedScenes {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedScenes ( CwwLedBank & bank,              // Bank to drive; channel capacity is fixed from here on
+                            uint8_t      sceneCapacity = 8  // Maximum number of scenes; at most 254
+                          );
+    virtual ~CwwLedScenes ();
+
+    uint8_t addScene ( const cwwStructLedSceneEntry * entries, uint16_t entryCount, uint8_t baseScene = LED_SCENE_NONE );
+    // Returns the index of the new scene; LED_SCENE_NONE if full, if the
+    // base scene does not exist, or if entries are not sorted by channel,
+    // name channels beyond the capacity of the bank or have invalid states.
+
+    uint16_t recall       ( uint8_t sceneIndex, uint16_t fadeMs = 0 );  // returns number of channels changed
+    uint16_t recall       ( uint8_t sceneIndex, uint16_t fadeUpMs, uint16_t fadeDownMs );  // split fade
+    uint8_t  valueOfScene ();  // scene recalled last; LED_SCENE_NONE if none
+    void     invalidate   ();  // next recall applies the whole scene; stops fades in progress
+
+    boolean       isFading          ();
+    boolean       updateIsDue       ();  // true if a crossfade needs a refresh
+    boolean       updateNow         ();  // refresh crossfade as one bank frame; true if refreshed
+    unsigned long millisUntilUpdate ();  // 0 if due; UPDATE_NOT_SCHEDULED if not fading
+
+    boolean  setRefreshInterval     ( uint16_t newInterval );  // interval in ms between crossfade refreshes; default 20
+    uint16_t valueOfRefreshInterval ();
+
+  private:
+
+    // Private Types:
+
+    enum { SCENE_FADE_GROUPS = 4 };  // fades with their own timing at once
+
+    struct structFadeGroup {
+      unsigned long startTime;
+      uint16_t      upMs;        // fade time of rising levels
+      uint16_t      downMs;      // fade time of falling levels
+      uint16_t      entryCount;  // fade table entries in group
+    };
+
+    struct structScene {
+      const cwwStructLedSceneEntry * entries;
+      uint16_t                       entryCount;
+      uint8_t                        baseScene;
+      uint8_t                        depth;       // number of base scenes
+    };
+
+    // Private Variables:
+
+    CwwLedBank * bankPtr;
+    uint16_t     channelCapacity;
+
+    structScene * scenes;
+    uint8_t       sceneCapacity;
+    uint8_t       sceneCount;
+    uint8_t       currentScene;
+
+    uint8_t * appliedStates;  // per channel: state applied last, if any
+    uint8_t * appliedLevels;  // per channel: level applied last, for LED_SCENE_LEVEL
+    uint8_t * channelMarks;   // per channel: one bit, set while a recall visits the channel
+
+    uint16_t      * fadeChannels;  // fade table: channel...
+    uint8_t       * fadeFroms;     // ...level at start of fade...
+    int16_t       * fadeDeltas;    // ...change of level over the fade...
+    uint8_t       * fadeGroupOf;   // ...and fade group
+    uint16_t        fadeCount;
+    structFadeGroup fadeGroups[SCENE_FADE_GROUPS];
+    uint8_t         recallGroup;   // fade group of recall in progress...
+    uint16_t        recallUpMs;    // ...and its fade times
+    uint16_t        recallDownMs;
+    unsigned long   fadeRefreshTime;
+    uint16_t        refreshInterval;
+
+    // Private Functions:
+
+    void     markDeltas     ( uint8_t fromScene, uint8_t toScene );
+    uint16_t applyDeltas    ( uint8_t fromScene, uint8_t toScene, boolean resolveFromBase );
+    boolean  resolveChannel ( uint16_t channelIndex, uint8_t sceneIndex, uint8_t * statePtr, uint8_t * levelPtr );
+    boolean  applyChannel   ( uint16_t channelIndex, uint8_t state, uint8_t level );
+
+    static uint16_t channelOf ( const cwwStructLedSceneEntry * entryPtr );
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
@@ -0,0 +1,188 @@
+// ****************************************************************************
+//
+// LED Sequence Builder Class Template
+// -----------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedSequenceBuilder class template builds LED sequence tables (see
+// CwwLedSequence::useTable) at compile time from constexpr expressions,
+// e.g.:
+//
+//   CWW_LED_SEQUENCE_TABLE ( heartbeat,
+//     CwwLedSequenceBuilder<>().on(0).off(100).on(200).off(100).repeat(3) );
+//
+//   sequence.useTable ( heartbeat.tableBytes () );
+//
+// Each function adds one step, with the same arguments as
+// CwwLedSequence::addStep and CwwLedSequence::addParamStep: the first
+// argument is the delay (in ms) preceding the step. The table is computed
+// entirely by the compiler and placed in program memory (flash); there is
+// no construction at run time and no dynamic memory.
+//
+// Invalid steps are compile time errors: the compiler reports a call to a
+// function that is not constexpr, whose name gives the reason (e.g.
+// sequenceErrorDelayTooLong for delays beyond SEQUENCE_TABLE_MAX_DELAY).
+// The table size is available as a constant, e.g. to keep patterns within
+// a flash budget:
+//
+//   static_assert ( decltype ( heartbeat )::byteSize <= 64, "pattern too large" );
+//
+// Requires C++11.
+//
+// ****************************************************************************
+
+#ifndef CwwLedSequenceBuilder_h
+#define CwwLedSequenceBuilder_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+
+// ============================================================================
+
+#ifndef PROGMEM
+#define PROGMEM  // cores without program memory space
+#endif
+
+#define CWW_LED_SEQUENCE_TABLE( tableName, builderExpression ) \
+  constexpr decltype ( builderExpression ) tableName PROGMEM = builderExpression
+// Defines a sequence table in program memory; builderExpression is
+// evaluated at compile time.
+
+// ============================================================================
+// Compile time error reporting: not constexpr, so reaching one of these in
+// a constant expression fails compilation...
+
+inline cwwStructLedPackedStep sequenceErrorDelayTooLong    () { return cwwStructLedPackedStep (); }
+inline cwwStructLedPackedStep sequenceErrorInvalidMode     () { return cwwStructLedPackedStep (); }
+inline cwwStructLedPackedStep sequenceErrorInvalidParam    () { return cwwStructLedPackedStep (); }
+inline cwwStructLedPackedStep sequenceErrorOperandTooLarge () { return cwwStructLedPackedStep (); }
+inline cwwStructLedPackedStep sequenceErrorParamValue      () { return cwwStructLedPackedStep (); }
+inline uint8_t                sequenceErrorRepeatTooLarge  () { return 1; }
+
+// ============================================================================
+// Index lists, for copying the steps of one builder into the next...
+
+template < uint16_t ... indexes >
+struct cwwStructLedIndexList {};
+
+template < uint16_t indexCount, uint16_t ... indexes >
+struct cwwStructLedIndexRange : cwwStructLedIndexRange < indexCount - 1, indexCount - 1, indexes ... > {};
+
+template < uint16_t ... indexes >
+struct cwwStructLedIndexRange < 0, indexes ... > {
+  typedef cwwStructLedIndexList < indexes ... > type;
+};
+
+// ============================================================================
+
+template < uint16_t stepTotal = 0 >
+class CwwLedSequenceBuilder {
+
+  template < uint16_t > friend class CwwLedSequenceBuilder;
+
+  public:
+
+    // Public Constants:
+
+    static const uint16_t stepCount = stepTotal;
+    static const uint16_t byteSize  = SEQUENCE_TABLE_HEADER_BYTES + stepTotal * SEQUENCE_TABLE_STEP_BYTES;
+
+    // Public Functions:
+
+    constexpr CwwLedSequenceBuilder ()
+      : stepCountLow ( stepTotal & 0xFF ), stepCountHigh ( stepTotal >> 8 ), repeatCount ( 1 ), steps {} {}
+
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > step ( unsigned long timeToStepMs, cwwEnumLedMode modeOfStep, uint16_t operandOfStep = 0 ) const {
+      return appendStep ( typename cwwStructLedIndexRange < stepTotal >::type (), packMode ( timeToStepMs, modeOfStep, operandOfStep ) );
+    }
+
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > param ( unsigned long timeToStepMs, cwwEnumLedParam paramOfStep, uint16_t valueOfStep ) const {
+      return appendStep ( typename cwwStructLedIndexRange < stepTotal >::type (), packParam ( timeToStepMs, paramOfStep, valueOfStep ) );
+    }
+
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > off        ( unsigned long timeToStepMs ) const { return step ( timeToStepMs, LED_OFF ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > on         ( unsigned long timeToStepMs ) const { return step ( timeToStepMs, LED_ON ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > low        ( unsigned long timeToStepMs ) const { return step ( timeToStepMs, LED_LOW ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > high       ( unsigned long timeToStepMs ) const { return step ( timeToStepMs, LED_HIGH ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > toggle     ( unsigned long timeToStepMs ) const { return step ( timeToStepMs, LED_TOGGLE ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > blink      ( unsigned long timeToStepMs, uint16_t phaseCount = 0 ) const { return step ( timeToStepMs, LED_BLINK, phaseCount ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > stepDown   ( unsigned long timeToStepMs, uint16_t stepAmount = 0 ) const { return step ( timeToStepMs, LED_STEP_DOWN, stepAmount ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > stepUp     ( unsigned long timeToStepMs, uint16_t stepAmount = 0 ) const { return step ( timeToStepMs, LED_STEP_UP, stepAmount ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > fadeDown   ( unsigned long timeToStepMs ) const { return step ( timeToStepMs, LED_FADE_DOWN ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > fadeUp     ( unsigned long timeToStepMs ) const { return step ( timeToStepMs, LED_FADE_UP ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > oscillate  ( unsigned long timeToStepMs, uint16_t phaseCount = 0 ) const { return step ( timeToStepMs, LED_OSCILLATE, phaseCount ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > hold       ( unsigned long timeToStepMs, uint16_t levelOfStep = 0 ) const { return step ( timeToStepMs, LED_HOLD_LEVEL, levelOfStep ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > envelopeOn  ( unsigned long timeToStepMs ) const { return step ( timeToStepMs, LED_ENVELOPE_ON ); }
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > envelopeOff ( unsigned long timeToStepMs ) const { return step ( timeToStepMs, LED_ENVELOPE_OFF ); }
+
+    constexpr CwwLedSequenceBuilder repeat ( unsigned int repeatCount ) const {
+      return withRepeat ( typename cwwStructLedIndexRange < stepTotal >::type (),
+                          repeatCount > 255 ? sequenceErrorRepeatTooLarge () : (uint8_t) repeatCount );
+    }
+
+    const uint8_t * tableBytes () const {
+      static_assert ( stepTotal == 0 || sizeof ( CwwLedSequenceBuilder ) == byteSize, "unexpected padding in sequence table" );
+      return &stepCountLow;
+    }
+
+    // For generators of whole tables (see CwwLedSequenceEncoder); steps
+    // are packed and checked by packMode and packParam...
+    template < typename ... tPackedSteps >
+    constexpr CwwLedSequenceBuilder ( uint8_t repeatCount, tPackedSteps ... packedSteps )
+      : stepCountLow ( stepTotal & 0xFF ), stepCountHigh ( stepTotal >> 8 ), repeatCount ( repeatCount ), steps { packedSteps ... } {}
+
+    static constexpr cwwStructLedPackedStep packMode ( unsigned long timeToStepMs, cwwEnumLedMode modeOfStep, uint16_t operandOfStep ) {
+      return timeToStepMs > SEQUENCE_TABLE_MAX_DELAY ? sequenceErrorDelayTooLong ()
+           : modeOfStep >= LED_MODE_COUNT            ? sequenceErrorInvalidMode ()
+           : ( modeOfStep == LED_STEP_DOWN || modeOfStep == LED_STEP_UP || modeOfStep == LED_HOLD_LEVEL ) && operandOfStep > 255
+                                                     ? sequenceErrorOperandTooLarge ()
+           : packStep ( timeToStepMs, modeOfStep, operandOfStep );
+    }
+
+    static constexpr cwwStructLedPackedStep packParam ( unsigned long timeToStepMs, cwwEnumLedParam paramOfStep, uint16_t valueOfStep ) {
+      return timeToStepMs > SEQUENCE_TABLE_MAX_DELAY ? sequenceErrorDelayTooLong ()
+           : paramOfStep > LED_PARAM_LEVEL_RANGE     ? sequenceErrorInvalidParam ()
+           : ( ( paramOfStep == LED_PARAM_BLINK_PERIOD || paramOfStep == LED_PARAM_OSCILLATE_PERIOD ) && valueOfStep < 2 )
+          || ( paramOfStep == LED_PARAM_REFRESH_INTERVAL && valueOfStep == 0 )
+          || ( ( paramOfStep == LED_PARAM_LEVEL_MIN || paramOfStep == LED_PARAM_LEVEL_MAX ) && valueOfStep > 255 )
+          || ( paramOfStep == LED_PARAM_LEVEL_RANGE && ( valueOfStep & 0xFF ) >= ( valueOfStep >> 8 ) )
+                                                     ? sequenceErrorParamValue ()
+           : packStep ( timeToStepMs, SEQUENCE_TABLE_PARAM_FLAG | paramOfStep, valueOfStep );
+    }
+
+  private:
+
+    // Private Variables (table layout; see SEQUENCE_TABLE_HEADER_BYTES):
+
+    uint8_t                stepCountLow;
+    uint8_t                stepCountHigh;
+    uint8_t                repeatCount;
+    cwwStructLedPackedStep steps[ stepTotal > 0 ? stepTotal : 1 ];
+
+    // Private Functions:
+
+    template < uint16_t ... indexes >
+    constexpr CwwLedSequenceBuilder < stepTotal + 1 > appendStep ( cwwStructLedIndexList < indexes ... >, cwwStructLedPackedStep newStep ) const {
+      return CwwLedSequenceBuilder < stepTotal + 1 > ( repeatCount, steps[indexes] ..., newStep );
+    }
+
+    template < uint16_t ... indexes >
+    constexpr CwwLedSequenceBuilder withRepeat ( cwwStructLedIndexList < indexes ... >, uint8_t repeatCount ) const {
+      return CwwLedSequenceBuilder ( repeatCount, steps[indexes] ... );
+    }
+
+    static constexpr cwwStructLedPackedStep packStep ( unsigned long timeToStepMs, uint8_t kindAndCode, uint16_t operandOfStep ) {
+      return cwwStructLedPackedStep { (uint8_t) ( timeToStepMs & 0xFF ), (uint8_t) ( timeToStepMs >> 8 ), kindAndCode,
+                                      (uint8_t) ( operandOfStep & 0xFF ), (uint8_t) ( operandOfStep >> 8 ) };
+    }
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
@@ -0,0 +1,100 @@
+// ****************************************************************************
+//
+// LED Sequence Encoder Class
+// --------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements the run time functions of class
+// CwwLedSequenceEncoder, which encodes Morse code and digit blink patterns
+// into LED sequences. The steps are the same as those of compile time
+// tables (see morseStep and digitsStep), computed in a single pass.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedSequenceEncoder.h>
+
+// ****************************************************************************
+// LED Sequence Encoder Class
+// ****************************************************************************
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+boolean CwwLedSequenceEncoder::fillMorse (
+  CwwLedSequence & sequence,
+  const char     * text,
+  uint16_t         unitMs
+) {
+
+  uint8_t morseCode;
+  uint8_t elementCount;
+  uint8_t elementIndex;
+  uint8_t gapUnits;
+
+  if ( sequence.valueOfAttachCount () > 0 ) return false;
+  if ( (unsigned long) unitMs * MORSE_WORD_UNITS > SEQUENCE_TABLE_MAX_DELAY ) return false;
+
+  sequence.discardAll ();
+
+  // The gap before each element is one element gap within a letter, and
+  // the gap pending from earlier characters before its first element
+  // (a word gap at the start and after spaces, else a letter gap)...
+  gapUnits = MORSE_WORD_UNITS;
+  for ( ; *text != 0; text++ ) {
+    morseCode    = morseCodeOf ( *text );
+    elementCount = morseCode >> 5;
+    for ( elementIndex = 0; elementIndex < elementCount; elementIndex++ ) {
+      sequence.addStep ( (unsigned long) unitMs * ( elementIndex == 0 ? gapUnits : MORSE_ELEMENT_UNITS ), LED_ON );
+      sequence.addStep ( (unsigned long) unitMs * ( ( morseCode >> elementIndex ) & 1 ? MORSE_DAH_UNITS : MORSE_DIT_UNITS ), LED_OFF );
+    }
+    if      ( *text == ' '      ) gapUnits = MORSE_WORD_UNITS;
+    else if ( elementCount > 0 ) gapUnits = MORSE_LETTER_UNITS;
+  }
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedSequenceEncoder::fillDigits (
+  CwwLedSequence & sequence,
+  unsigned long    statusCode,
+  uint16_t         unitMs
+) {
+
+  unsigned long digitDivisor;
+  uint8_t       blinkCount;
+  uint8_t       lastBlinkCount;
+  uint8_t       gapUnits;
+
+  if ( sequence.valueOfAttachCount () > 0 ) return false;
+  if ( (unsigned long) unitMs * ( 2 * blinksOf ( 0 ) - 1 + ( DIGITS_END_UNITS > DIGITS_GAP_UNITS ? DIGITS_END_UNITS : DIGITS_GAP_UNITS ) )
+       > SEQUENCE_TABLE_MAX_DELAY ) return false;
+
+  sequence.discardAll ();
+
+  sequence.addStep ( 0, LED_OFF );
+  sequence.addParamStep ( 0, LED_PARAM_BLINK_PERIOD, 2 * unitMs );
+
+  // Digits, most significant first; the delay before each covers the
+  // blinks of the one before (of the last digit, for the first)...
+  digitDivisor = 1;
+  while ( statusCode / digitDivisor >= 10 ) digitDivisor *= 10;
+  lastBlinkCount = blinksOf ( statusCode % 10 );
+  gapUnits       = DIGITS_END_UNITS;
+  for ( ; digitDivisor > 0; digitDivisor /= 10 ) {
+    blinkCount = blinksOf ( statusCode / digitDivisor % 10 );
+    sequence.addStep ( (unsigned long) unitMs * ( 2 * lastBlinkCount - 1 + gapUnits ), LED_BLINK_MAX, 2 * blinkCount );
+    lastBlinkCount = blinkCount;
+    gapUnits       = DIGITS_GAP_UNITS;
+  }
+
+  return true;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,181 @@
+// ****************************************************************************
+//
+// LED Sequence Encoder Class
+// --------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedSequenceEncoder class encodes text as Morse code and integer
+// status codes as digit blink patterns, either at compile time into a
+// sequence table (see CwwLedSequenceBuilder) or at run time into a
+// CwwLedSequence:
+//
+//   CWW_LED_SEQUENCE_TABLE ( sos, CWW_LED_MORSE ( "SOS", 100 ).repeat ( 0 ) );
+//   CWW_LED_SEQUENCE_TABLE ( error42, CWW_LED_DIGITS ( 42, 200 ) );
+//
+//   CwwLedSequenceEncoder::fillDigits ( sequence, errorCode, 200 );
+//
+// Timing is given as a unit in ms:
+//
+// - Morse: a dit is one unit on, a dah three; elements of a letter are
+//   separated by one unit off, letters by three, words (spaces) by seven.
+//   Letters, digits and spaces are encoded; other characters are ignored.
+//   Each element takes two steps (on, off).
+// - Digits: each decimal digit, most significant first, is shown as that
+//   many blinks (ten for zero) of one unit on and one unit off; digits are
+//   separated by DIGITS_GAP_UNITS off. The LED is switched off first (a
+//   blink toggles from the state it finds), and the blink period is set by
+//   a parameter step, so each digit takes a single step.
+//
+// Sequences start with the gap separating iterations (a word gap or
+// DIGITS_END_UNITS, counted from the end of the last blink of the code),
+// so that repeated codes remain readable.
+//
+// Requires C++11.
+//
+// ****************************************************************************
+
+#ifndef CwwLedSequenceEncoder_h
+#define CwwLedSequenceEncoder_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedSequenceBuilder.h>
+
+// ============================================================================
+
+#define MORSE_DIT_UNITS       1
+#define MORSE_DAH_UNITS       3
+#define MORSE_ELEMENT_UNITS   1  // gap between elements of a letter
+#define MORSE_LETTER_UNITS    3  // gap between letters
+#define MORSE_WORD_UNITS      7  // gap between words, and between iterations
+
+#define DIGITS_GAP_UNITS      5  // gap between digits
+#define DIGITS_END_UNITS     10  // gap between iterations
+
+#define CWW_LED_MORSE( text, unitMs ) \
+  CwwLedSequenceEncoder::morse < CwwLedSequenceEncoder::morseStepCount ( text ) > ( text, unitMs )
+
+#define CWW_LED_DIGITS( statusCode, unitMs ) \
+  CwwLedSequenceEncoder::digits < CwwLedSequenceEncoder::digitsStepCount ( statusCode ) > ( statusCode, unitMs )
+
+// ============================================================================
+
+class CwwLedSequenceEncoder {
+
+  public:
+
+    // Public Functions (compile time):
+
+    template < uint16_t stepTotal >
+    static constexpr CwwLedSequenceBuilder < stepTotal > morse ( const char * text, uint16_t unitMs ) {
+      return morseTable < stepTotal > ( typename cwwStructLedIndexRange < stepTotal >::type (), text, unitMs );
+    }
+
+    template < uint16_t stepTotal >
+    static constexpr CwwLedSequenceBuilder < stepTotal > digits ( unsigned long statusCode, uint16_t unitMs ) {
+      return digitsTable < stepTotal > ( typename cwwStructLedIndexRange < stepTotal >::type (), statusCode, unitMs );
+    }
+
+    static constexpr uint16_t morseStepCount ( const char * text ) {
+      return *text == 0 ? 0 : 2 * morseLengthOf ( *text ) + morseStepCount ( text + 1 );
+    }
+
+    static constexpr uint16_t digitsStepCount ( unsigned long statusCode ) {
+      return 2 + digitCountOf ( statusCode );
+    }
+
+    static constexpr cwwStructLedPackedStep morseStep ( const char * text, uint16_t stepIndex, uint16_t unitMs ) {
+      return stepIndex % 2 == 0
+        ? CwwLedSequenceBuilder<>::packMode ( (unsigned long) unitMs * morseGapBefore ( text, stepIndex / 2, MORSE_WORD_UNITS ), LED_ON, 0 )
+        : CwwLedSequenceBuilder<>::packMode ( (unsigned long) unitMs * ( morseIsDah ( text, stepIndex / 2 ) ? MORSE_DAH_UNITS : MORSE_DIT_UNITS ), LED_OFF, 0 );
+    }
+
+    static constexpr cwwStructLedPackedStep digitsStep ( unsigned long statusCode, uint16_t stepIndex, uint16_t unitMs ) {
+      return stepIndex == 0
+        ? CwwLedSequenceBuilder<>::packMode ( 0, LED_OFF, 0 )
+        : stepIndex == 1
+        ? CwwLedSequenceBuilder<>::packParam ( 0, LED_PARAM_BLINK_PERIOD, 2UL * unitMs > 0xFFFF ? 0 : 2 * unitMs )
+        : CwwLedSequenceBuilder<>::packMode ( (unsigned long) unitMs * ( stepIndex == 2
+                                                ? 2 * blinksOf ( digitAt ( statusCode, digitCountOf ( statusCode ) - 1 ) ) - 1 + DIGITS_END_UNITS
+                                                : 2 * blinksOf ( digitAt ( statusCode, stepIndex - 3 ) ) - 1 + DIGITS_GAP_UNITS ),
+                                              LED_BLINK_MAX, 2 * blinksOf ( digitAt ( statusCode, stepIndex - 2 ) ) );
+    }
+
+    // Public Functions (run time):
+
+    static boolean fillMorse  ( CwwLedSequence & sequence, const char * text, uint16_t unitMs );
+    static boolean fillDigits ( CwwLedSequence & sequence, unsigned long statusCode, uint16_t unitMs );
+    // Discard existing steps of sequence and add encoded steps; false if
+    // sequence is attached or unit is too long. These make a single pass
+    // over the text or code; the recursive constexpr helpers below are
+    // for compile time tables only (at run time, their time grows with the
+    // square of the text length, and their stack depth with the length).
+
+  private:
+
+    // Private Functions:
+
+    template < uint16_t stepTotal, uint16_t ... indexes >
+    static constexpr CwwLedSequenceBuilder < stepTotal > morseTable ( cwwStructLedIndexList < indexes ... >, const char * text, uint16_t unitMs ) {
+      return CwwLedSequenceBuilder < stepTotal > ( 1, morseStep ( text, indexes, unitMs ) ... );
+    }
+
+    template < uint16_t stepTotal, uint16_t ... indexes >
+    static constexpr CwwLedSequenceBuilder < stepTotal > digitsTable ( cwwStructLedIndexList < indexes ... >, unsigned long statusCode, uint16_t unitMs ) {
+      return CwwLedSequenceBuilder < stepTotal > ( 1, digitsStep ( statusCode, indexes, unitMs ) ... );
+    }
+
+    static constexpr uint8_t morseCodeOf ( char letter ) {
+      // Element count in bits 7..5, elements in bits 4..0 (first element
+      // in bit 0; 1 for dah); 0 for characters without code...
+      return letter >= 'a' && letter <= 'z' ? morseCodeOf ( letter - 'a' + 'A' )
+           : letter >= 'A' && letter <= 'Z' ? (uint8_t) "\102\201\205\141\040\204\143\200\100\216\145\202\103"
+                                                        "\101\147\206\213\142\140\041\144\210\146\211\215\203"[letter - 'A']
+           : letter >= '0' && letter <= '9' ? (uint8_t) "\277\276\274\270\260\240\241\243\247\257"[letter - '0']
+           : 0;
+    }
+
+    static constexpr uint8_t morseLengthOf ( char letter ) {
+      return morseCodeOf ( letter ) >> 5;
+    }
+
+    static constexpr boolean morseIsDah ( const char * text, uint16_t elementIndex ) {
+      return elementIndex < morseLengthOf ( *text )
+        ? ( morseCodeOf ( *text ) >> elementIndex ) & 1
+        : morseIsDah ( text + 1, elementIndex - morseLengthOf ( *text ) );
+    }
+
+    static constexpr uint8_t morseGapBefore ( const char * text, uint16_t elementIndex, uint8_t pendingUnits ) {
+      return elementIndex < morseLengthOf ( *text )
+        ? ( elementIndex == 0 ? pendingUnits : MORSE_ELEMENT_UNITS )
+        : morseGapBefore ( text + 1, elementIndex - morseLengthOf ( *text ),
+                           *text == ' ' ? MORSE_WORD_UNITS : morseLengthOf ( *text ) > 0 ? MORSE_LETTER_UNITS : pendingUnits );
+    }
+
+    static constexpr uint8_t digitCountOf ( unsigned long statusCode ) {
+      return statusCode < 10 ? 1 : 1 + digitCountOf ( statusCode / 10 );
+    }
+
+    static constexpr unsigned long powerOfTen ( uint8_t exponent ) {
+      return exponent == 0 ? 1 : 10 * powerOfTen ( exponent - 1 );
+    }
+
+    static constexpr uint8_t digitAt ( unsigned long statusCode, uint16_t digitIndex ) {
+      // digitIndex 0 is the most significant digit...
+      return statusCode / powerOfTen ( digitCountOf ( statusCode ) - 1 - digitIndex ) % 10;
+    }
+
+    static constexpr uint8_t blinksOf ( uint8_t digit ) {
+      return digit == 0 ? 10 : digit;
+    }
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
@@ -0,0 +1,243 @@
+// ****************************************************************************
+//
+// Linux Sysfs LED Output Class
+// ----------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedSysfs, an output backend for Linux LED
+// class devices with cached file descriptors and once-per-frame writes.
+//
+// ****************************************************************************
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Arduino.h>
+
+#include <CwwLedSysfs.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define SYSFS_PATH_MAX  256
+
+// ****************************************************************************
+// Linux Sysfs LED Output Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedSysfs::CwwLedSysfs (
+  uint8_t      ledCapacity,
+  const char * classPath
+) {
+
+  if ( ledCapacity >= CWW_LED_SYSFS_NO_CHANNEL ) ledCapacity = CWW_LED_SYSFS_NO_CHANNEL - 1;
+
+  this->classPath   = classPath;
+  this->leds        = new structSysfsLed [ ledCapacity ];
+  this->ledCapacity = ledCapacity;
+  this->ledCount    = 0;
+
+  frameIsOpen   = false;
+  levelsChanged = false;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedSysfs::~CwwLedSysfs () {
+
+  closeAll ();
+  delete [] leds;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+uint8_t CwwLedSysfs::addLed ( const char * ledName ) {
+
+  char             ledPath[SYSFS_PATH_MAX];
+  char             filePath[SYSFS_PATH_MAX];
+  structSysfsLed * ledPtr;
+  int              fd;
+
+  if ( ledCount >= ledCapacity ) return CWW_LED_SYSFS_NO_CHANNEL;
+
+  if ( strlen ( classPath ) + strlen ( ledName ) + 1 + sizeof ( "/max_brightness" ) > SYSFS_PATH_MAX ) {
+    return CWW_LED_SYSFS_NO_CHANNEL;
+  }
+
+  strcpy ( ledPath, classPath );
+  strcat ( ledPath, "/" );
+  strcat ( ledPath, ledName );
+
+  strcpy ( filePath, ledPath );
+  strcat ( filePath, "/brightness" );
+
+  fd = open ( filePath, O_WRONLY | O_CLOEXEC );
+  if ( fd < 0 ) return CWW_LED_SYSFS_NO_CHANNEL;
+
+  ledPtr = &leds[ledCount];
+  ledPtr->brightnessFd  = fd;
+  ledPtr->maxBrightness = readMaxBrightness ( ledPath );
+  ledPtr->pendingLevel  = 0;
+  ledPtr->writtenLevel  = -1;
+
+  return ledCount++;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSysfs::closeAll () {
+
+  uint8_t ledChannel;
+
+  for ( ledChannel = 0; ledChannel < ledCount; ledChannel++ ) {
+    close ( leds[ledChannel].brightnessFd );
+  }
+
+  ledCount = 0;
+
+}
+
+// ============================================================================
+
+void CwwLedSysfs::writeLevel ( uint8_t ledChannel, uint8_t ledLevel, boolean usePwm ) {
+
+  structSysfsLed * ledPtr;
+
+  if ( ledChannel >= ledCount ) return;
+
+  if ( ! usePwm && ledLevel > 0 ) ledLevel = 255;
+
+  ledPtr = &leds[ledChannel];
+  ledPtr->pendingLevel = ledLevel;
+
+  if ( ledPtr->writtenLevel == ledLevel ) return;
+
+  if ( frameIsOpen ) levelsChanged = true;
+  else               writeBrightness ( ledPtr );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSysfs::beginFrame () {
+
+  frameIsOpen = true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedSysfs::commitFrame () {
+
+  uint8_t ledChannel;
+
+  frameIsOpen = false;
+
+  if ( ! levelsChanged ) return;
+
+  for ( ledChannel = 0; ledChannel < ledCount; ledChannel++ ) {
+    if ( leds[ledChannel].writtenLevel != leds[ledChannel].pendingLevel ) {
+      writeBrightness ( &leds[ledChannel] );
+    }
+  }
+
+  levelsChanged = false;
+
+}
+
+// ============================================================================
+
+uint8_t CwwLedSysfs::valueOfLedCount () {
+
+  return ledCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedSysfs::valueOfMaxBrightness ( uint8_t ledChannel ) {
+
+  return ledChannel < ledCount ? leds[ledChannel].maxBrightness : 0;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedSysfs::writeBrightness ( structSysfsLed * ledPtr ) {
+
+  char     digits[7];
+  char   * digitPtr;
+  uint32_t brightness;
+
+  // Scale to device range, rounding to nearest...
+  brightness = ( (uint32_t) ledPtr->pendingLevel * ledPtr->maxBrightness + 127 ) / 255;
+
+  // Format decimal value back to front; cheaper than snprintf. The newline
+  // terminates the value for readers of a regular file standing in for
+  // sysfs, which pwrite() does not truncate...
+  digitPtr = digits + sizeof ( digits );
+  *--digitPtr = '\n';
+  do {
+    *--digitPtr = '0' + brightness % 10;
+    brightness /= 10;
+  } while ( brightness > 0 );
+
+  if ( pwrite ( ledPtr->brightnessFd, digitPtr, digits + sizeof ( digits ) - digitPtr, 0 ) > 0 ) {
+    ledPtr->writtenLevel = ledPtr->pendingLevel;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedSysfs::readMaxBrightness ( const char * ledPath ) {
+
+  char    filePath[SYSFS_PATH_MAX];
+  char    text[8];
+  int     fd;
+  ssize_t length;
+  long    maxBrightness;
+
+  strcpy ( filePath, ledPath );
+  strcat ( filePath, "/max_brightness" );
+
+  maxBrightness = 0;
+
+  fd = open ( filePath, O_RDONLY | O_CLOEXEC );
+  if ( fd >= 0 ) {
+    length = read ( fd, text, sizeof ( text ) - 1 );
+    if ( length > 0 ) {
+      text[length] = '\0';
+      maxBrightness = strtol ( text, NULL, 10 );
+    }
+    close ( fd );
+  }
+
+  // LED class default, if file is missing or unreadable...
+  if ( maxBrightness <= 0 || maxBrightness > 65535 ) maxBrightness = 255;
+
+  return maxBrightness;
+
+}
+
+// ****************************************************************************
+
+#endif  // __linux__
+
+// ****************************************************************************
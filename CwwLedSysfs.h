@@ -0,0 +1,99 @@
+// ****************************************************************************
+//
+// Linux Sysfs LED Output Class
+// ----------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedSysfs class is an output backend (see CwwLedOutput) for LEDs
+// of the Linux LED class, i.e. LEDs that appear as
+// /sys/class/leds/<name>/brightness. It is only available when building
+// for Linux (e.g. on embedded Linux gateways).
+//
+// LEDs are added by name (see addLed), which returns the channel number to
+// use with CwwLedController. The brightness file of each LED is opened
+// once and kept open; the maximum brightness is read once and levels are
+// scaled to it.
+//
+// Levels written between beginFrame() and commitFrame() (e.g. during
+// CwwLedBank::updateNow()) are collected, and each LED whose value
+// actually changed is written once, with a single pwrite(), at the end of
+// the frame. Outside of a frame, changed levels are written immediately.
+//
+// The class directory defaults to /sys/class/leds, but may be any
+// directory with the same layout (e.g. a temporary directory standing in
+// for sysfs).
+//
+// ****************************************************************************
+
+#ifndef CwwLedSysfs_h
+#define CwwLedSysfs_h
+
+#if defined(__linux__)
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+
+// ============================================================================
+
+#define CWW_LED_SYSFS_NO_CHANNEL  0xFF  // returned by addLed on failure
+
+// ============================================================================
+
+class CwwLedSysfs : public CwwLedOutput {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedSysfs ( uint8_t      ledCapacity = 16,                   // Maximum number of LEDs
+                           const char * classPath   = "/sys/class/leds"     // Directory containing LED class devices
+                         );
+    virtual ~CwwLedSysfs ();
+
+    uint8_t addLed ( const char * ledName );  // returns channel number or CWW_LED_SYSFS_NO_CHANNEL
+    void    closeAll ();
+
+    virtual void writeLevel  ( uint8_t ledChannel, uint8_t ledLevel, boolean usePwm );
+    virtual void beginFrame  ();
+    virtual void commitFrame ();  // write all changed levels
+
+    uint8_t  valueOfLedCount      ();
+    uint16_t valueOfMaxBrightness ( uint8_t ledChannel );
+
+  private:
+
+    // Private Types:
+
+    struct structSysfsLed {
+      int      brightnessFd;
+      uint16_t maxBrightness;
+      uint8_t  pendingLevel;
+      int16_t  writtenLevel;  // -1 if unknown
+    };
+
+    // Private Variables:
+
+    const char     * classPath;
+    structSysfsLed * leds;
+    uint8_t          ledCapacity;
+    uint8_t          ledCount;
+    boolean          frameIsOpen;
+    boolean          levelsChanged;
+
+    // Private Functions:
+
+    void     writeBrightness ( structSysfsLed * ledPtr );
+    uint16_t readMaxBrightness ( const char * ledPath );
+
+};
+
+// ****************************************************************************
+
+#endif  // __linux__
+
+#endif
+
+// ****************************************************************************
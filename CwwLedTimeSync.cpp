@@ -0,0 +1,321 @@
+// ****************************************************************************
+//
+// LED Time Sync Class
+// -------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedTimeSync, which locks the LED timebase
+// of a board to time beacons of a master board.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimeSync.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define SYNC_STEP_LIMIT_MS     1000  // offsets beyond step the timebase
+#define SYNC_LOCK_WINDOW_US    2000  // offsets within count towards lock
+#define SYNC_LOCK_BEACONS         4  // beacons within lock window to lock
+#define SYNC_GATE_US          16000  // offsets beyond are ignored while locked
+#define SYNC_REJECT_BEACONS       4  // beacons beyond gate to unlock
+#define SYNC_HOLD_BEACONS         4  // beacon periods without beacon to hold drift
+#define SYNC_DRIFT_BITS          24  // fraction bits of drift rate
+#define SYNC_DRIFT_LIMIT_SHIFT    5  // drift correction at most 1/32 of rate
+#define SYNC_SLEW_LIMIT_SHIFT     4  // offset correction at most 1/16 of rate
+#define SYNC_GEAR_SHIFTS          2  // slew time starts at 1/4 of the set one...
+#define SYNC_GEAR_BEACONS        32  // ...and doubles every 32 beacons
+
+// ****************************************************************************
+// LED Time Sync Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedTimeSync::CwwLedTimeSync ( unsigned long beaconPeriodMs ) {
+
+  this->beaconPeriodMs = beaconPeriodMs > 0 ? beaconPeriodMs : 1;
+  this->slewMs         = 4000;
+  this->linkDelayUs    = 0;
+
+  this->lastBeaconTime = 0;
+  this->beaconSequence = 0;
+
+  this->pendingMaster   = 0;
+  this->pendingTime     = 0;
+  this->pendingSequence = 0;
+  this->beaconIsPending = false;
+
+  this->timeIsSet       = false;
+  this->lastSequence    = 0;
+  this->lastReceiveTime = 0;
+  this->lockCount       = 0;
+  this->rejectCount     = 0;
+  this->stepCount       = 0;
+  this->trackCount      = 0;
+  this->offsetUs        = 0;
+  this->driftRate       = 0;
+  this->phaseRate       = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedTimeSync::~CwwLedTimeSync () {
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+boolean CwwLedTimeSync::beaconIsDue () {
+
+  return CwwLedTimebase::now () - lastBeaconTime >= beaconPeriodMs;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedTimeSync::addBeacon ( CwwLedProtocolEncoder & encoder ) {
+
+  unsigned long timeNow;
+
+  timeNow = CwwLedTimebase::now ();
+
+  if ( ! encoder.addTime ( beaconSequence, timeNow ) ) return false;
+
+  beaconSequence++;
+  lastBeaconTime = timeNow;
+
+  return true;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedTimeSync::receiveBeacon ( uint8_t sequence, unsigned long masterTime ) {
+
+  pendingTime     = CwwLedTimebase::now ();
+  pendingMaster   = masterTime;
+  pendingSequence = sequence;
+  beaconIsPending = true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedTimeSync::updateNow () {
+
+  unsigned long masterTime;
+  unsigned long receiveTime;
+  uint8_t       sequence;
+  long          offsetMs;
+  long          offsetNowUs;
+  unsigned long sinceLast;
+  unsigned long loopSlewMs;
+  uint8_t       gearShift;
+  int32_t       driftLimit;
+
+  if ( ! beaconIsPending ) {
+    // Hold the drift when beacons stop; the offset is no longer measured,
+    // so it is no longer corrected...
+    if ( timeIsSet && ( lockCount > 0 || phaseRate != 0 )
+      && CwwLedTimebase::now () - lastReceiveTime > SYNC_HOLD_BEACONS * beaconPeriodMs ) {
+      lockCount = 0;
+      phaseRate = 0;
+      setRate ();
+    }
+    return false;
+  }
+
+  noInterrupts ();
+  masterTime      = pendingMaster;
+  receiveTime     = pendingTime;
+  sequence        = pendingSequence;
+  beaconIsPending = false;
+  interrupts ();
+
+  if ( ! timeIsSet ) {
+    stepToMaster ( (long) ( masterTime - receiveTime ) * 1000L + linkDelayUs );
+    lastSequence = sequence;
+    return true;
+  }
+
+  // Repeated beacons (e.g. a frame sent twice) are ignored...
+  if ( sequence == lastSequence ) return false;
+  lastSequence = sequence;
+
+  offsetMs = (long) ( masterTime - receiveTime );
+  if ( labs ( offsetMs ) > SYNC_STEP_LIMIT_MS ) {
+    stepToMaster ( offsetMs * 1000L + linkDelayUs );
+    return true;
+  }
+  offsetNowUs = offsetMs * 1000L + linkDelayUs;
+
+  // While locked, beacons far off (e.g. read late) are ignored, unless
+  // they keep coming...
+  if ( lockCount >= SYNC_LOCK_BEACONS && labs ( offsetNowUs ) > SYNC_GATE_US ) {
+    if ( ++rejectCount < SYNC_REJECT_BEACONS ) return false;
+    lockCount = 0;
+  }
+  rejectCount = 0;
+  offsetUs    = offsetNowUs;
+
+  if ( labs ( offsetUs ) <= SYNC_LOCK_WINDOW_US ) {
+    if ( lockCount < 255 ) lockCount++;
+  }
+  else {
+    lockCount = 0;
+  }
+
+  sinceLast = receiveTime - lastReceiveTime;
+  if ( sinceLast > SYNC_HOLD_BEACONS * beaconPeriodMs ) sinceLast = SYNC_HOLD_BEACONS * beaconPeriodMs;
+  lastReceiveTime = receiveTime;
+
+  // Proportional-integral loop: the offset is slewed out over the slew time
+  // T, and accumulated into the drift with gain 1 / (4 T^2), for a critically
+  // damped response. T starts short and widens to the set slew time as
+  // beacons come in, so that the drift is found quickly...
+  gearShift = SYNC_GEAR_SHIFTS;
+  while ( gearShift > 0 && trackCount >= SYNC_GEAR_BEACONS * ( SYNC_GEAR_SHIFTS + 1 - gearShift ) ) gearShift--;
+  if ( trackCount < 255 ) trackCount++;
+
+  loopSlewMs = slewMs >> gearShift;
+  if ( loopSlewMs < 4 * beaconPeriodMs ) loopSlewMs = 4 * beaconPeriodMs;
+
+  driftRate += ( (int64_t) offsetUs * (long) sinceLast << SYNC_DRIFT_BITS ) / ( 4000 * (int64_t) loopSlewMs * (int64_t) loopSlewMs );
+  driftLimit = (int32_t) 1 << ( SYNC_DRIFT_BITS - SYNC_DRIFT_LIMIT_SHIFT );
+  if ( driftRate >  driftLimit ) driftRate =  driftLimit;
+  if ( driftRate < -driftLimit ) driftRate = -driftLimit;
+
+  phaseRate = ( (int64_t) offsetUs << 16 ) / ( 1000 * (int64_t) loopSlewMs );
+  if ( phaseRate >  (int32_t) ( TIMEBASE_RATE_NORMAL >> SYNC_SLEW_LIMIT_SHIFT ) ) phaseRate =  TIMEBASE_RATE_NORMAL >> SYNC_SLEW_LIMIT_SHIFT;
+  if ( phaseRate < -(int32_t) ( TIMEBASE_RATE_NORMAL >> SYNC_SLEW_LIMIT_SHIFT ) ) phaseRate = -(int32_t) ( TIMEBASE_RATE_NORMAL >> SYNC_SLEW_LIMIT_SHIFT );
+
+  setRate ();
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimeSync::release () {
+
+  timeIsSet   = false;
+  lockCount   = 0;
+  rejectCount = 0;
+  driftRate   = 0;
+  phaseRate   = 0;
+
+  CwwLedTimebase::setRate ( TIMEBASE_RATE_NORMAL );
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedTimeSync::setSlewTime ( unsigned long slewMs ) {
+
+  if ( slewMs < 1000 || slewMs > 60000 ) return false;
+
+  this->slewMs = slewMs;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedTimeSync::valueOfSlewTime () {
+
+  return slewMs;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimeSync::setLinkDelay ( uint16_t delayUs ) {
+
+  linkDelayUs = delayUs;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedTimeSync::isLocked () {
+
+  return timeIsSet && lockCount >= SYNC_LOCK_BEACONS;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+long CwwLedTimeSync::valueOfOffset () {
+
+  return offsetUs;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+long CwwLedTimeSync::valueOfDrift () {
+
+  return ( (int64_t) driftRate * 1000000L ) >> SYNC_DRIFT_BITS;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedTimeSync::valueOfStepCount () {
+
+  return stepCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedTimeSync::valueOfRejectCount () {
+
+  return rejectCount;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+void CwwLedTimeSync::stepToMaster ( long offsetUs ) {
+
+  // The step is rounded to whole ms; the rest is slewed out. The drift (if
+  // any) is kept, so a restarted master is followed at once...
+  CwwLedTimebase::stepTime ( offsetUs >= 0 ? ( offsetUs + 500 ) / 1000 : - ( ( 500 - offsetUs ) / 1000 ) );
+
+  if ( stepCount < 255 ) stepCount++;
+
+  timeIsSet       = true;
+  lastReceiveTime = CwwLedTimebase::now ();
+  lockCount       = 0;
+  rejectCount     = 0;
+  trackCount      = 0;
+  phaseRate       = 0;
+  this->offsetUs  = offsetUs;
+
+  setRate ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimeSync::setRate () {
+
+  CwwLedTimebase::setRate ( (int32_t) TIMEBASE_RATE_NORMAL + ( driftRate >> ( SYNC_DRIFT_BITS - 16 ) ) + phaseRate );
+
+}
+
+// ****************************************************************************
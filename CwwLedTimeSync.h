@@ -0,0 +1,140 @@
+// ****************************************************************************
+//
+// LED Time Sync Class
+// -------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedTimeSync class keeps the LED timebases of several boards in
+// step, e.g. boards on one RS485 bus, so that blink and oscillate phases
+// started together (e.g. by one broadcast frame) stay together, rather
+// than drifting apart with the tolerance of each board's oscillator
+// (a ceramic resonator may be off by 0.5%, i.e. a blink phase per minute
+// or so).
+//
+// One board is the master: it periodically adds a time beacon (its
+// timebase time) to a frame of the LED protocol (see CwwLedProtocol) and
+// sends it to all others:
+//
+//   if ( timeSync.beaconIsDue () ) {
+//     encoder.beginFrame ();
+//     timeSync.addBeacon ( encoder );
+//     Serial.write ( frameBytes, encoder.finishFrame ( frameBytes ) );
+//   }
+//
+// The other boards pass their time sync to their protocol decoder (see
+// CwwLedProtocol::setTimeSync), which hands it each beacon the moment the
+// frame is complete, and call updateNow() from the loop:
+//
+//   protocol.setTimeSync ( &timeSync );
+//   ...
+//   protocol.receiveFrom ( Serial );
+//   timeSync.updateNow ();
+//
+// The first beacon steps the timebase to the time of the master (see
+// CwwLedTimebase::stepTime). From then on, the difference between the two
+// (the offset) is measured at each beacon and fed to a phase locked loop,
+// which sets the rate of the timebase (see CwwLedTimebase::setRate):
+//
+// - a share of the offset, so that it is slewed out over the slew time
+//   (four seconds by default), without the time ever jumping, and
+// - the drift, the accumulated offset, so that a faster or slower
+//   oscillator is followed without lasting offset.
+//
+// The rate thus changes by at most a few percent, and only for a few
+// seconds after start; blink and oscillate periods do not visibly change.
+// Beacons far off the tracked time (e.g. read late when the loop was
+// busy) are ignored; a lasting offset of over a second (e.g. the master
+// restarted) makes the time step again. If beacons stop, the drift is
+// held, so the boards stay in step for a long time without them.
+//
+// Controllers started before the first beacon jump with the timebase;
+// start them once the time sync is locked (see isLocked), or restart them.
+// The time it takes to send a beacon (about 1 ms at 115200 baud) is the
+// same for all boards on a bus; it may be set with setLinkDelay() so that
+// they are also in step with the master. A time sync sets the timebase
+// rate, so it cannot be used together with a beat clock (see
+// CwwLedBeatClock).
+//
+// ****************************************************************************
+
+#ifndef CwwLedTimeSync_h
+#define CwwLedTimeSync_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedProtocol.h>
+
+// ============================================================================
+
+class CwwLedTimeSync {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedTimeSync ( unsigned long beaconPeriodMs = 250 );  // Beacon period of master
+    virtual ~CwwLedTimeSync ();
+
+    // Master:
+
+    boolean beaconIsDue ();
+    boolean addBeacon   ( CwwLedProtocolEncoder & encoder );  // add beacon with time now; false if no room
+
+    // Other boards:
+
+    void    receiveBeacon ( uint8_t sequence, unsigned long masterTime );  // from CwwLedProtocol
+    boolean updateNow     ();  // process latest beacon, set timebase rate; true if a beacon was processed
+    void    release       ();  // timebase back to rate 1 until next beacon
+
+    boolean       setSlewTime     ( unsigned long slewMs );  // 1000 to 60000 ms; default 4000
+    unsigned long valueOfSlewTime ();
+    void          setLinkDelay    ( uint16_t delayUs );      // time to send a beacon frame; default 0
+
+    boolean isLocked           ();  // offset within 2 ms for the last four beacons
+    long    valueOfOffset      ();  // offset at latest beacon in us; positive if behind master
+    long    valueOfDrift       ();  // drift compensated, in ppm; positive if local oscillator is slow
+    uint8_t valueOfStepCount   ();  // times the timebase was stepped; saturates
+    uint8_t valueOfRejectCount ();  // beacons ignored since the last accepted one
+
+  private:
+
+    // Private Variables:
+
+    unsigned long beaconPeriodMs;
+    unsigned long slewMs;
+    uint16_t      linkDelayUs;
+
+    unsigned long lastBeaconTime;   // master: timebase time of last beacon
+    uint8_t       beaconSequence;   // master: sequence number of next beacon
+
+    volatile unsigned long pendingMaster;    // latest beacon, as set by receiveBeacon()
+    volatile unsigned long pendingTime;      // timebase time the beacon was received
+    volatile uint8_t       pendingSequence;
+    volatile boolean       beaconIsPending;
+
+    boolean       timeIsSet;        // timebase was stepped to master time
+    uint8_t       lastSequence;
+    unsigned long lastReceiveTime;  // timebase time of last accepted beacon
+    uint8_t       lockCount;        // consecutive beacons within lock window; saturates
+    uint8_t       rejectCount;      // consecutive beacons outside gate
+    uint8_t       stepCount;
+    uint8_t       trackCount;       // beacons tracked since last step; saturates
+    long          offsetUs;
+    int32_t       driftRate;        // rate correction for drift; 8.24 fixed point
+    int32_t       phaseRate;        // rate correction for offset; 16.16 fixed point
+
+    // Private Functions:
+
+    void stepToMaster ( long offsetUs );
+    void setRate      ();
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
@@ -0,0 +1,142 @@
+// ****************************************************************************
+//
+// LED Timebase Class
+// ------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedTimebase, the clock shared by all LED
+// classes, with a replaceable time source and an adjustable rate.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+
+// ****************************************************************************
+// LED Timebase Class
+// ****************************************************************************
+
+cwwLedTimeSource CwwLedTimebase::timeSource     = NULL;
+cwwLedTimeSource CwwLedTimebase::microsSource   = NULL;
+uint32_t         CwwLedTimebase::timeRate       = TIMEBASE_RATE_NORMAL;
+unsigned long    CwwLedTimebase::anchorSource   = 0;
+unsigned long    CwwLedTimebase::anchorTime     = 0;
+uint16_t         CwwLedTimebase::anchorFraction = 0;
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+unsigned long CwwLedTimebase::now () {
+
+  unsigned long sourceTime;
+  uint64_t      scaledTime;
+
+  sourceTime = sourceNow ();
+
+  // Advance from the previous call, so that a change of rate applies from
+  // then on, and the product below stays small...
+  if ( timeRate == TIMEBASE_RATE_NORMAL ) {
+    anchorTime += sourceTime - anchorSource;
+  }
+  else {
+    scaledTime      = (uint64_t) ( sourceTime - anchorSource ) * timeRate + anchorFraction;
+    anchorTime     += (unsigned long) ( scaledTime >> 16 );
+    anchorFraction  = scaledTime & 0xFFFF;
+  }
+  anchorSource = sourceTime;
+
+  return anchorTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedTimebase::sourceNow () {
+
+  if ( timeSource != NULL ) return timeSource ();
+  else                      return millis ();
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedTimebase::setTimeSource ( cwwLedTimeSource timeSource ) {
+
+  CwwLedTimebase::timeSource = timeSource;
+
+  timeRate       = TIMEBASE_RATE_NORMAL;
+  anchorSource   = sourceNow ();
+  anchorTime     = anchorSource;
+  anchorFraction = 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwLedTimeSource CwwLedTimebase::valueOfTimeSource () {
+
+  return timeSource;
+
+}
+
+// ----------------------------------------------------------------------------
+
+unsigned long CwwLedTimebase::sourceMicros () {
+
+  // Without a source of its own, follow the time source if one is set...
+  if      ( microsSource != NULL ) return microsSource ();
+  else if ( timeSource   != NULL ) return timeSource () * 1000UL;
+  else                             return micros ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimebase::setMicrosSource ( cwwLedTimeSource microsSource ) {
+
+  CwwLedTimebase::microsSource = microsSource;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwLedTimeSource CwwLedTimebase::valueOfMicrosSource () {
+
+  return microsSource;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedTimebase::setRate ( uint32_t timeRate ) {
+
+  // Time up to now at the old rate...
+  now ();
+
+  if ( timeRate == 0 ) timeRate = 1;
+  CwwLedTimebase::timeRate = timeRate;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint32_t CwwLedTimebase::valueOfRate () {
+
+  return timeRate;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedTimebase::stepTime ( long stepMs ) {
+
+  // Time up to now, then the step on top...
+  now ();
+
+  anchorTime += stepMs;
+
+}
+
+// ****************************************************************************
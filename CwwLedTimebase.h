@@ -0,0 +1,97 @@
+// ****************************************************************************
+//
+// LED Timebase Class
+// ------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedTimebase class is the clock shared by all LED classes
+// (controllers, sequence players, timelines): they read the time with
+// CwwLedTimebase::now() rather than calling millis() directly.
+//
+// By default the time is millis(). A different time source may be set,
+// e.g. a virtual clock for soak tests that jump straight to the next due
+// update (see CwwLedController::millisUntilUpdate) and so run weeks of
+// operation in seconds:
+//
+//   unsigned long virtualTime;
+//   unsigned long virtualMillis () { return virtualTime; }
+//
+//   CwwLedTimebase::setTimeSource ( virtualMillis );
+//
+// Set the time source before starting anything that is timed; changing
+// it later makes time jump for everything in progress.
+//
+// Classes that need microseconds (e.g. CwwLedBeatClock) read them with
+// CwwLedTimebase::sourceMicros() rather than calling micros() directly.
+// By default this is micros(), or, once a time source is set, that time
+// source in ms times 1000, so that both stay on the same clock. A virtual
+// clock with microsecond resolution may be set with setMicrosSource.
+//
+// The timebase may also run faster or slower than its source (see
+// setRate), e.g. to follow the tempo of music (see CwwLedBeatClock): all
+// blink and oscillate periods, fades, sequence delays and timelines then
+// scale with it, without changing any of their parameters. Rate changes
+// take effect from the moment they are made; the time never jumps and
+// never runs backwards.
+//
+// The only exception is stepTime(), which moves the time by a given
+// amount at once, e.g. to take over the time of another board when first
+// synchronizing to it (see CwwLedTimeSync); like a change of time source,
+// it makes time jump for everything in progress.
+//
+// ****************************************************************************
+
+#ifndef CwwLedTimebase_h
+#define CwwLedTimebase_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+// ============================================================================
+
+typedef unsigned long ( * cwwLedTimeSource ) ();  // in ms, or in us for setMicrosSource
+
+#define TIMEBASE_RATE_NORMAL  65536UL  // rate 1.0; 16.16 fixed point
+
+// ============================================================================
+
+class CwwLedTimebase {
+
+  public:
+
+    // Public Functions:
+
+    static unsigned long now       ();  // current time in ms
+    static unsigned long sourceNow ();  // current time of the time source in ms, regardless of rate
+
+    static void             setTimeSource     ( cwwLedTimeSource timeSource );  // NULL for millis(); resets rate
+    static cwwLedTimeSource valueOfTimeSource ();
+
+    static unsigned long    sourceMicros        ();  // current time of the microsecond source in us, regardless of rate
+    static void             setMicrosSource     ( cwwLedTimeSource microsSource );  // NULL for default (see above)
+    static cwwLedTimeSource valueOfMicrosSource ();
+
+    static void     setRate     ( uint32_t timeRate );  // 16.16 fixed point; TIMEBASE_RATE_NORMAL is 1.0
+    static uint32_t valueOfRate ();
+
+    static void stepTime ( long stepMs );  // time jumps forward (or back) by stepMs
+
+  private:
+
+    // Private Variables:
+
+    static cwwLedTimeSource timeSource;
+    static cwwLedTimeSource microsSource;
+    static uint32_t         timeRate;
+    static unsigned long    anchorSource;    // source time of last now()
+    static unsigned long    anchorTime;      // time of last now()
+    static uint16_t         anchorFraction;  // fraction of a ms past anchorTime; 0.16 fixed point
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
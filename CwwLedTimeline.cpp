@@ -0,0 +1,413 @@
+// ****************************************************************************
+//
+// LED Timeline Class
+// ------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedTimeline, which drives the channels of
+// an LED bank from one column oriented, time sorted score.
+//
+// ****************************************************************************
+
+#include <string.h>
+#include <Arduino.h>
+
+#include <CwwLedTimeline.h>
+#include <CwwLedTimebase.h>
+
+// ============================================================================
+// Private Macros:
+// ============================================================================
+
+#define TIMELINE_COMMAND_FILLER         0xFF    // bridges gaps longer than a time delta
+#define TIMELINE_MAX_DELTA              0xFFFF  // ms; largest time delta of one event
+
+// ****************************************************************************
+// LED Timeline Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedTimeline::CwwLedTimeline (
+  CwwLedBank & bank,
+  uint16_t     eventCapacity,
+  uint8_t      maskCapacity
+) {
+
+  uint16_t maskBytes;
+
+  this->bankPtr = &bank;
+
+  this->eventCapacity = eventCapacity;
+  this->eventCount    = 0;
+  this->timeDeltas    = new uint16_t [ eventCapacity ];
+  this->maskIndexes   = new uint8_t  [ eventCapacity ];
+  this->commands      = new uint8_t  [ eventCapacity ];
+  this->values        = new uint8_t  [ eventCapacity ];
+  this->operands      = new uint16_t [ eventCapacity ];
+
+  maskBytes = ( bank.valueOfChannelCapacity () + 7 ) / 8;
+  if ( maskBytes > 255 ) maskBytes = 255;
+
+  this->maskCapacity = maskCapacity;
+  this->maskCount    = 0;
+  this->maskBytes    = maskBytes;
+  this->masks        = new uint8_t [ maskCapacity * maskBytes ];
+
+  this->lastEventTime = 0;
+  this->lengthMs      = 0;
+  this->repeatCount   = 1;
+
+  this->isActive       = false;
+  this->cursorIndex    = 0;
+  this->cursorTime     = 0;
+  this->startTime      = 0;
+  this->iterationCount = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedTimeline::~CwwLedTimeline () {
+
+  delete [] timeDeltas;
+  delete [] maskIndexes;
+  delete [] commands;
+  delete [] values;
+  delete [] operands;
+  delete [] masks;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+boolean CwwLedTimeline::addMode (
+  unsigned long   timeMs,
+  const uint8_t * channelMask,
+  cwwEnumLedMode  mode,
+  uint16_t        operand
+) {
+
+  return addEvent ( timeMs, channelMask, LED_COMMAND_MODE, mode, operand );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedTimeline::addLevel (
+  unsigned long   timeMs,
+  const uint8_t * channelMask,
+  uint8_t         level
+) {
+
+  return addEvent ( timeMs, channelMask, LED_COMMAND_LEVEL, level, 0 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedTimeline::addSequence (
+  unsigned long   timeMs,
+  const uint8_t * channelMask,
+  boolean         start
+) {
+
+  return addEvent ( timeMs, channelMask, start ? LED_COMMAND_START_SEQUENCE : LED_COMMAND_STOP_SEQUENCE, 0, 0 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimeline::discardAll () {
+
+  stop ();
+
+  eventCount    = 0;
+  maskCount     = 0;
+  lastEventTime = 0;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedTimeline::setLength ( unsigned long lengthMs ) {
+
+  this->lengthMs = lengthMs;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedTimeline::valueOfLength () {
+
+  return lengthMs > lastEventTime ? lengthMs : lastEventTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimeline::setRepeatCount ( uint8_t repeatCount ) {
+
+  this->repeatCount = repeatCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedTimeline::valueOfRepeatCount () {
+
+  return repeatCount;
+
+}
+
+// ============================================================================
+
+void CwwLedTimeline::start () {
+
+  isActive       = true;
+  cursorIndex    = 0;
+  cursorTime     = eventCount > 0 ? timeDeltas[0] : 0;
+  startTime      = CwwLedTimebase::now ();
+  iterationCount = 1;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimeline::stop () {
+
+  isActive = false;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedTimeline::isPlaying () {
+
+  return isActive;
+
+}
+
+// ============================================================================
+
+boolean CwwLedTimeline::updateIsDue () {
+
+  unsigned long elapsedTime;
+
+  if ( ! isActive ) return false;
+
+  elapsedTime = CwwLedTimebase::now () - startTime;
+
+  if ( cursorIndex < eventCount ) return elapsedTime >= cursorTime;
+  else                            return elapsedTime >= valueOfLength ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+unsigned long CwwLedTimeline::millisUntilUpdate () {
+
+  unsigned long elapsedTime;
+  unsigned long dueTime;
+
+  if ( ! isActive ) return UPDATE_NOT_SCHEDULED;
+
+  elapsedTime = CwwLedTimebase::now () - startTime;
+
+  if ( cursorIndex < eventCount ) dueTime = cursorTime;
+  else                            dueTime = valueOfLength ();
+
+  return elapsedTime >= dueTime ? 0 : dueTime - elapsedTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedTimeline::updateNow () {
+
+  unsigned long elapsedTime;
+  unsigned long iterationLength;
+  boolean       anyApplied;
+
+  if ( ! isActive ) return false;
+
+  elapsedTime = CwwLedTimebase::now () - startTime;
+  anyApplied  = false;
+
+  bankPtr->beginFrame ();
+
+  // All due events are applied in this one frame, however many; only an
+  // iteration of zero length, which would restart forever, ends the
+  // update (its events are then applied once per update)...
+  while ( isActive ) {
+
+    if ( cursorIndex < eventCount ) {
+
+      if ( elapsedTime < cursorTime ) break;
+
+      if ( applyEvent ( cursorIndex++ ) ) anyApplied = true;
+      if ( cursorIndex < eventCount ) cursorTime += timeDeltas[cursorIndex];
+
+    }
+    else {
+
+      iterationLength = valueOfLength ();
+      if ( elapsedTime < iterationLength ) break;
+
+      if ( ( repeatCount == 0 || iterationCount < repeatCount ) && ( eventCount > 0 || iterationLength > 0 ) ) {
+        // Next iteration starts where this one ended, not now, so that
+        // iterations do not drift...
+        startTime   += iterationLength;
+        elapsedTime -= iterationLength;
+        cursorIndex  = 0;
+        cursorTime   = eventCount > 0 ? timeDeltas[0] : 0;
+        if ( repeatCount > 0 ) iterationCount++;
+        if ( iterationLength == 0 ) break;
+      }
+      else {
+        isActive = false;
+      }
+
+    }
+
+  }
+
+  bankPtr->commitFrame ();
+
+  return anyApplied;
+
+}
+
+// ============================================================================
+
+uint16_t CwwLedTimeline::valueOfEventCount () {
+
+  return eventCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedTimeline::valueOfMaskCount () {
+
+  return maskCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint8_t CwwLedTimeline::valueOfMaskBytes () {
+
+  return maskBytes;
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+boolean CwwLedTimeline::addEvent (
+  unsigned long   timeMs,
+  const uint8_t * channelMask,
+  uint8_t         command,
+  uint8_t         value,
+  uint16_t        operand
+) {
+
+  unsigned long gapMs;
+  unsigned long fillerCount;
+  int16_t       maskIndex;
+
+  if ( timeMs < lastEventTime ) return false;
+
+  gapMs       = timeMs - lastEventTime;
+  fillerCount = gapMs > TIMELINE_MAX_DELTA ? ( gapMs - 1 ) / TIMELINE_MAX_DELTA : 0;
+  if ( (unsigned long) eventCount + fillerCount + 1 > eventCapacity ) return false;
+
+  maskIndex = findMask ( channelMask );
+  if ( maskIndex < 0 ) {
+    if ( maskCount >= maskCapacity ) return false;
+    maskIndex = maskCount++;
+    memcpy ( masks + maskIndex * maskBytes, channelMask, maskBytes );
+  }
+
+  while ( fillerCount-- > 0 ) {
+    timeDeltas[eventCount]  = TIMELINE_MAX_DELTA;
+    maskIndexes[eventCount] = 0;
+    commands[eventCount]    = TIMELINE_COMMAND_FILLER;
+    values[eventCount]      = 0;
+    operands[eventCount]    = 0;
+    eventCount++;
+    gapMs -= TIMELINE_MAX_DELTA;
+  }
+
+  timeDeltas[eventCount]  = gapMs;
+  maskIndexes[eventCount] = maskIndex;
+  commands[eventCount]    = command;
+  values[eventCount]      = value;
+  operands[eventCount]    = operand;
+  eventCount++;
+
+  lastEventTime = timeMs;
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+int16_t CwwLedTimeline::findMask ( const uint8_t * channelMask ) {
+
+  uint8_t maskIndex;
+
+  for ( maskIndex = 0; maskIndex < maskCount; maskIndex++ ) {
+    if ( memcmp ( masks + maskIndex * maskBytes, channelMask, maskBytes ) == 0 ) return maskIndex;
+  }
+
+  return -1;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedTimeline::applyEvent ( uint16_t eventIndex ) {
+
+  cwwStructLedCommand ledCommand;
+  const uint8_t     * maskPtr;
+  uint8_t             maskBits;
+  uint8_t             byteIndex;
+  uint16_t            channelIndex;
+
+  if ( commands[eventIndex] == TIMELINE_COMMAND_FILLER ) return false;
+
+  ledCommand.command    = commands[eventIndex];
+  ledCommand.mode       = values[eventIndex];
+  ledCommand.level      = values[eventIndex];
+  ledCommand.phaseCount = operands[eventIndex];
+  ledCommand.stepAmount = operands[eventIndex] > 255 ? 255 : operands[eventIndex];
+
+  // Visit only the set bits of the mask, skipping empty bytes entirely...
+  maskPtr = masks + maskIndexes[eventIndex] * maskBytes;
+
+  for ( byteIndex = 0; byteIndex < maskBytes; byteIndex++ ) {
+    maskBits     = maskPtr[byteIndex];
+    channelIndex = byteIndex * 8;
+    while ( maskBits != 0 ) {
+      if ( maskBits & 1 ) {
+        ledCommand.channel = channelIndex;
+        bankPtr->applyCommand ( ledCommand );
+      }
+      maskBits >>= 1;
+      channelIndex++;
+    }
+  }
+
+  return true;
+
+}
+
+// ****************************************************************************
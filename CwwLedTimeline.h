@@ -0,0 +1,123 @@
+// ****************************************************************************
+//
+// LED Timeline Class
+// ------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedTimeline class drives all channels of a CwwLedBank from one
+// score: a time sorted list of events, each applying one command (mode,
+// level, start or stop of a channel's sequence) to a set of channels given
+// by a channel mask (one bit per channel index, LSB first). A single cursor
+// walks the score, so the cost of an update is proportional to the number
+// of events due in that frame, not to the number of channels.
+//
+// The score is stored column by column, which keeps it compact:
+//
+// - times are stored as 16 bit deltas to the previous event (longer gaps
+//   are bridged by filler events),
+// - channel masks are stored once in a mask dictionary (shows tend to use
+//   a handful of channel groups over and over); each event holds an 8 bit
+//   index into this dictionary, and
+// - commands, values (mode or level) and operands are separate arrays.
+//
+// Operands of mode events have the same meaning as for sequence steps
+// (see CwwLedSequence::addStep): phase count for blink and oscillate
+// modes, step amount for step modes.
+//
+// Call updateNow() before CwwLedBank::updateNow() (or within a frame opened
+// with CwwLedBank::beginFrame()) so that the commands reach the output in
+// the same frame as the regular refresh.
+//
+// ****************************************************************************
+
+#ifndef CwwLedTimeline_h
+#define CwwLedTimeline_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+
+// ============================================================================
+
+class CwwLedTimeline {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedTimeline ( CwwLedBank & bank,         // Bank to drive; channel masks cover its channel capacity
+                              uint16_t     eventCapacity,  // Maximum number of events (including filler events)
+                              uint8_t      maskCapacity    // Maximum number of distinct channel masks
+                            );
+    virtual ~CwwLedTimeline ();
+
+    // Events must be added in order of non-decreasing time (ms from start of
+    // score); all add functions return false if the event could not be added.
+    boolean addMode      ( unsigned long timeMs, const uint8_t * channelMask, cwwEnumLedMode mode, uint16_t operand = 0 );
+    boolean addLevel     ( unsigned long timeMs, const uint8_t * channelMask, uint8_t level );
+    boolean addSequence  ( unsigned long timeMs, const uint8_t * channelMask, boolean start );
+    void    discardAll   ();
+
+    void          setLength     ( unsigned long lengthMs );  // length of one iteration; at least time of last event
+    unsigned long valueOfLength ();
+
+    void    setRepeatCount     ( uint8_t repeatCount );  // 0 for infinite
+    uint8_t valueOfRepeatCount ();
+
+    void    start     ();
+    void    stop      ();
+    boolean isPlaying ();
+
+    boolean       updateIsDue       ();  // true if an event is due
+    boolean       updateNow         ();  // apply all events due as one bank frame; true if any were applied
+    unsigned long millisUntilUpdate ();  // 0 if due; UPDATE_NOT_SCHEDULED if not playing
+
+    uint16_t valueOfEventCount ();
+    uint8_t  valueOfMaskCount  ();
+    uint8_t  valueOfMaskBytes  ();  // bytes per channel mask
+
+  private:
+
+    // Private Variables:
+
+    CwwLedBank * bankPtr;
+
+    uint16_t   eventCapacity;
+    uint16_t   eventCount;
+    uint16_t * timeDeltas;    // column: ms since previous event
+    uint8_t  * maskIndexes;   // column: index into mask dictionary
+    uint8_t  * commands;      // column: cwwEnumLedCommand, or filler
+    uint8_t  * values;        // column: mode or level
+    uint16_t * operands;      // column: phase count or step amount
+
+    uint8_t   maskCapacity;
+    uint8_t   maskCount;
+    uint8_t   maskBytes;
+    uint8_t * masks;          // mask dictionary; maskCapacity * maskBytes
+
+    unsigned long lastEventTime;
+    unsigned long lengthMs;
+    uint8_t       repeatCount;
+
+    boolean       isActive;
+    uint16_t      cursorIndex;
+    unsigned long cursorTime;     // score time of event at cursor
+    unsigned long startTime;      // time at start of current iteration (see CwwLedTimebase)
+    uint8_t       iterationCount;
+
+    // Private Functions:
+
+    boolean addEvent   ( unsigned long timeMs, const uint8_t * channelMask, uint8_t command, uint8_t value, uint16_t operand );
+    int16_t findMask   ( const uint8_t * channelMask );
+    boolean applyEvent ( uint16_t eventIndex );  // false for filler events
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
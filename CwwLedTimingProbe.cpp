@@ -0,0 +1,253 @@
+// ****************************************************************************
+//
+// LED Timing Probe Class
+// ----------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedTimingProbe, an output backend that
+// measures achieved blink and oscillate periods and fade durations and
+// collects their error against the configured timing.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimingProbe.h>
+#include <CwwLedTimebase.h>
+
+// ****************************************************************************
+// LED Timing Probe Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedTimingProbe::CwwLedTimingProbe (
+  uint8_t        ledChannel,
+  CwwLedOutput * forwardOutputPtr
+) {
+
+  this->ledChannel       = ledChannel;
+  this->forwardOutputPtr = forwardOutputPtr;
+
+  periodSamples.expectedMs = 0;
+  rampSamples.expectedMs   = 0;
+
+  reset ();
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedTimingProbe::~CwwLedTimingProbe () {
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+void CwwLedTimingProbe::expectPeriod ( unsigned long periodMs ) {
+
+  periodSamples.expectedMs = periodMs;
+  clearSamples ( periodSamples );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimingProbe::expectRamp ( unsigned long rampMs ) {
+
+  rampSamples.expectedMs = rampMs;
+  clearSamples ( rampSamples );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimingProbe::reset () {
+
+  clearSamples ( periodSamples );
+  clearSamples ( rampSamples );
+
+  lastLevel      = -1;
+  runDirection   = 0;
+  runChangeCount = 0;
+  turnSeen       = false;
+
+}
+
+// ----------------------------------------------------------------------------
+
+cwwStructLedTimingStats CwwLedTimingProbe::valueOfPeriodStats () {
+
+  return statsOf ( periodSamples );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwStructLedTimingStats CwwLedTimingProbe::valueOfRampStats () {
+
+  structTimingSamples samples;
+  unsigned long       stepInterval;
+
+  // A ramp that has stalled for more than two step intervals (e.g. a fade
+  // that has arrived) is complete; add it to a copy, so that it is not
+  // counted twice if it continues after all...
+  samples = rampSamples;
+  if ( runChangeCount >= 2 ) {
+    stepInterval = runSecondTime - runFirstTime;
+    if ( CwwLedTimebase::now () - runLastTime > 2 * stepInterval ) addSample ( samples, rampOfRun () );
+  }
+
+  return statsOf ( samples );
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedTimingProbe::writeLevel (
+  uint8_t ledChannel,
+  uint8_t ledLevel,
+  boolean usePwm
+) {
+
+  unsigned long currentTime;
+  int8_t        changeDirection;
+
+  if ( forwardOutputPtr != NULL ) forwardOutputPtr->writeLevel ( ledChannel, ledLevel, usePwm );
+
+  if ( ledChannel != this->ledChannel ) return;
+
+  if ( lastLevel < 0 ) {
+    lastLevel = ledLevel;
+    return;
+  }
+
+  // Rewrites of the same level (e.g. by setMode) are not changes...
+  if ( ledLevel == lastLevel ) return;
+
+  currentTime     = CwwLedTimebase::now ();
+  changeDirection = ledLevel > lastLevel ? 1 : -1;
+
+  if ( changeDirection != runDirection ) {
+
+    if ( runChangeCount >= 2 ) addSample ( rampSamples, rampOfRun () );
+
+    if ( changeDirection > 0 && runDirection < 0 ) {
+      if ( turnSeen ) addSample ( periodSamples, currentTime - lastTurnTime );
+      lastTurnTime = currentTime;
+      turnSeen     = true;
+    }
+
+    runDirection   = changeDirection;
+    runChangeCount = 1;
+    runFirstTime   = currentTime;
+
+  }
+  else {
+
+    if ( runChangeCount == 1 ) runSecondTime = currentTime;
+    if ( runChangeCount < 0xFFFF ) runChangeCount++;
+
+  }
+
+  runLastTime = currentTime;
+  lastLevel   = ledLevel;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimingProbe::beginFrame () {
+
+  if ( forwardOutputPtr != NULL ) forwardOutputPtr->beginFrame ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimingProbe::commitFrame () {
+
+  if ( forwardOutputPtr != NULL ) forwardOutputPtr->commitFrame ();
+
+}
+
+// ============================================================================
+// Private Functions
+// ============================================================================
+
+unsigned long CwwLedTimingProbe::rampOfRun () {
+
+  // Count one step interval (taken from the first two changes) before the
+  // first change, so that n steps measure n intervals...
+  return ( runLastTime - runFirstTime ) + ( runSecondTime - runFirstTime );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimingProbe::addSample (
+  structTimingSamples & samples,
+  unsigned long         measuredMs
+) {
+
+  if ( samples.sampleCount == 0xFFFF ) return;
+
+  if ( samples.sampleCount == 0 || measuredMs < samples.minMs ) samples.minMs = measuredMs;
+  if ( samples.sampleCount == 0 || measuredMs > samples.maxMs ) samples.maxMs = measuredMs;
+
+  samples.sampleCount++;
+  samples.sumMs += measuredMs;
+  if ( measuredMs >= samples.expectedMs ) samples.sumAbsErrorMs += measuredMs - samples.expectedMs;
+  else                                    samples.sumAbsErrorMs += samples.expectedMs - measuredMs;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTimingProbe::clearSamples ( structTimingSamples & samples ) {
+
+  samples.sampleCount   = 0;
+  samples.minMs         = 0;
+  samples.maxMs         = 0;
+  samples.sumMs         = 0;
+  samples.sumAbsErrorMs = 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+cwwStructLedTimingStats CwwLedTimingProbe::statsOf ( const structTimingSamples & samples ) {
+
+  cwwStructLedTimingStats stats;
+  unsigned long           minAbsErrorMs;
+
+  stats.sampleCount = samples.sampleCount;
+  stats.expectedMs  = samples.expectedMs;
+  stats.minMs       = samples.minMs;
+  stats.maxMs       = samples.maxMs;
+
+  if ( samples.sampleCount > 0 ) {
+    stats.meanMs         = samples.sumMs / samples.sampleCount;
+    stats.meanErrorMs    = (long) stats.meanMs - (long) samples.expectedMs;
+    stats.meanAbsErrorMs = samples.sumAbsErrorMs / samples.sampleCount;
+    // Largest error is at one of the extremes...
+    stats.maxAbsErrorMs  = samples.maxMs > samples.expectedMs ? samples.maxMs - samples.expectedMs : 0;
+    minAbsErrorMs        = samples.minMs < samples.expectedMs ? samples.expectedMs - samples.minMs : 0;
+    if ( minAbsErrorMs > stats.maxAbsErrorMs ) stats.maxAbsErrorMs = minAbsErrorMs;
+  }
+  else {
+    stats.meanMs         = 0;
+    stats.meanErrorMs    = 0;
+    stats.meanAbsErrorMs = 0;
+    stats.maxAbsErrorMs  = 0;
+  }
+
+  return stats;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,123 @@
+// ****************************************************************************
+//
+// LED Timing Probe Class
+// ----------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedTimingProbe class is an output backend (see CwwLedOutput) that
+// measures the timing actually achieved by a CwwLedController, from the
+// levels written for one channel, and compares it with the configured
+// timing. Writes for all channels are passed on to an optional forward
+// output, so a probe can be placed in front of any backend.
+//
+// Two quantities are measured:
+//
+// - Period: time between successive turns of the level from falling to
+//   rising, i.e. the blink period (LED_BLINK...) or oscillate period
+//   (LED_OSCILLATE).
+// - Ramp: duration of a run of two or more changes in the same direction,
+//   i.e. a fade (LED_FADE_...) or half an oscillate period. The level is
+//   taken to leave its start level one step interval before the first
+//   change, so that an ideal ramp of n steps measures n refresh intervals.
+//
+// For each, the probe collects error statistics against an expected value
+// (see cwwStructLedTimingStats). A benchmark sketch steps through a grid of
+// configurations (period, level range, refresh interval, and loop jitter,
+// e.g. a random delay() per loop), and for each one sets the expected
+// values, runs the controller for some periods and reads the statistics.
+// Rounding of the level step (see LED_PARAM_LEVEL_RANGE and
+// LED_PARAM_REFRESH_INTERVAL), overshoot at the ends of the range, and
+// drift with loop latency all show up as errors.
+//
+// ****************************************************************************
+
+#ifndef CwwLedTimingProbe_h
+#define CwwLedTimingProbe_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+
+// ============================================================================
+
+struct cwwStructLedTimingStats {
+  uint16_t      sampleCount;
+  unsigned long expectedMs;
+  unsigned long minMs;
+  unsigned long maxMs;
+  unsigned long meanMs;
+  long          meanErrorMs;     // meanMs - expectedMs
+  unsigned long meanAbsErrorMs;
+  unsigned long maxAbsErrorMs;
+};
+
+// ============================================================================
+
+class CwwLedTimingProbe : public CwwLedOutput {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedTimingProbe ( uint8_t        ledChannel,               // Channel (pin) to measure
+                                 CwwLedOutput * forwardOutputPtr = NULL   // Output receiving all writes, or NULL
+                               );
+    virtual ~CwwLedTimingProbe ();
+
+    void expectPeriod ( unsigned long periodMs );  // blink or oscillate period; discards samples
+    void expectRamp   ( unsigned long rampMs );    // fade duration or half oscillate period; discards samples
+    void reset        ();                          // discard samples and trace state
+
+    cwwStructLedTimingStats valueOfPeriodStats ();
+    cwwStructLedTimingStats valueOfRampStats   ();  // includes a ramp in progress that has stalled
+
+    virtual void writeLevel  ( uint8_t ledChannel, uint8_t ledLevel, boolean usePwm );
+    virtual void beginFrame  ();
+    virtual void commitFrame ();
+
+  private:
+
+    // Private Types:
+
+    struct structTimingSamples {
+      uint16_t      sampleCount;
+      unsigned long expectedMs;
+      unsigned long minMs;
+      unsigned long maxMs;
+      unsigned long sumMs;
+      unsigned long sumAbsErrorMs;
+    };
+
+    // Private Variables:
+
+    CwwLedOutput * forwardOutputPtr;
+    uint8_t        ledChannel;
+
+    structTimingSamples periodSamples;
+    structTimingSamples rampSamples;
+
+    int16_t       lastLevel;       // -1 if unknown
+    int8_t        runDirection;    // +1 rising, -1 falling, 0 unknown
+    uint16_t      runChangeCount;
+    unsigned long runFirstTime;    // time of first change of run
+    unsigned long runSecondTime;   // time of second change of run
+    unsigned long runLastTime;     // time of last change of run
+    boolean       turnSeen;
+    unsigned long lastTurnTime;    // time of last turn from falling to rising
+
+    // Private Functions:
+
+    unsigned long           rampOfRun    ();
+    void                    addSample    ( structTimingSamples & samples, unsigned long measuredMs );
+    void                    clearSamples ( structTimingSamples & samples );
+    cwwStructLedTimingStats statsOf      ( const structTimingSamples & samples );
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
@@ -0,0 +1,251 @@
+// ****************************************************************************
+//
+// LED Tone Output Class
+// ---------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements class CwwLedTone, an output backend that plays LED
+// levels as buzzer frequencies, with a phase accumulator per buzzer
+// advanced from a timer interrupt.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTone.h>
+
+// ****************************************************************************
+// LED Tone Output Class
+// ****************************************************************************
+
+// ============================================================================
+// Constructors, Destructor
+// ============================================================================
+
+CwwLedTone::CwwLedTone (
+  uint16_t tickRate,
+  uint8_t  buzzerCapacity,
+  uint16_t frequencyMin,
+  uint16_t frequencyMax
+) {
+
+  if ( tickRate < 4 ) tickRate = 4;
+  if ( buzzerCapacity >= CWW_LED_TONE_NO_CHANNEL ) buzzerCapacity = CWW_LED_TONE_NO_CHANNEL - 1;
+
+  this->buzzers        = new structToneBuzzer [ buzzerCapacity ];
+  this->buzzerCapacity = buzzerCapacity;
+  this->buzzerCount    = 0;
+
+  this->tickRate       = tickRate;
+  this->incrementPerHz = 0xFFFFFFFFUL / tickRate;
+
+  setFrequencyRange ( frequencyMin, frequencyMax );
+  setGlide ( 0 );
+
+}
+
+// ----------------------------------------------------------------------------
+
+CwwLedTone::~CwwLedTone () {
+
+  uint8_t buzzerIndex;
+
+  for ( buzzerIndex = 0; buzzerIndex < buzzerCount; buzzerIndex++ ) {
+    if ( buzzers[buzzerIndex].buzzerPin != CWW_LED_TONE_NO_PIN ) digitalWrite ( buzzers[buzzerIndex].buzzerPin, LOW );
+  }
+
+  delete [] buzzers;
+
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+uint8_t CwwLedTone::addBuzzer ( uint8_t buzzerPin ) {
+
+  structToneBuzzer * buzzerPtr;
+
+  if ( buzzerCount >= buzzerCapacity ) return CWW_LED_TONE_NO_CHANNEL;
+
+  buzzerPtr = &buzzers[buzzerCount];
+
+  buzzerPtr->buzzerPin       = buzzerPin;
+  buzzerPtr->frequency       = 0;
+  buzzerPtr->phase           = 0;
+  buzzerPtr->increment       = 0;
+  buzzerPtr->targetIncrement = 0;
+  buzzerPtr->incrementSlope  = 0;
+  buzzerPtr->glideTicks      = 0;
+  buzzerPtr->output          = false;
+
+  if ( buzzerPin != CWW_LED_TONE_NO_PIN ) {
+    pinMode      ( buzzerPin, OUTPUT );
+    digitalWrite ( buzzerPin, LOW    );
+  }
+
+  // Count the buzzer only once it is set up, since tick() may run any
+  // time...
+  buzzerCount++;
+
+  return buzzerCount - 1;
+
+}
+
+// ----------------------------------------------------------------------------
+
+boolean CwwLedTone::setFrequencyRange (
+  uint16_t frequencyMin,
+  uint16_t frequencyMax
+) {
+
+  uint16_t frequencyLimit;
+  boolean  setIsClean;
+
+  // Keep increments below half a phase turn, so that differences of two
+  // increments fit incrementSlope...
+  frequencyLimit = tickRate / 2 - 1;
+
+  setIsClean = frequencyMax <= frequencyLimit && frequencyMin > 0 && frequencyMin <= frequencyMax;
+  if ( frequencyMax > frequencyLimit ) frequencyMax = frequencyLimit;
+  if ( frequencyMin > frequencyMax   ) frequencyMin = frequencyMax;
+  if ( frequencyMin == 0             ) frequencyMin = 1;
+
+  this->frequencyMin = frequencyMin;
+  this->frequencyMax = frequencyMax;
+
+  return setIsClean;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void CwwLedTone::setGlide ( uint16_t glideMs ) {
+
+  uint32_t glideTicks;
+
+  glideTicks = (uint32_t) glideMs * tickRate / 1000;
+  if ( glideTicks > 0xFFFF ) glideTicks = 0xFFFF;
+
+  this->glideMs    = glideMs;
+  this->glideTicks = glideTicks;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedTone::frequencyOfLevel ( uint8_t ledLevel ) {
+
+  if ( ledLevel == 0 ) return 0;
+
+  return frequencyMin + (uint32_t) ( frequencyMax - frequencyMin ) * ( ledLevel - 1 ) / 254;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedTone::valueOfFrequency ( uint8_t ledChannel ) {
+
+  if ( ledChannel >= buzzerCount ) return 0;
+
+  return buzzers[ledChannel].frequency;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+uint16_t CwwLedTone::valueOfGlide () {
+
+  return glideMs;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedTone::tick () {
+
+  uint8_t            buzzerIndex;
+  structToneBuzzer * buzzerPtr;
+  boolean            outputNew;
+
+  for ( buzzerIndex = 0; buzzerIndex < buzzerCount; buzzerIndex++ ) {
+
+    buzzerPtr = &buzzers[buzzerIndex];
+    if ( buzzerPtr->increment == 0 ) continue;
+
+    if ( buzzerPtr->glideTicks > 0 ) {
+      buzzerPtr->increment += buzzerPtr->incrementSlope;
+      if ( --buzzerPtr->glideTicks == 0 ) buzzerPtr->increment = buzzerPtr->targetIncrement;
+    }
+
+    buzzerPtr->phase += buzzerPtr->increment;
+
+    outputNew = ( buzzerPtr->phase >> 31 ) != 0;
+    if ( outputNew != buzzerPtr->output ) {
+      buzzerPtr->output = outputNew;
+      if ( buzzerPtr->buzzerPin != CWW_LED_TONE_NO_PIN ) digitalWrite ( buzzerPtr->buzzerPin, outputNew ? HIGH : LOW );
+    }
+
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+boolean CwwLedTone::valueOfOutput ( uint8_t ledChannel ) {
+
+  if ( ledChannel >= buzzerCount ) return false;
+
+  return buzzers[ledChannel].output;
+
+}
+
+// ----------------------------------------------------------------------------
+
+void CwwLedTone::writeLevel (
+  uint8_t ledChannel,
+  uint8_t ledLevel,
+  boolean usePwm
+) {
+
+  structToneBuzzer * buzzerPtr;
+  uint16_t           frequency;
+  uint32_t           targetIncrement;
+
+  if ( ledChannel >= buzzerCount ) return;
+
+  // Without PWM, any level is a tone at the maximum frequency...
+  if ( ! usePwm && ledLevel > 0 ) ledLevel = 255;
+
+  buzzerPtr = &buzzers[ledChannel];
+  frequency = frequencyOfLevel ( ledLevel );
+  if ( frequency == buzzerPtr->frequency ) return;
+
+  buzzerPtr->frequency = frequency;
+  targetIncrement      = frequency * incrementPerHz;
+
+  // The buzzer is shared with tick() in the timer interrupt...
+  noInterrupts ();
+
+  buzzerPtr->targetIncrement = targetIncrement;
+
+  if ( targetIncrement == 0 || buzzerPtr->increment == 0 || glideTicks == 0 ) {
+    // Silence, and tones from silence, start at once...
+    buzzerPtr->increment  = targetIncrement;
+    buzzerPtr->glideTicks = 0;
+    if ( targetIncrement == 0 ) {
+      buzzerPtr->phase  = 0;
+      buzzerPtr->output = false;
+      if ( buzzerPtr->buzzerPin != CWW_LED_TONE_NO_PIN ) digitalWrite ( buzzerPtr->buzzerPin, LOW );
+    }
+  }
+  else {
+    buzzerPtr->incrementSlope = ( (int32_t) targetIncrement - (int32_t) buzzerPtr->increment ) / glideTicks;
+    buzzerPtr->glideTicks     = glideTicks;
+  }
+
+  interrupts ();
+
+}
+
+// ****************************************************************************
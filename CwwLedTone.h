@@ -0,0 +1,115 @@
+// ****************************************************************************
+//
+// LED Tone Output Class
+// ---------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// The CwwLedTone class is an output backend (see CwwLedOutput) for piezo
+// buzzers: the level written by a CwwLedController sets the frequency of
+// a square wave rather than a PWM duty cycle. Level 0 is silence, levels
+// 1 to 255 map linearly onto the frequency range (see setFrequencyRange).
+// All modes and sequences of the controller thus apply to tones:
+//
+// - LED_ON / LED_OFF turn a tone at the maximum frequency on and off,
+//   LED_BLINK... beeps, and sequences of on and off steps play beeps of
+//   any on and off durations (e.g. alarm patterns),
+// - LED_HOLD_LEVEL (see setLevel) holds a given frequency, and
+// - LED_FADE_UP / LED_FADE_DOWN sweep the frequency, and LED_OSCILLATE
+//   sweeps up and down (a siren); use a controller with PWM enabled.
+//   Without PWM, as for LEDs, any level other than 0 is the maximum.
+//
+// The wave is generated by a phase accumulator per buzzer, advanced by
+// tick(), which must be called at a fixed rate (tickRate) from a timer
+// compare interrupt, e.g. for 20 kHz on an AVR with Timer2:
+//
+//   ISR ( TIMER2_COMPA_vect ) { buzzers.tick (); }
+//
+// Frequencies are exact to a fraction of a Hz at any tick rate, with a
+// jitter of one tick per edge. The controller changes the level once per
+// refresh interval; with a glide time (see setGlide) the frequency slides
+// to each new value over that time, one tick at a time, so sweeps become
+// smooth chirps instead of a staircase of notes.
+//
+// Buzzers added without pin (CWW_LED_TONE_NO_PIN) are simulated: tick()
+// advances them as usual, and the wave can be read with valueOfOutput()
+// (e.g. on a host, with a virtual timebase; see CwwLedTimebase).
+//
+// ****************************************************************************
+
+#ifndef CwwLedTone_h
+#define CwwLedTone_h
+
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+
+// ============================================================================
+
+#define CWW_LED_TONE_NO_CHANNEL  0xFF  // returned by addBuzzer on failure
+#define CWW_LED_TONE_NO_PIN      0xFF  // for simulated buzzers
+
+// ============================================================================
+
+class CwwLedTone : public CwwLedOutput {
+
+  public:
+
+    // Public Functions:
+
+             CwwLedTone ( uint16_t tickRate,               // Rate in Hz at which tick() is called
+                          uint8_t  buzzerCapacity = 1,     // Maximum number of buzzers
+                          uint16_t frequencyMin   = 200,   // Frequency in Hz of level 1
+                          uint16_t frequencyMax   = 4000   // Frequency in Hz of level 255
+                        );
+    virtual ~CwwLedTone ();
+
+    uint8_t addBuzzer ( uint8_t buzzerPin );  // returns channel number or CWW_LED_TONE_NO_CHANNEL
+
+    boolean  setFrequencyRange ( uint16_t frequencyMin, uint16_t frequencyMax );  // false if clamped to below tickRate / 2
+    void     setGlide          ( uint16_t glideMs );  // slide time to new frequencies; e.g. refresh interval; 0 to jump
+    uint16_t frequencyOfLevel  ( uint8_t ledLevel );  // Hz; 0 for silence
+    uint16_t valueOfFrequency  ( uint8_t ledChannel );
+    uint16_t valueOfGlide      ();
+
+    void    tick          ();  // advance all buzzers by one tick; call from timer interrupt
+    boolean valueOfOutput ( uint8_t ledChannel );
+
+    virtual void writeLevel ( uint8_t ledChannel, uint8_t ledLevel, boolean usePwm );
+
+  private:
+
+    // Private Types:
+
+    struct structToneBuzzer {
+      uint8_t           buzzerPin;
+      uint16_t          frequency;
+      volatile uint32_t phase;            // wave is high in upper half
+      volatile uint32_t increment;        // phase per tick; 0 for silence
+      volatile uint32_t targetIncrement;
+      volatile int32_t  incrementSlope;   // change of increment per tick while gliding
+      volatile uint16_t glideTicks;       // ticks left to reach targetIncrement
+      volatile boolean  output;
+    };
+
+    // Private Variables:
+
+    structToneBuzzer * buzzers;
+    uint8_t            buzzerCapacity;
+    uint8_t            buzzerCount;
+
+    uint16_t tickRate;
+    uint32_t incrementPerHz;
+    uint16_t frequencyMin;
+    uint16_t frequencyMax;
+    uint16_t glideMs;
+    uint16_t glideTicks;
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
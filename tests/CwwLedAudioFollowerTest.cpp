@@ -0,0 +1,102 @@
+// ****************************************************************************
+//
+// LED Audio Follower Test
+// -----------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of the mapping of envelope amplitudes onto levels (see
+// CwwLedAudioFollower::setRange): with immediate attack and release, a
+// block of constant samples sets the envelope to its amplitude, so every
+// amplitude can be checked. Levels must rise with the amplitude, be 0 at
+// or below the floor and 255 at or above the full amplitude, whatever the
+// width of the range.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedAudioFollower.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_BLOCK_SIZE  16
+
+// ----------------------------------------------------------------------------
+
+static uint8_t levelOfAmplitude ( CwwLedAudioFollower & follower, uint8_t bandIndex, int16_t amplitude ) {
+
+  int16_t  samples[TEST_BLOCK_SIZE];
+  uint16_t sampleIndex;
+
+  for ( sampleIndex = 0; sampleIndex < TEST_BLOCK_SIZE; sampleIndex++ ) {
+    samples[sampleIndex] = sampleIndex & 1 ? -amplitude : amplitude;
+  }
+  follower.processBlock ( samples, TEST_BLOCK_SIZE );
+
+  return follower.valueOfLevel ( bandIndex );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void checkRange ( uint16_t floorAmplitude, uint16_t fullAmplitude ) {
+
+  CwwLedAudioFollower follower ( 8000 );
+  uint8_t             bandIndex;
+  uint8_t             level;
+  uint8_t             lastLevel;
+  uint32_t            amplitude;
+  uint32_t            failCount;
+
+  bandIndex = follower.addBand ( NULL );
+  CWW_TEST_CHECK ( follower.setTiming ( bandIndex, 0, 0 ) );
+  CWW_TEST_CHECK ( follower.setRange ( bandIndex, floorAmplitude, fullAmplitude ) );
+
+  lastLevel = 0;
+  failCount = 0;
+  for ( amplitude = 0; amplitude <= 32767; amplitude++ ) {
+    level = levelOfAmplitude ( follower, bandIndex, amplitude );
+    if ( level < lastLevel
+      || ( amplitude <= floorAmplitude && level != 0   )
+      || ( amplitude >= fullAmplitude  && level != 255 ) ) {
+      if ( failCount++ == 0 ) printf ( "range %u-%u: amplitude %u gives level %u\n", floorAmplitude, fullAmplitude, amplitude, level );
+    }
+    lastLevel = level;
+  }
+  CWW_TEST_CHECK ( failCount == 0 );
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedAudioFollower follower ( 8000 );
+  CwwLedController    controller ( 5, true );
+  uint8_t             bandIndex;
+
+  // Narrow ranges scale by up to 255 / 1; wide ranges by about 1 / 128...
+  checkRange ( 0,     10    );
+  checkRange ( 0,     1     );
+  checkRange ( 1000,  1003  );
+  checkRange ( 100,   2000  );
+  checkRange ( 0,     32767 );
+  checkRange ( 32000, 32767 );
+
+  // The level of a band is the level of its controller...
+  bandIndex = follower.addBand ( &controller );
+  follower.setTiming ( bandIndex, 0, 0 );
+  follower.setRange  ( bandIndex, 0, 100 );
+  CWW_TEST_CHECK ( levelOfAmplitude ( follower, bandIndex, 50 ) == 127 );
+  CWW_TEST_CHECK ( controller.currentLevel () == 127 );
+  CWW_TEST_CHECK ( levelOfAmplitude ( follower, bandIndex, 20000 ) == 255 );
+  CWW_TEST_CHECK ( controller.currentLevel () == 255 );
+
+  return cwwTestSummary ( "CwwLedAudioFollowerTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,133 @@
+// ****************************************************************************
+//
+// LED Beat Clock Test
+// -------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedBeatClock on a virtual clock with microsecond
+// resolution (see CwwLedTimebase::setMicrosSource): a CwwLedPulseTrain
+// plays MIDI clock (24 pulses per beat) at 100 BPM with jitter and dropped
+// pulses, and the beat clock must lock, estimate the beat period, and run
+// the timebase at 500 ms per actual beat. When the pulses stop, the clock
+// must unlock. A tap tempo (one pulse per beat) slower than 30 BPM must
+// lock as well. Without a microsecond source, sourceMicros() must follow
+// the time source.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedBeatClock.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_BEAT_US       600000UL  // 100 BPM
+#define TEST_PULSES        24
+#define TEST_STEP_US       250       // loop period
+#define TEST_LOCK_BEATS    40        // beats to lock in
+#define TEST_CHECK_BEATS   40        // beats checked after locking
+#define TEST_TAP_BEAT_US   4000000UL  // 15 BPM, on a nominal 3 s beat
+
+// ----------------------------------------------------------------------------
+
+static unsigned long virtualUs;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long virtualMicros () {
+
+  return virtualUs;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long virtualMillis () {
+
+  return virtualUs / 1000;
+
+}
+
+// ----------------------------------------------------------------------------
+
+static void runUntil ( CwwLedBeatClock & beatClock, CwwLedPulseTrain * trainPtr, unsigned long * nextPulsePtr, unsigned long endUs ) {
+
+  while ( virtualUs < endUs ) {
+    virtualUs += TEST_STEP_US;
+    if ( trainPtr != NULL && virtualUs >= *nextPulsePtr ) {
+      beatClock.pulse ( *nextPulsePtr );
+      *nextPulsePtr = trainPtr->nextPulse ();
+    }
+    beatClock.updateNow ();
+  }
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedBeatClock  beatClock ( 500, TEST_PULSES );
+  CwwLedPulseTrain train ( TEST_BEAT_US / TEST_PULSES, 500, 5, 7 );
+  unsigned long    nextPulse;
+  unsigned long    startUs;
+  unsigned long    startTime;
+  long             driftMs;
+
+  // Without a microsecond source, microseconds follow the time source...
+  virtualUs = 5000000;
+  CwwLedTimebase::setTimeSource ( virtualMillis );
+  CWW_TEST_CHECK ( CwwLedTimebase::sourceMicros () == 5000000 );
+  virtualUs += 1999;
+  CWW_TEST_CHECK ( CwwLedTimebase::sourceMicros () == 5001000 );
+
+  CwwLedTimebase::setMicrosSource ( virtualMicros );
+  CWW_TEST_CHECK ( CwwLedTimebase::valueOfMicrosSource () == virtualMicros );
+  CWW_TEST_CHECK ( CwwLedTimebase::sourceMicros () == virtualUs );
+
+  // Lock on to the pulses...
+  virtualUs = 0;
+  CwwLedTimebase::setTimeSource ( virtualMillis );
+  nextPulse = train.nextPulse ();
+  runUntil ( beatClock, &train, &nextPulse, TEST_LOCK_BEATS * TEST_BEAT_US );
+  CWW_TEST_CHECK ( beatClock.isLocked () );
+  CWW_TEST_CHECK ( labs ( (long) beatClock.valueOfBeatPeriod () - (long) TEST_BEAT_US ) < 1000 );
+  CWW_TEST_CHECK ( labs ( (long) CwwLedTimebase::valueOfRate () - (long) ( 65536ULL * 500000 / TEST_BEAT_US ) ) < 100 );
+
+  // Once locked, each beat lasts the nominal 500 ms of the timebase...
+  startUs   = virtualUs;
+  startTime = CwwLedTimebase::now ();
+  runUntil ( beatClock, &train, &nextPulse, startUs + TEST_CHECK_BEATS * TEST_BEAT_US );
+  driftMs = (long) ( CwwLedTimebase::now () - startTime ) - TEST_CHECK_BEATS * 500L;
+  CWW_TEST_CHECK ( labs ( driftMs ) <= 5 );
+  CWW_TEST_CHECK ( beatClock.isLocked () );
+
+  // When the pulses stop, the tempo is held and the clock unlocks...
+  runUntil ( beatClock, NULL, NULL, virtualUs + 3 * TEST_BEAT_US );
+  CWW_TEST_CHECK ( ! beatClock.isLocked () );
+  beatClock.release ();
+  CWW_TEST_CHECK ( CwwLedTimebase::valueOfRate () == TIMEBASE_RATE_NORMAL );
+
+  // Slow tap tempo, with a pulse period range beyond 32 bits in Q8...
+  {
+    CwwLedBeatClock  tapClock ( 3000, 1 );
+    CwwLedPulseTrain tapTrain ( TEST_TAP_BEAT_US, 2000, 0, 11 );
+    do nextPulse = tapTrain.nextPulse (); while ( nextPulse <= virtualUs );
+    runUntil ( tapClock, &tapTrain, &nextPulse, virtualUs + TEST_LOCK_BEATS * TEST_TAP_BEAT_US );
+    CWW_TEST_CHECK ( tapClock.isLocked () );
+    CWW_TEST_CHECK ( labs ( (long) tapClock.valueOfBeatPeriod () - (long) TEST_TAP_BEAT_US ) < 5000 );
+    CWW_TEST_CHECK ( labs ( (long) CwwLedTimebase::valueOfRate () - (long) ( 65536ULL * 3000000 / TEST_TAP_BEAT_US ) ) < 100 );
+    tapClock.release ();
+  }
+
+  CwwLedTimebase::setMicrosSource ( NULL );
+  CwwLedTimebase::setTimeSource   ( NULL );
+
+  return cwwTestSummary ( "CwwLedBeatClockTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,103 @@
+// ****************************************************************************
+//
+// Charlieplexed LED Output Benchmark
+// ----------------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host benchmark of CwwLedCharlieplex: time per scanIsr() call (with the
+// default pin drive against the host stand-in and with pin drive left
+// out), interrupts per scan frame and time of commitFrame() (scan table
+// build), for 2 to 8 pins. Host figures rank the costs; the ISR cost on
+// a target is dominated by its pin access (see drivePins).
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedCharlieplex.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+class CharlieplexNoDrive : public CwwLedCharlieplex {
+
+  public:
+
+    CharlieplexNoDrive ( const uint8_t * pins, uint8_t pinCount )
+      : CwwLedCharlieplex ( pins, pinCount, 0 ) {}
+
+  protected:
+
+    virtual void drivePins ( uint8_t outputMask, uint8_t highMask ) { (void) outputMask; (void) highMask; }
+
+};
+
+// ----------------------------------------------------------------------------
+
+static const uint8_t benchPins[8] = { 2, 3, 4, 5, 6, 7, 8, 9 };
+
+static volatile unsigned long benchSink;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static double timeScan ( CwwLedCharlieplex & charlieplex, unsigned long callCount ) {
+
+  unsigned long callIndex;
+  unsigned long ticks;
+  double        startTime;
+
+  ticks     = 0;
+  startTime = cwwTestSeconds ();
+  for ( callIndex = 0; callIndex < callCount; callIndex++ ) ticks += charlieplex.scanIsr ();
+  benchSink = ticks;
+
+  return ( cwwTestSeconds () - startTime ) * 1e9 / callCount;
+
+}
+
+// ============================================================================
+
+int main () {
+
+  uint8_t       pinCount;
+  uint8_t       channel;
+  unsigned long commitIndex;
+  double        startTime;
+  double        commitNs;
+
+  printf ( "pins  leds  isr/frame  ns/isr (pins)  ns/isr (no pins)  ns/commit\n" );
+
+  for ( pinCount = 2; pinCount <= 8; pinCount++ ) {
+
+    CwwLedCharlieplex  charlieplex ( benchPins, pinCount, 0 );
+    CharlieplexNoDrive noDrive     ( benchPins, pinCount );
+
+    // Half of the LEDs lit, at spread levels...
+    for ( channel = 0; channel < charlieplex.valueOfLedCount (); channel += 2 ) {
+      charlieplex.writeLevel ( channel, 30 + channel * 7, true );
+      noDrive.writeLevel     ( channel, 30 + channel * 7, true );
+    }
+    charlieplex.begin ();
+    charlieplex.commitFrame ();
+    noDrive.commitFrame ();
+
+    startTime = cwwTestSeconds ();
+    for ( commitIndex = 0; commitIndex < 100000; commitIndex++ ) {
+      noDrive.writeLevel ( 0, commitIndex & 1 ? 40 : 41, true );
+      noDrive.scanIsr ();  // lets the scan take up the committed table
+      noDrive.commitFrame ();
+    }
+    commitNs = ( cwwTestSeconds () - startTime ) * 1e9 / 100000;
+
+    printf ( "%4u  %4u  %9u  %13.1f  %16.1f  %9.1f\n",
+             pinCount, charlieplex.valueOfLedCount (), ( charlieplex.valueOfLedCount () + 1 ) / 2 + 1,
+             timeScan ( charlieplex, 2000000 ), timeScan ( noDrive, 20000000 ), commitNs );
+
+  }
+
+  return 0;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,194 @@
+// ****************************************************************************
+//
+// Charlieplexed LED Output Test
+// -----------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedCharlieplex: runs the scan with recorded pin drive
+// and checks the duty cycle of each LED, duty compensation, the first
+// frame and the latching of new scan tables at frame boundaries.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedCharlieplex.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+class CharlieplexProbe : public CwwLedCharlieplex {
+
+  public:
+
+    CharlieplexProbe ( const uint8_t * pins, uint8_t pinCount, uint8_t maxLitCount )
+      : CwwLedCharlieplex ( pins, pinCount, maxLitCount ) {
+      lastOutputMask = 0;
+      lastHighMask   = 0;
+    }
+
+    uint8_t lastOutputMask;
+    uint8_t lastHighMask;
+
+  protected:
+
+    virtual void drivePins ( uint8_t outputMask, uint8_t highMask ) {
+      lastOutputMask = outputMask;
+      lastHighMask   = highMask;
+    }
+
+};
+
+// ----------------------------------------------------------------------------
+
+static const uint8_t testPins[4] = { 2, 3, 4, 5 };
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static int litChannelOf ( CharlieplexProbe & probe ) {
+
+  uint8_t anodeIndex;
+  uint8_t cathodeIndex;
+
+  // One pin high (anode) and one pin low (cathode) lights exactly one LED...
+  if ( probe.lastOutputMask == 0 ) return -1;
+  for ( anodeIndex = 0; ! ( probe.lastHighMask & ( 1 << anodeIndex ) ); anodeIndex++ ) {}
+  for ( cathodeIndex = 0; ! ( ( probe.lastOutputMask & ~probe.lastHighMask ) & ( 1 << cathodeIndex ) ); cathodeIndex++ ) {}
+
+  return probe.channelOf ( anodeIndex, cathodeIndex );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long scanFrames ( CharlieplexProbe & probe, unsigned long frameTicks, unsigned int frameCount,
+                                  unsigned long * litTicks ) {
+
+  unsigned long totalTicks;
+  unsigned long slotTicks;
+  int           channel;
+
+  // Whole frames only; frame length is known from the levels...
+  memset ( litTicks, 0, 12 * sizeof ( unsigned long ) );
+  totalTicks = 0;
+  while ( totalTicks < frameTicks * frameCount ) {
+    slotTicks = probe.scanIsr ();
+    channel   = litChannelOf ( probe );
+    if ( channel >= 0 ) litTicks[channel] += slotTicks;
+    totalTicks += slotTicks;
+  }
+
+  return totalTicks;
+
+}
+
+// ============================================================================
+
+int main () {
+
+  unsigned long litTicks[12];
+  unsigned long totalTicks;
+  uint8_t       channel;
+
+  // First frame starts with the first lit LED, not with the slot after it...
+  {
+    CharlieplexProbe probe ( testPins, 4, 0 );
+    probe.begin ();
+    probe.writeLevel ( 5, 100, true );
+    probe.writeLevel ( 9, 200, true );
+    probe.commitFrame ();
+    CWW_TEST_CHECK ( probe.scanIsr () == 100 );
+    CWW_TEST_CHECK ( litChannelOf ( probe ) == 5 );
+    CWW_TEST_CHECK ( probe.scanIsr () == 200 );
+    CWW_TEST_CHECK ( litChannelOf ( probe ) == 9 );
+    CWW_TEST_CHECK ( probe.scanIsr () == 255 * 12 - 300 );  // dark padding slot
+    CWW_TEST_CHECK ( litChannelOf ( probe ) == -1 );
+    CWW_TEST_CHECK ( probe.scanIsr () == 100 );
+  }
+
+  // Duty of each LED is its level over the frame of all LEDs at full
+  // level; exact over whole frames...
+  {
+    CharlieplexProbe probe ( testPins, 4, 0 );
+    for ( channel = 0; channel < 12; channel++ ) probe.writeLevel ( channel, channel * 20, true );
+    probe.commitFrame ();
+    totalTicks = scanFrames ( probe, 255UL * 12, 10, litTicks );
+    CWW_TEST_CHECK ( totalTicks == 255UL * 12 * 10 );
+    for ( channel = 0; channel < 12; channel++ ) CWW_TEST_CHECK ( litTicks[channel] == channel * 20UL * 10 );
+  }
+
+  // Duty compensation: up to maxLitCount LEDs, the duty of an LED does not
+  // depend on how many others are lit; beyond, the frame grows...
+  {
+    CharlieplexProbe probe ( testPins, 4, 3 );
+    probe.writeLevel ( 0, 255, true );
+    probe.commitFrame ();
+    totalTicks = scanFrames ( probe, 255UL * 3, 4, litTicks );
+    CWW_TEST_CHECK ( litTicks[0] * 3 == totalTicks );
+
+    probe.writeLevel ( 1, 255, true );
+    probe.writeLevel ( 2, 255, true );
+    probe.commitFrame ();
+    totalTicks = scanFrames ( probe, 255UL * 3, 4, litTicks );
+    CWW_TEST_CHECK ( litTicks[0] * 3 == totalTicks && litTicks[1] == litTicks[0] && litTicks[2] == litTicks[0] );
+
+    probe.writeLevel ( 3, 255, true );
+    probe.commitFrame ();
+    totalTicks = scanFrames ( probe, 255UL * 4, 4, litTicks );
+    CWW_TEST_CHECK ( litTicks[0] * 4 == totalTicks );
+  }
+
+  // Without PWM, any level lights the LED for a full slot...
+  {
+    CharlieplexProbe probe ( testPins, 4, 1 );
+    probe.writeLevel ( 7, 10, false );
+    probe.commitFrame ();
+    CWW_TEST_CHECK ( probe.scanIsr () == 255 );
+    CWW_TEST_CHECK ( litChannelOf ( probe ) == 7 );
+  }
+
+  // A table committed mid frame is taken up at the next frame only...
+  {
+    CharlieplexProbe probe ( testPins, 4, 4 );
+    probe.writeLevel ( 0, 50, true );
+    probe.writeLevel ( 1, 60, true );
+    probe.commitFrame ();
+    CWW_TEST_CHECK ( probe.scanIsr () == 50 );
+    probe.writeLevel ( 0, 0, true );
+    probe.writeLevel ( 2, 70, true );
+    probe.commitFrame ();
+    CWW_TEST_CHECK ( probe.scanIsr () == 60 );                   // rest of old frame...
+    CWW_TEST_CHECK ( probe.scanIsr () == 255 * 4 - 110 );
+    CWW_TEST_CHECK ( probe.scanIsr () == 60 );                   // ...then new table
+    CWW_TEST_CHECK ( litChannelOf ( probe ) == 1 );
+    CWW_TEST_CHECK ( probe.scanIsr () == 70 );
+    CWW_TEST_CHECK ( litChannelOf ( probe ) == 2 );
+  }
+
+  // Default pin drive: exactly the two pins of the lit LED are outputs,
+  // and no released pin ever has its pull-up on...
+  {
+    CwwLedCharlieplex charlieplex ( testPins, 4, 0 );
+    unsigned long     pullupCount;
+    charlieplex.begin ();
+    pullupCount = hostPullupCount;
+    charlieplex.writeLevel ( charlieplex.channelOf ( 1, 3 ), 255, true );
+    charlieplex.commitFrame ();
+    charlieplex.scanIsr ();
+    CWW_TEST_CHECK ( hostPinModes[2] == INPUT  && hostPinModes[4] == INPUT );
+    CWW_TEST_CHECK ( hostPinModes[3] == OUTPUT && hostPinValues[3] == 255 );
+    CWW_TEST_CHECK ( hostPinModes[5] == OUTPUT && hostPinValues[5] == 0 );
+    charlieplex.scanIsr ();  // dark slot
+    CWW_TEST_CHECK ( hostPinModes[3] == INPUT && hostPinModes[5] == INPUT && hostPinValues[3] == 0 );
+    for ( channel = 0; channel < 12; channel++ ) charlieplex.writeLevel ( channel, 100 + channel, true );
+    charlieplex.commitFrame ();
+    for ( channel = 0; channel < 50; channel++ ) charlieplex.scanIsr ();
+    CWW_TEST_CHECK ( hostPullupCount == pullupCount );
+  }
+
+  return cwwTestSummary ( "CwwLedCharlieplexTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,218 @@
+// ****************************************************************************
+//
+// LED Chase Test
+// --------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedChase on a virtual timebase: a comet head moving one
+// channel per step (forwards and in reverse, fading in under its leading
+// edge between steps), a scanner bouncing between both ends with its
+// afterglow, a marquee repeating along the range, and the head position
+// kept exact over irregular updates and changes of the step time.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+#include <CwwLedChase.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_CHANNELS  8
+#define TEST_STEP_MS   40
+
+// ----------------------------------------------------------------------------
+
+static unsigned long    virtualTime;
+static CwwLedController controllers[TEST_CHANNELS] = { { 60, true }, { 61, true }, { 62, true }, { 63, true },
+                                                       { 64, true }, { 65, true }, { 66, true }, { 67, true } };
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long virtualMillis () {
+
+  return virtualTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void runFor ( CwwLedChase & chase, unsigned long durationMs ) {
+
+  unsigned long endTime;
+
+  endTime = virtualTime + durationMs;
+  while ( virtualTime < endTime ) {
+    virtualTime++;
+    if ( chase.updateIsDue () ) chase.updateNow ();
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static uint8_t fullChannel ( uint8_t * fullCount ) {  // last channel at 255; TEST_CHANNELS if none
+
+  uint8_t channelIndex;
+  uint8_t foundIndex;
+
+  foundIndex = TEST_CHANNELS;
+  *fullCount = 0;
+  for ( channelIndex = 0; channelIndex < TEST_CHANNELS; channelIndex++ ) {
+    if ( controllers[channelIndex].currentLevel () != 255 ) continue;
+    foundIndex = channelIndex;
+    ( *fullCount )++;
+  }
+
+  return foundIndex;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static uint8_t litCount () {
+
+  uint8_t channelIndex;
+  uint8_t lit;
+
+  lit = 0;
+  for ( channelIndex = 0; channelIndex < TEST_CHANNELS; channelIndex++ ) {
+    if ( controllers[channelIndex].currentLevel () > 0 ) lit++;
+  }
+
+  return lit;
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedBank    bank ( TEST_CHANNELS );
+  CwwLedChase   chase ( bank );
+  uint8_t       channelIndex;
+  uint8_t       stepIndex;
+  uint8_t       fullCount;
+  uint8_t       wrongCount;
+  uint8_t       expectedIndex;
+  uint8_t       lastLevel;
+  long          expectedPosition;
+  unsigned long updateCount;
+  unsigned long startTime;
+
+  virtualTime = 1000;
+  CwwLedTimebase::setTimeSource ( virtualMillis );
+
+  for ( channelIndex = 0; channelIndex < TEST_CHANNELS; channelIndex++ ) bank.addChannel ( &controllers[channelIndex] );
+  CWW_TEST_CHECK ( chase.valueOfRangeCount () == TEST_CHANNELS );
+  CWW_TEST_CHECK ( chase.millisUntilUpdate () == UPDATE_NOT_SCHEDULED && ! chase.updateIsDue () );
+  CWW_TEST_CHECK ( ! chase.setStepTime ( 0 ) && chase.setStepTime ( TEST_STEP_MS ) );
+  CWW_TEST_CHECK ( ! chase.setWidth ( 0 ) && chase.valueOfWidth () == 1 );
+  chase.setRefreshInterval ( TEST_STEP_MS / 2 );
+
+  // A comet without tail: after each whole step, one channel at full,
+  // one further along each step; halfway, that channel is half in...
+  chase.start ();
+  wrongCount = 0;
+  for ( stepIndex = 1; stepIndex <= TEST_CHANNELS; stepIndex++ ) {
+    runFor ( chase, TEST_STEP_MS / 2 );
+    if ( controllers[stepIndex - 1].currentLevel () < 120 || controllers[stepIndex - 1].currentLevel () > 135 ) wrongCount++;
+    runFor ( chase, TEST_STEP_MS / 2 );
+    if ( fullChannel ( &fullCount ) != stepIndex - 1 || fullCount != 1 || litCount () != 1 ) wrongCount++;
+  }
+  CWW_TEST_CHECK ( wrongCount == 0 );
+
+  // Out at the end, and in again at the start...
+  runFor ( chase, TEST_STEP_MS );
+  CWW_TEST_CHECK ( litCount () == 0 );
+  runFor ( chase, TEST_STEP_MS );
+  CWW_TEST_CHECK ( fullChannel ( &fullCount ) == 0 && fullCount == 1 );
+
+  // In reverse, the head runs from the last channel down...
+  chase.setDirection ( LED_CHASE_REVERSE );
+  chase.start ();
+  runFor ( chase, 3 * TEST_STEP_MS );
+  CWW_TEST_CHECK ( fullChannel ( &fullCount ) == TEST_CHANNELS - 3 && fullCount == 1 );
+  chase.setDirection ( LED_CHASE_FORWARD );
+
+  // A comet with a tail: levels fall behind the head...
+  chase.setTail ( 3 );
+  chase.start ();
+  runFor ( chase, 6 * TEST_STEP_MS );
+  CWW_TEST_CHECK ( fullChannel ( &fullCount ) == 5 && fullCount == 1 );
+  CWW_TEST_CHECK ( controllers[4].currentLevel () > controllers[3].currentLevel () && controllers[3].currentLevel () > controllers[2].currentLevel () );
+  CWW_TEST_CHECK ( controllers[2].currentLevel () > 0 && controllers[1].currentLevel () == 0 && controllers[6].currentLevel () == 0 );
+
+  // A scanner turns at each end; its afterglow stays on the channels it
+  // last passed, so channels next to the head towards the end it came
+  // from are lit...
+  chase.setTail ( 2 );
+  chase.setBounce ( true );
+  chase.start ();
+  wrongCount = 0;
+  for ( stepIndex = 1; stepIndex <= 3 * TEST_CHANNELS; stepIndex++ ) {
+    runFor ( chase, TEST_STEP_MS );
+    expectedIndex = stepIndex % ( 2 * ( TEST_CHANNELS - 1 ) );
+    if ( expectedIndex >= TEST_CHANNELS ) expectedIndex = 2 * ( TEST_CHANNELS - 1 ) - expectedIndex;
+    if ( fullChannel ( &fullCount ) != expectedIndex || fullCount != 1 ) {
+      wrongCount++;
+      continue;
+    }
+    if ( litCount () > 3 ) wrongCount++;
+  }
+  CWW_TEST_CHECK ( wrongCount == 0 );
+  chase.setBounce ( false );
+
+  // A marquee repeats its pattern every few channels...
+  chase.setTail    ( 0 );
+  chase.setSpacing ( 3 );
+  chase.start ();
+  runFor ( chase, 5 * TEST_STEP_MS );
+  wrongCount = 0;
+  for ( channelIndex = 3; channelIndex < TEST_CHANNELS; channelIndex++ ) {
+    if ( controllers[channelIndex].currentLevel () != controllers[channelIndex - 3].currentLevel () ) wrongCount++;
+  }
+  CWW_TEST_CHECK ( wrongCount == 0 );
+  fullChannel ( &fullCount );
+  CWW_TEST_CHECK ( fullCount == ( TEST_CHANNELS + 1 ) / 3 && litCount () == fullCount );
+  chase.setSpacing ( 0 );
+
+  // The position is exact over updates at odd intervals, and stays where
+  // it is when the step time changes. A single head with 2 channels of
+  // tail runs (8 - 1 + 1) + 3 channels per cycle...
+  chase.setTail ( 2 );
+  chase.setStepTime ( 7 );
+  chase.start ();
+  startTime   = virtualTime;
+  updateCount = 0;
+  for ( stepIndex = 0; stepIndex < 200; stepIndex++ ) {
+    virtualTime += 1 + stepIndex % 13;
+    if ( chase.updateNow () ) updateCount++;
+  }
+  expectedPosition = (long) ( ( (unsigned long long) ( virtualTime - startTime ) << 8 ) / 7 ) % ( 11 * 256L );
+  CWW_TEST_CHECK ( chase.valueOfPosition () == expectedPosition );
+  CWW_TEST_CHECK ( updateCount > 0 && updateCount < 200 );
+  CWW_TEST_CHECK ( chase.setStepTime ( 100 ) && chase.valueOfPosition () == expectedPosition );
+  virtualTime += 250;
+  CWW_TEST_CHECK ( chase.valueOfPosition () == ( expectedPosition + 640 ) % ( 11 * 256L ) );
+
+  // Stopped, the channels keep their levels...
+  runFor ( chase, 20 );
+  lastLevel = controllers[0].currentLevel ();
+  chase.stop ();
+  runFor ( chase, 1000 );
+  CWW_TEST_CHECK ( ! chase.isRunning () && chase.millisUntilUpdate () == UPDATE_NOT_SCHEDULED );
+  CWW_TEST_CHECK ( controllers[0].currentLevel () == lastLevel );
+
+  CwwLedTimebase::setTimeSource ( NULL );
+
+  return cwwTestSummary ( "CwwLedChaseTest" );
+
+}
+
+// ****************************************************************************
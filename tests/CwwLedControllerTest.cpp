@@ -0,0 +1,251 @@
+// ****************************************************************************
+//
+// LED Controller Test
+// -------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedController events (see setEventCallback): counts of
+// LED_EVENT_STEP, LED_EVENT_ITERATION and LED_EVENT_SEQUENCE_END for a
+// finite sequence, of LED_EVENT_PHASES_DONE for blink(n), the time each
+// is sent at, and a callback that starts the next blink itself.
+//
+// Also traces sequence playback (the time each step shows on the pin):
+// reverse play mirroring the delays, rate 2.0 halving them, a rate change
+// mid step, and pause or stop (by setMode) and resume keeping the delay
+// left of the step in progress.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_REFRESH_MS  10
+#define TEST_EVENTS      4  // LED_EVENT_PHASES_DONE to LED_EVENT_SEQUENCE_END
+#define TEST_TRACE_STEPS 4
+
+// ----------------------------------------------------------------------------
+
+struct structEventLog {
+  unsigned int  counts[TEST_EVENTS];
+  unsigned long lastTimes[TEST_EVENTS];  // hostMillis when last sent
+  uint16_t      restartPhases;           // blink phases to start on LED_EVENT_PHASES_DONE; 0 for none
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void logEvent ( CwwLedController * controllerPtr, cwwEnumLedEvent ledEvent, void * contextPtr ) {
+
+  structEventLog * logPtr;
+
+  logPtr = (structEventLog *) contextPtr;
+  logPtr->counts[ledEvent]++;
+  logPtr->lastTimes[ledEvent] = hostMillis;
+
+  if ( ledEvent == LED_EVENT_PHASES_DONE && logPtr->restartPhases > 0 ) {
+    controllerPtr->blink ( logPtr->restartPhases );
+    logPtr->restartPhases = 0;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void runFor ( CwwLedController & controller, unsigned long durationMs ) {
+
+  unsigned long endTime;
+
+  endTime = hostMillis + durationMs;
+  while ( hostMillis < endTime ) {
+    hostAdvance ( 1000 );
+    controller.updateNow ();
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static boolean traceUntil ( CwwLedController & controller, unsigned long startTime, unsigned long endTime,
+                            unsigned long * stepTimes ) {
+
+  int lastValue;
+
+  // Each step holds its own level (10, 20, 30, 40); its time is that of
+  // the first update showing the level, in ms after startTime. The loop
+  // updates every ms from 1 ms on, so the first step shows at 1 ms...
+  lastValue = hostPinValues[30];
+  while ( hostMillis - startTime < endTime ) {
+    hostAdvance ( 1000 );
+    controller.updateNow ();
+    if ( hostPinValues[30] == lastValue ) continue;
+    lastValue = hostPinValues[30];
+    if ( lastValue % 10 == 0 && lastValue >= 10 && lastValue <= 10 * TEST_TRACE_STEPS ) {
+      stepTimes[lastValue / 10 - 1] = hostMillis - startTime;
+    }
+  }
+
+  return ! controller.isPlayingSequence ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static boolean traceIs ( const unsigned long * stepTimes, unsigned long time0, unsigned long time1,
+                         unsigned long time2, unsigned long time3 ) {
+
+  return stepTimes[0] == time0 && stepTimes[1] == time1 && stepTimes[2] == time2 && stepTimes[3] == time3;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static boolean sentNear ( unsigned long sentMs, unsigned long expectedMs ) {  // within a refresh
+
+  return sentMs + TEST_REFRESH_MS >= expectedMs && sentMs <= expectedMs + TEST_REFRESH_MS;
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedController controller ( 30, true );
+  CwwLedSequence   sequence;
+  CwwLedSequence   traced;
+  structEventLog   eventLog;
+  unsigned long    startTime;
+  unsigned long    stepTimes[TEST_TRACE_STEPS];
+
+  controller.setRefreshInterval ( TEST_REFRESH_MS );
+  controller.setEventCallback ( logEvent, &eventLog );
+
+  // Three steps, 100 ms apart, played twice: a step event for each step
+  // but the last, one iteration event and one end event...
+  sequence.addStep ( 0,   LED_ON );
+  sequence.addStep ( 100, LED_OFF );
+  sequence.addStep ( 100, LED_ON );
+  memset ( &eventLog, 0, sizeof eventLog );
+  controller.installSequence ( &sequence );
+  controller.setSequenceRepeatCount ( 2 );
+  startTime = hostMillis;
+  controller.startSequence ();
+  runFor ( controller, 1000 );
+  CWW_TEST_CHECK ( eventLog.counts[LED_EVENT_STEP]         == 5 );
+  CWW_TEST_CHECK ( eventLog.counts[LED_EVENT_ITERATION]    == 1 );
+  CWW_TEST_CHECK ( eventLog.counts[LED_EVENT_SEQUENCE_END] == 1 );
+  CWW_TEST_CHECK ( eventLog.counts[LED_EVENT_PHASES_DONE]  == 0 );
+  CWW_TEST_CHECK ( eventLog.lastTimes[LED_EVENT_ITERATION]    - startTime == 200 );
+  CWW_TEST_CHECK ( eventLog.lastTimes[LED_EVENT_SEQUENCE_END] - startTime == 400 );
+  CWW_TEST_CHECK ( ! controller.isPlayingSequence () );
+
+  // Endless play sends no end event...
+  memset ( &eventLog, 0, sizeof eventLog );
+  controller.setSequenceRepeatCount ( 0 );
+  controller.startSequence ();
+  runFor ( controller, 1000 );
+  CWW_TEST_CHECK ( eventLog.counts[LED_EVENT_ITERATION] == 5 && eventLog.counts[LED_EVENT_SEQUENCE_END] == 0 );
+  controller.stopSequence ();
+  controller.removeSequence ();
+
+  // Four blink phases of 500 ms send one phases done event, as the last
+  // phase starts; a callback may start the next blink, even of the same
+  // mode...
+  memset ( &eventLog, 0, sizeof eventLog );
+  eventLog.restartPhases = 2;
+  startTime = hostMillis;
+  controller.blink ( 4 );
+  runFor ( controller, 1600 );
+  CWW_TEST_CHECK ( eventLog.counts[LED_EVENT_PHASES_DONE] == 1 );
+  CWW_TEST_CHECK ( sentNear ( eventLog.lastTimes[LED_EVENT_PHASES_DONE] - startTime, 1500 ) );
+  CWW_TEST_CHECK ( controller.currentMode () == LED_BLINK_MAX );
+  runFor ( controller, 1000 );
+  CWW_TEST_CHECK ( eventLog.counts[LED_EVENT_PHASES_DONE] == 2 );
+  CWW_TEST_CHECK ( sentNear ( eventLog.lastTimes[LED_EVENT_PHASES_DONE] - startTime, 2000 ) );
+  CWW_TEST_CHECK ( controller.currentMode () == LED_ON || controller.currentMode () == LED_OFF );
+  CWW_TEST_CHECK ( eventLog.counts[LED_EVENT_STEP] == 0 && eventLog.counts[LED_EVENT_ITERATION] == 0 );
+
+  // Without a callback, nothing is sent...
+  memset ( &eventLog, 0, sizeof eventLog );
+  controller.setEventCallback ( NULL );
+  controller.blink ( 2 );
+  runFor ( controller, 2000 );
+  CWW_TEST_CHECK ( eventLog.counts[LED_EVENT_PHASES_DONE] == 0 );
+
+  // Forward, the steps show 0, 100, 200 and 400 ms apart...
+  traced.addStep ( 0,   LED_HOLD_LEVEL, 10 );
+  traced.addStep ( 100, LED_HOLD_LEVEL, 20 );
+  traced.addStep ( 200, LED_HOLD_LEVEL, 30 );
+  traced.addStep ( 400, LED_HOLD_LEVEL, 40 );
+  controller.turnOff ();
+  controller.installSequence ( &traced );
+  controller.setSequenceRepeatCount ( 1 );
+  startTime = hostMillis;
+  controller.startSequence ();
+  CWW_TEST_CHECK ( traceUntil ( controller, startTime, 1000, stepTimes ) && traceIs ( stepTimes, 1, 100, 300, 700 ) );
+
+  // ...in reverse, last to first, with the delays mirrored...
+  controller.turnOff ();
+  controller.setSequenceReverse ( true );
+  startTime = hostMillis;
+  controller.startSequence ();
+  CWW_TEST_CHECK ( traceUntil ( controller, startTime, 1000, stepTimes ) && traceIs ( stepTimes, 700, 600, 400, 1 ) );
+  controller.setSequenceReverse ( false );
+
+  // ...at rate 2.0 in half the time, reverse or not...
+  controller.turnOff ();
+  CWW_TEST_CHECK ( controller.setSequenceRate ( 2 * SEQUENCE_RATE_NORMAL ) );
+  startTime = hostMillis;
+  controller.startSequence ();
+  CWW_TEST_CHECK ( traceUntil ( controller, startTime, 1000, stepTimes ) && traceIs ( stepTimes, 1, 50, 150, 350 ) );
+  controller.turnOff ();
+  controller.setSequenceReverse ( true );
+  startTime = hostMillis;
+  controller.startSequence ();
+  CWW_TEST_CHECK ( traceUntil ( controller, startTime, 1000, stepTimes ) && traceIs ( stepTimes, 350, 300, 200, 1 ) );
+  controller.setSequenceReverse ( false );
+  controller.setSequenceRate ( SEQUENCE_RATE_NORMAL );
+
+  // A rate change mid step keeps the part of the delay already played:
+  // 100 of the 200 ms to step 2 at rate 1.0, the rest at rate 2.0...
+  controller.turnOff ();
+  startTime = hostMillis;
+  controller.startSequence ();
+  traceUntil ( controller, startTime, 201, stepTimes );
+  controller.setSequenceRate ( 2 * SEQUENCE_RATE_NORMAL );
+  CWW_TEST_CHECK ( traceUntil ( controller, startTime, 1000, stepTimes ) && traceIs ( stepTimes, 1, 100, 250, 450 ) );
+  controller.setSequenceRate ( SEQUENCE_RATE_NORMAL );
+
+  // Paused with 150 ms left to step 2, and resumed a second later...
+  controller.turnOff ();
+  startTime = hostMillis;
+  controller.startSequence ();
+  traceUntil ( controller, startTime, 151, stepTimes );
+  controller.pauseSequence ();
+  CWW_TEST_CHECK ( controller.isSequencePaused () && controller.millisUntilUpdate () == UPDATE_NOT_SCHEDULED );
+  traceUntil ( controller, startTime, 1151, stepTimes );
+  CWW_TEST_CHECK ( hostPinValues[30] == 20 );
+  CWW_TEST_CHECK ( controller.resumeSequence () );
+  CWW_TEST_CHECK ( traceUntil ( controller, startTime, 2000, stepTimes ) && traceIs ( stepTimes, 1, 100, 1300, 1700 ) );
+
+  // ...likewise when stopped by a mode change, which shows meanwhile...
+  controller.turnOff ();
+  startTime = hostMillis;
+  controller.startSequence ();
+  traceUntil ( controller, startTime, 151, stepTimes );
+  controller.setMode ( LED_ON );
+  CWW_TEST_CHECK ( ! controller.isPlayingSequence () && hostPinValues[30] == 255 );
+  traceUntil ( controller, startTime, 1151, stepTimes );
+  CWW_TEST_CHECK ( controller.resumeSequence () );
+  CWW_TEST_CHECK ( traceUntil ( controller, startTime, 2000, stepTimes ) && traceIs ( stepTimes, 1, 100, 1300, 1700 ) );
+  CWW_TEST_CHECK ( ! controller.resumeSequence () );
+  controller.removeSequence ();
+
+  return cwwTestSummary ( "CwwLedControllerTest" );
+
+}
+
+// ****************************************************************************
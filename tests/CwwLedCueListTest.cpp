@@ -0,0 +1,159 @@
+// ****************************************************************************
+//
+// LED Cue List Test
+// -----------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedCueList on a virtual timebase: tracking (channels a
+// cue does not list keep their levels), split fade times, follow cues on
+// time even when updates come late, back() with the back time, goTo(),
+// the end of the list and looping, and millisUntilUpdate() as the only
+// guide of a loop that jumps from update to update.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+#include <CwwLedCueList.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_CHANNELS  4
+
+// ----------------------------------------------------------------------------
+
+static unsigned long virtualTime;
+
+static const cwwStructLedSceneEntry cuePreset[] = {
+  CWW_LED_SCENE_LEVEL ( 0, 0 ),
+  CWW_LED_SCENE_LEVEL ( 1, 0 ),
+  CWW_LED_SCENE_LEVEL ( 2, 0 ),
+  CWW_LED_SCENE_MODE  ( 3, LED_OFF )
+};
+static const cwwStructLedSceneEntry cueDoors[] = {
+  CWW_LED_SCENE_LEVEL ( 0, 200 ),
+  CWW_LED_SCENE_LEVEL ( 1, 100 )
+};
+static const cwwStructLedSceneEntry cueSpots[] = {
+  CWW_LED_SCENE_LEVEL ( 1, 0 ),
+  CWW_LED_SCENE_LEVEL ( 2, 250 )
+};
+static const cwwStructLedSceneEntry cueWarning[] = {
+  CWW_LED_SCENE_MODE ( 3, LED_ON )
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long virtualMillis () {
+
+  return virtualTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void runFor ( CwwLedCueList & list, unsigned long durationMs, unsigned long loopMs ) {
+
+  unsigned long endTime;
+
+  endTime = virtualTime + durationMs;
+  while ( virtualTime < endTime ) {
+    virtualTime += loopMs;
+    if ( list.updateIsDue () ) list.updateNow ();
+  }
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedBank       bank ( TEST_CHANNELS );
+  CwwLedController controllers[TEST_CHANNELS] = { { 50, true }, { 51, true }, { 52, true }, { 53, true } };
+  CwwLedCueList    list ( bank );
+  uint8_t          channelIndex;
+  unsigned long    untilUpdate;
+  unsigned long    updateCount;
+  unsigned long    goTime;
+
+  virtualTime = 1000;
+  CwwLedTimebase::setTimeSource ( virtualMillis );
+
+  for ( channelIndex = 0; channelIndex < TEST_CHANNELS; channelIndex++ ) bank.addChannel ( &controllers[channelIndex] );
+  CWW_TEST_CHECK ( list.addCue ( cuePreset,  4 ) == 0 );
+  CWW_TEST_CHECK ( list.addCue ( cueDoors,   2, 1000, 500, 2000 ) == 1 );
+  CWW_TEST_CHECK ( list.addCue ( cueSpots,   2, 200,  500 ) == 2 );
+  CWW_TEST_CHECK ( list.addCue ( cueWarning, 1 ) == 3 );
+  CWW_TEST_CHECK ( list.valueOfCue () == LED_CUE_NONE && list.valueOfCueCount () == 4 );
+
+  // Preset at once, then the doors fade up over 1 s...
+  CWW_TEST_CHECK ( list.go () && list.valueOfCue () == 0 );
+  CWW_TEST_CHECK ( controllers[0].currentLevel () == 0 && ! list.isFading () );
+  CWW_TEST_CHECK ( list.go () && list.valueOfCue () == 1 && list.isFollowing () );
+  runFor ( list, 500, 1 );
+  CWW_TEST_CHECK ( controllers[0].currentLevel () >= 98 && controllers[0].currentLevel () <= 102 );
+  CWW_TEST_CHECK ( controllers[1].currentLevel () >= 48 && controllers[1].currentLevel () <= 52 );
+  runFor ( list, 520, 1 );
+  CWW_TEST_CHECK ( controllers[0].currentLevel () == 200 && controllers[1].currentLevel () == 100 );
+  CWW_TEST_CHECK ( ! list.isFading () && list.isFollowing () );
+
+  // The follow comes 2 s after the go, even with a loop 7 ms late; spots
+  // rise over 200 ms, channel 1 falls over 500 ms, channel 0 tracks...
+  runFor ( list, 975, 7 );
+  CWW_TEST_CHECK ( list.valueOfCue () == 2 && ! list.isFollowing () );
+  runFor ( list, 3230 - virtualTime, 1 );
+  CWW_TEST_CHECK ( controllers[2].currentLevel () == 250 );
+  CWW_TEST_CHECK ( controllers[1].currentLevel () > 0 && controllers[1].currentLevel () < 100 );
+  runFor ( list, 300, 1 );
+  CWW_TEST_CHECK ( controllers[1].currentLevel () == 0 && controllers[0].currentLevel () == 200 );
+
+  // Back to the doors over the back time; no follow from there...
+  list.setBackTime ( 400 );
+  CWW_TEST_CHECK ( list.back () && list.valueOfCue () == 1 && ! list.isFollowing () );
+  runFor ( list, 420, 1 );
+  CWW_TEST_CHECK ( controllers[1].currentLevel () == 100 && controllers[2].currentLevel () == 0 );
+
+  // Jump to the warning; modes change at once, levels track...
+  CWW_TEST_CHECK ( list.goTo ( 3 ) && list.valueOfCue () == 3 );
+  CWW_TEST_CHECK ( controllers[3].currentMode () == LED_ON && controllers[3].currentLevel () == 255 );
+  CWW_TEST_CHECK ( controllers[0].currentLevel () == 200 && controllers[2].currentLevel () == 250 );
+  runFor ( list, 520, 1 );
+  CWW_TEST_CHECK ( controllers[1].currentLevel () == 0 );
+
+  // End of the list, then around it...
+  CWW_TEST_CHECK ( ! list.go () && list.valueOfCue () == 3 );
+  CWW_TEST_CHECK ( ! list.goTo ( 4 ) );
+  list.setLoop ( true );
+  CWW_TEST_CHECK ( list.go () && list.valueOfCue () == 0 );
+  for ( channelIndex = 0; channelIndex < TEST_CHANNELS; channelIndex++ ) {
+    CWW_TEST_CHECK ( controllers[channelIndex].currentLevel () == 0 );
+  }
+
+  // A loop guided by millisUntilUpdate alone refreshes the fade once per
+  // refresh interval, then sleeps until the follow, which comes on time...
+  CWW_TEST_CHECK ( list.millisUntilUpdate () == UPDATE_NOT_SCHEDULED );
+  goTime = virtualTime;
+  CWW_TEST_CHECK ( list.go () && list.valueOfCue () == 1 );
+  updateCount = 0;
+  while ( list.valueOfCue () == 1 && updateCount < 1000 ) {
+    untilUpdate = list.millisUntilUpdate ();
+    if ( untilUpdate == UPDATE_NOT_SCHEDULED ) break;
+    virtualTime += untilUpdate;
+    if ( list.updateNow () ) updateCount++;
+  }
+  CWW_TEST_CHECK ( list.valueOfCue () == 2 && virtualTime - goTime == 2000 );
+  CWW_TEST_CHECK ( updateCount >= 1000UL / list.valueOfRefreshInterval () && updateCount <= 1000UL / list.valueOfRefreshInterval () + 3 );
+  CWW_TEST_CHECK ( controllers[0].currentLevel () == 200 && controllers[1].currentLevel () == 100 );
+
+  CwwLedTimebase::setTimeSource ( NULL );
+
+  return cwwTestSummary ( "CwwLedCueListTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,202 @@
+// ****************************************************************************
+//
+// LED Daemon Test
+// ---------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Multi-process host test of CwwLedDaemon and CwwLedDaemonClient: forked
+// client processes post commands to the ring concurrently while the daemon
+// services it; the state mirror, as read from another process, and the
+// pins must then show the last command of each client. Also checks that a
+// second daemon does not take over the object of a running one, nor that
+// of one still setting it up, and that the object of a daemon that died
+// is replaced.
+//
+// ****************************************************************************
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+#include <CwwLedDaemon.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_SHM_NAME       "/CwwLedDaemonTest"
+#define TEST_CLIENT_COUNT   4
+#define TEST_COMMAND_COUNT  5000  // per client
+
+// ----------------------------------------------------------------------------
+
+static void runClient ( uint16_t channel ) {
+
+  CwwLedDaemonClient client;
+  unsigned int       commandIndex;
+
+  if ( ! client.attach ( TEST_SHM_NAME ) ) _exit ( 2 );
+
+  // Levels run up to 10 + channel, the last one posted; a full ring is
+  // retried...
+  for ( commandIndex = 0; commandIndex < TEST_COMMAND_COUNT; commandIndex++ ) {
+    while ( ! client.setLevel ( channel, (uint8_t) ( commandIndex - TEST_COMMAND_COUNT + 11 + channel ) ) ) {
+      usleep ( 10 );
+    }
+  }
+  if ( channel == 0 ) {
+    while ( ! client.setMode ( TEST_CLIENT_COUNT, LED_BLINK_MAX ) ) usleep ( 10 );
+  }
+
+  _exit ( 0 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static int runReader ( CwwLedController ** controllers ) {  // copies of the daemon's, as of fork
+
+  CwwLedDaemonClient client;
+  cwwEnumLedMode     mode;
+  uint8_t            level;
+  uint16_t           channel;
+
+  if ( ! client.attach ( TEST_SHM_NAME ) ) return 2;
+  if ( client.valueOfChannelCount () != TEST_CLIENT_COUNT + 1 ) return 3;
+
+  for ( channel = 0; channel < TEST_CLIENT_COUNT; channel++ ) {
+    if ( ! client.readState ( channel, &mode, &level ) ) return 4;
+    if ( mode != controllers[channel]->currentMode () || level != 10 + channel ) return 5;
+  }
+  if ( ! client.readState ( TEST_CLIENT_COUNT, &mode, &level ) || mode != LED_BLINK_MAX ) return 6;
+
+  return 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static int waitForChild ( pid_t childPid ) {
+
+  int status;
+
+  if ( waitpid ( childPid, &status, 0 ) != childPid || ! WIFEXITED ( status ) ) return -1;
+
+  return WEXITSTATUS ( status );
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedController * controllers[TEST_CLIENT_COUNT + 1];
+  CwwLedBank         bank ( TEST_CLIENT_COUNT + 1 );
+  pid_t              childPids[TEST_CLIENT_COUNT];
+  pid_t              childPid;
+  int                exitStatus;
+  int                runningCount;
+  uint16_t           channel;
+
+  for ( channel = 0; channel <= TEST_CLIENT_COUNT; channel++ ) {
+    controllers[channel] = new CwwLedController ( 20 + channel, true );
+    bank.addChannel ( controllers[channel] );
+  }
+
+  shm_unlink ( TEST_SHM_NAME );
+
+  // The object of a daemon that died without end() is replaced...
+  childPid = fork ();
+  if ( childPid == 0 ) {
+    CwwLedDaemon daemon ( bank, TEST_SHM_NAME );
+    _exit ( daemon.begin () ? 0 : 1 );  // no destructor: object stays behind
+  }
+  CWW_TEST_CHECK ( waitForChild ( childPid ) == 0 );
+
+  // A daemon still setting up its object (full size, owner not yet
+  // recorded) holds the lock; its object is left alone...
+  {
+    CwwLedDaemon daemon ( bank, TEST_SHM_NAME );
+    int          lockFd;
+    int          shmFd;
+    lockFd = shm_open ( TEST_SHM_NAME CWW_LED_DAEMON_LOCK_SUFFIX, O_CREAT | O_RDWR, 0660 );
+    CWW_TEST_CHECK ( lockFd >= 0 && flock ( lockFd, LOCK_EX ) == 0 );
+    shm_unlink ( TEST_SHM_NAME );
+    shmFd = shm_open ( TEST_SHM_NAME, O_CREAT | O_EXCL | O_RDWR, 0660 );
+    CWW_TEST_CHECK ( shmFd >= 0 && ftruncate ( shmFd, 4096 ) == 0 );
+    close ( shmFd );
+    CWW_TEST_CHECK ( ! daemon.begin () );
+    shmFd = shm_open ( TEST_SHM_NAME, O_RDONLY, 0 );
+    CWW_TEST_CHECK ( shmFd >= 0 );
+    close ( shmFd );
+    close ( lockFd );
+  }
+
+  {
+    CwwLedDaemon daemon ( bank, TEST_SHM_NAME );
+    CwwLedDaemon rival  ( bank, TEST_SHM_NAME );
+
+    CWW_TEST_CHECK ( daemon.begin () );
+
+    // A second daemon leaves the object of the running one alone...
+    CWW_TEST_CHECK ( ! rival.begin () );
+    childPid = fork ();
+    if ( childPid == 0 ) {
+      CwwLedDaemon other ( bank, TEST_SHM_NAME );
+      _exit ( other.begin () ? 1 : 0 );
+    }
+    CWW_TEST_CHECK ( waitForChild ( childPid ) == 0 );
+
+    // Clients post concurrently while the daemon services the ring...
+    for ( channel = 0; channel < TEST_CLIENT_COUNT; channel++ ) {
+      childPids[channel] = fork ();
+      if ( childPids[channel] == 0 ) runClient ( channel );
+    }
+
+    runningCount = TEST_CLIENT_COUNT;
+    while ( runningCount > 0 ) {
+      daemon.serviceNow ();
+      while ( waitpid ( -1, &exitStatus, WNOHANG ) > 0 ) {
+        CWW_TEST_CHECK ( WIFEXITED ( exitStatus ) && WEXITSTATUS ( exitStatus ) == 0 );
+        runningCount--;
+      }
+    }
+    daemon.serviceNow ();
+
+    CWW_TEST_CHECK ( daemon.valueOfAppliedCount () == TEST_CLIENT_COUNT * TEST_COMMAND_COUNT + 1 );
+    for ( channel = 0; channel < TEST_CLIENT_COUNT; channel++ ) {
+      CWW_TEST_CHECK ( controllers[channel]->currentLevel () == 10 + channel );
+      CWW_TEST_CHECK ( hostPinValues[20 + channel] == 10 + channel );
+    }
+    CWW_TEST_CHECK ( controllers[TEST_CLIENT_COUNT]->currentMode () == LED_BLINK_MAX );
+
+    // The state mirror shows the same to another process...
+    childPid = fork ();
+    if ( childPid == 0 ) _exit ( runReader ( controllers ) );
+    CWW_TEST_CHECK ( waitForChild ( childPid ) == 0 );
+
+    daemon.end ();
+  }
+
+  // Once the daemon has ended, clients can no longer attach...
+  {
+    CwwLedDaemonClient client;
+    CWW_TEST_CHECK ( ! client.attach ( TEST_SHM_NAME ) );
+  }
+
+  shm_unlink ( TEST_SHM_NAME CWW_LED_DAEMON_LOCK_SUFFIX );  // no daemon left to hold it
+  for ( channel = 0; channel <= TEST_CLIENT_COUNT; channel++ ) delete controllers[channel];
+
+  return cwwTestSummary ( "CwwLedDaemonTest" );
+
+}
+
+// ****************************************************************************
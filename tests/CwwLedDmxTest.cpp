@@ -0,0 +1,144 @@
+// ****************************************************************************
+//
+// LED DMX Test
+// ------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedDmx, first fed directly as the UART interrupt would
+// feed it, then through a CwwLedDmxPort on a pseudo terminal, with the
+// test playing the console on the master side:
+//
+// - frames shorter than the block (which only end at the next break) must
+//   all be applied, one frame late, with missing slots kept,
+// - full frames must be applied at once, level and mode slots alike, and
+// - a frame completed while another waits for updateNow() is dropped.
+//
+// ****************************************************************************
+
+#include <fcntl.h>
+#include <pty.h>
+#include <unistd.h>
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+#include <CwwLedDmx.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_CHANNELS      8
+#define TEST_SHORT_SLOTS   4
+#define TEST_FRAMES        20
+
+// ----------------------------------------------------------------------------
+
+static void sendFrame ( CwwLedDmx & dmx, const uint8_t * slots, uint16_t slotCount ) {
+
+  uint16_t slotIndex;
+
+  dmx.receiveBreak ();
+  dmx.receiveByte  ( 0 );
+  for ( slotIndex = 0; slotIndex < slotCount; slotIndex++ ) dmx.receiveByte ( slots[slotIndex] );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void fillSlots ( uint8_t * slots, uint8_t frameIndex ) {
+
+  uint8_t slotIndex;
+
+  for ( slotIndex = 0; slotIndex < TEST_CHANNELS; slotIndex++ ) slots[slotIndex] = 10 * frameIndex + slotIndex + 1;
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedBank       bank ( TEST_CHANNELS );
+  CwwLedController controllers[TEST_CHANNELS] = { { 30, true }, { 31, true }, { 32, true }, { 33, true },
+                                                  { 34, true }, { 35, true }, { 36, true }, { 37, true } };
+  CwwLedDmx        dmx ( bank, 1, TEST_CHANNELS );
+  CwwLedDmxPort    port;
+  uint8_t          slots[TEST_CHANNELS];
+  uint8_t          frameIndex;
+  uint8_t          appliedCount;
+  uint8_t          wrongCount;
+  uint8_t          slotIndex;
+  int              masterFd;
+  int              slaveFd;
+  char             slaveName[64];
+
+  for ( slotIndex = 0; slotIndex < TEST_CHANNELS; slotIndex++ ) bank.addChannel ( &controllers[slotIndex] );
+
+  // Short frames end at the next break; each is applied while the next
+  // one arrives...
+  appliedCount = 0;
+  wrongCount   = 0;
+  for ( frameIndex = 0; frameIndex < TEST_FRAMES; frameIndex++ ) {
+    fillSlots ( slots, frameIndex );
+    sendFrame ( dmx, slots, TEST_SHORT_SLOTS );
+    if ( dmx.updateNow () ) {
+      appliedCount++;
+      if ( dmx.valueOfSlot ( 0 ) != 10 * ( frameIndex - 1 ) + 1 || dmx.valueOfSlot ( TEST_SHORT_SLOTS ) != 0 ) wrongCount++;
+    }
+  }
+  CWW_TEST_CHECK ( appliedCount == TEST_FRAMES - 1 );
+  CWW_TEST_CHECK ( wrongCount == 0 );
+  CWW_TEST_CHECK ( dmx.valueOfDropCount () == 0 );
+  CWW_TEST_CHECK ( controllers[TEST_SHORT_SLOTS - 1].currentLevel () == 10 * ( TEST_FRAMES - 2 ) + TEST_SHORT_SLOTS );
+
+  // The break of the first full frame ends the last short frame...
+  dmx.receiveBreak ();
+  CWW_TEST_CHECK ( dmx.updateNow () && dmx.valueOfSlot ( 0 ) == 10 * ( TEST_FRAMES - 1 ) + 1 );
+
+  // Full frames are applied at once; a mode slot triggers its mode...
+  dmx.setSlotKind ( 7, LED_DMX_MODE );
+  fillSlots ( slots, 1 );
+  slots[7] = LED_ON * 10 + 5;
+  sendFrame ( dmx, slots, TEST_CHANNELS );
+  CWW_TEST_CHECK ( dmx.updateNow () );
+  CWW_TEST_CHECK ( controllers[6].currentLevel () == 17 && controllers[TEST_SHORT_SLOTS].currentLevel () == 15 );
+  CWW_TEST_CHECK ( controllers[7].currentMode () == LED_ON );
+  CWW_TEST_CHECK ( ! dmx.updateIsDue () );
+
+  // A frame completed while another waits is dropped...
+  fillSlots ( slots, 2 );
+  sendFrame ( dmx, slots, TEST_CHANNELS );
+  fillSlots ( slots, 3 );
+  sendFrame ( dmx, slots, TEST_CHANNELS );
+  CWW_TEST_CHECK ( dmx.valueOfDropCount () == 1 );
+  CWW_TEST_CHECK ( dmx.updateNow () && dmx.valueOfSlot ( 0 ) == 21 );
+  fillSlots ( slots, 4 );
+  sendFrame ( dmx, slots, TEST_CHANNELS );
+  CWW_TEST_CHECK ( dmx.updateNow () && dmx.valueOfSlot ( 0 ) == 41 );
+
+  // Short frames through a pseudo terminal, with marked breaks...
+  CWW_TEST_CHECK ( openpty ( &masterFd, &slaveFd, slaveName, NULL, NULL ) == 0 );
+  CWW_TEST_CHECK ( port.open ( slaveName, true ) );
+  appliedCount = 0;
+  for ( frameIndex = 5; frameIndex < 5 + TEST_FRAMES; frameIndex++ ) {
+    fillSlots ( slots, frameIndex );
+    slots[1] = 0xFF;  // doubled when marked
+    CWW_TEST_CHECK ( CwwLedDmxPort::writeFrame ( masterFd, slots, TEST_SHORT_SLOTS ) );
+    usleep ( 2000 );
+    port.receive ( dmx );
+    if ( dmx.updateNow () ) appliedCount++;
+  }
+  CWW_TEST_CHECK ( appliedCount == TEST_FRAMES - 1 );
+  CWW_TEST_CHECK ( dmx.valueOfSlot ( 0 ) == 10 * ( 3 + TEST_FRAMES ) + 1 && dmx.valueOfSlot ( 1 ) == 0xFF );
+  CWW_TEST_CHECK ( dmx.valueOfDropCount () == 1 );
+
+  port.close ();
+  close ( slaveFd );
+  close ( masterFd );
+
+  return cwwTestSummary ( "CwwLedDmxTest" );
+
+}
+
+// ****************************************************************************
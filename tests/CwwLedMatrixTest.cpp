@@ -0,0 +1,171 @@
+// ****************************************************************************
+//
+// LED Matrix Output Test
+// ----------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedMatrix: runs the bit plane scan of a small matrix,
+// recording row selection and column drive, and checks the duty of each
+// cell against its level (at full and reduced bit depth), that the columns
+// are blanked before every row switch, the pins of the default pin
+// handling, and the latching of new bit planes at frame boundaries.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedMatrix.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_ROWS   3
+#define TEST_COLS   4
+#define TEST_CELLS  ( TEST_ROWS * TEST_COLS )
+
+// ----------------------------------------------------------------------------
+
+class MatrixProbe : public CwwLedMatrix {
+
+  public:
+
+    MatrixProbe ( const uint8_t * rowPins, const uint8_t * colPins, uint8_t bitDepth )
+      : CwwLedMatrix ( rowPins, TEST_ROWS, colPins, TEST_COLS, false, true, bitDepth ) {
+      lastRow        = 0xFF;
+      lastMask       = 0;
+      unblankedCount = 0;
+      switchCount    = 0;
+    }
+
+    uint8_t       lastRow;
+    uint16_t      lastMask;
+    unsigned long unblankedCount;  // row switches with columns still lit
+    unsigned long switchCount;
+
+  protected:
+
+    virtual void selectRow ( uint8_t row ) {
+      if ( lastMask != 0 ) unblankedCount++;
+      switchCount++;
+      lastRow = row;
+      CwwLedMatrix::selectRow ( row );
+    }
+
+    virtual void driveColumns ( uint16_t columnMask ) {
+      lastMask = columnMask;
+      CwwLedMatrix::driveColumns ( columnMask );
+    }
+
+};
+
+// ----------------------------------------------------------------------------
+
+static const uint8_t testRowPins[TEST_ROWS] = { 10, 11, 12 };
+static const uint8_t testColPins[TEST_COLS] = { 20, 21, 22, 23 };
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long scanFrames ( MatrixProbe & probe, unsigned int frameCount, unsigned long * litTicks ) {
+
+  unsigned long totalTicks;
+  unsigned long slotTicks;
+  uint8_t       col;
+
+  // Each call shows the columns it drove until the next call...
+  memset ( litTicks, 0, TEST_CELLS * sizeof ( unsigned long ) );
+  totalTicks = 0;
+  while ( totalTicks < (unsigned long) probe.valueOfTicksPerFrame () * frameCount ) {
+    slotTicks = probe.scanIsr ();
+    for ( col = 0; col < TEST_COLS; col++ ) {
+      if ( probe.lastMask & ( 1 << col ) ) litTicks[probe.channelOf ( probe.lastRow, col )] += slotTicks;
+    }
+    totalTicks += slotTicks;
+  }
+
+  return totalTicks;
+
+}
+
+// ============================================================================
+
+int main () {
+
+  unsigned long litTicks[TEST_CELLS];
+  unsigned long totalTicks;
+  uint8_t       channel;
+  uint8_t       wrongCount;
+
+  // Duty of each cell is its level over a frame per row of 255 ticks;
+  // exact over whole frames, with the columns blanked at each row switch...
+  {
+    MatrixProbe probe ( testRowPins, testColPins, 8 );
+    probe.begin ();
+    for ( channel = 0; channel < TEST_CELLS; channel++ ) probe.writeLevel ( channel, channel * 23, true );
+    probe.commitFrame ();
+    CWW_TEST_CHECK ( probe.valueOfTicksPerFrame () == TEST_ROWS * 255 );
+    totalTicks = scanFrames ( probe, 10, litTicks );
+    CWW_TEST_CHECK ( totalTicks == TEST_ROWS * 255UL * 10 );
+    wrongCount = 0;
+    for ( channel = 0; channel < TEST_CELLS; channel++ ) {
+      if ( litTicks[channel] != channel * 23UL * 10 ) wrongCount++;
+    }
+    CWW_TEST_CHECK ( wrongCount == 0 );
+    CWW_TEST_CHECK ( probe.switchCount == TEST_ROWS * 10UL && probe.unblankedCount == 0 );
+  }
+
+  // At reduced bit depth, the low level bits are dropped...
+  {
+    MatrixProbe probe ( testRowPins, testColPins, 4 );
+    for ( channel = 0; channel < TEST_CELLS; channel++ ) probe.writeLevel ( channel, channel * 23, true );
+    probe.commitFrame ();
+    totalTicks = scanFrames ( probe, 5, litTicks );
+    CWW_TEST_CHECK ( totalTicks == TEST_ROWS * 15UL * 5 );
+    wrongCount = 0;
+    for ( channel = 0; channel < TEST_CELLS; channel++ ) {
+      if ( litTicks[channel] != ( channel * 23UL >> 4 ) * 5 ) wrongCount++;
+    }
+    CWW_TEST_CHECK ( wrongCount == 0 );
+    CWW_TEST_CHECK ( probe.unblankedCount == 0 );
+  }
+
+  // Default pin handling: the selected row high, lit columns low; a cell
+  // without PWM is at full or off. Levels come from a controller...
+  {
+    MatrixProbe      probe ( testRowPins, testColPins, 8 );
+    CwwLedController controller ( probe, probe.channelOf ( 1, 2 ) );
+    probe.begin ();
+    controller.turnOn ();
+    probe.commitFrame ();
+    scanFrames ( probe, 1, litTicks );
+    CWW_TEST_CHECK ( litTicks[probe.channelOf ( 1, 2 )] == 255 );
+    while ( probe.lastRow != 1 || probe.lastMask == 0 ) probe.scanIsr ();
+    CWW_TEST_CHECK ( hostPinValues[testRowPins[1]] == 255 && hostPinValues[testRowPins[0]] == 0 );
+    CWW_TEST_CHECK ( hostPinValues[testColPins[2]] == 0 && hostPinValues[testColPins[1]] == 255 );
+  }
+
+  // New levels are shown from the next frame on; a commit while the scan
+  // has not yet taken the last one stays pending...
+  {
+    MatrixProbe probe ( testRowPins, testColPins, 8 );
+    probe.writeLevel ( 0, 100, true );
+    probe.commitFrame ();
+    CWW_TEST_CHECK ( probe.scanIsr () == 1 );
+    probe.writeLevel ( 0, 200, true );
+    probe.commitFrame ();
+    while ( probe.lastRow != TEST_ROWS - 1 ) probe.scanIsr ();
+    probe.writeLevel ( 0, 50, true );
+    probe.commitFrame ();
+    scanFrames ( probe, 1, litTicks );
+    CWW_TEST_CHECK ( litTicks[0] == 200 );
+    probe.commitFrame ();
+    scanFrames ( probe, 1, litTicks );
+    CWW_TEST_CHECK ( litTicks[0] == 50 );
+  }
+
+  return cwwTestSummary ( "CwwLedMatrixTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,372 @@
+// ****************************************************************************
+//
+// LED MIDI Player Test
+// --------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedMidiPlayer on Standard MIDI Files generated here: the
+// same show as a format 1 file (tempo map in its own track, notes and
+// control changes in two more) and as a format 0 file (all in one track).
+// Both use running status (restated after meta events, which cancel it)
+// and three tempos. Time is virtual (see CwwLedTimebase::setTimeSource)
+// and steps by 1 ms; every level change is checked against the time of its
+// event computed from the tempo map. A long run of notes checks that
+// rounding does not accumulate, and a control mapped to a level range
+// checks that both levels are scaled separately.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedController.h>
+#include <CwwLedMidiPlayer.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_FILE_CAPACITY   8192
+#define TEST_TICKS           480      // per quarter note
+#define TEST_TRAIN_START     3000     // tick of first note of the long run
+#define TEST_TRAIN_LENGTH    600      // notes
+#define TEST_TRAIN_STEP      7        // ticks between notes
+#define TEST_MAX_CHANGES     ( 2 * TEST_TRAIN_LENGTH + 16 )
+
+// ----------------------------------------------------------------------------
+
+struct structTestChange {
+  unsigned long timeMs;
+  uint8_t       level;
+};
+
+static uint8_t          fileBuffer[TEST_FILE_CAPACITY];
+static uint32_t         fileLength;
+static uint32_t         trackStart;
+static uint32_t         lastTick;
+static unsigned long    virtualTime;
+static structTestChange expected[TEST_MAX_CHANGES];
+static uint16_t         expectedCount;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long virtualMillis () {
+
+  return virtualTime;
+
+}
+
+// ----------------------------------------------------------------------------
+// File Generation
+// ----------------------------------------------------------------------------
+
+static void putByte ( uint8_t value ) {
+
+  if ( fileLength < TEST_FILE_CAPACITY ) fileBuffer[fileLength++] = value;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void putWord ( uint32_t value, uint8_t byteCount ) {  // big endian
+
+  while ( byteCount-- > 0 ) putByte ( value >> ( 8 * byteCount ) );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void putDelta ( uint32_t tick ) {  // variable length delta from the last event
+
+  uint32_t delta;
+  uint8_t  byteCount;
+
+  delta    = tick - lastTick;
+  lastTick = tick;
+
+  for ( byteCount = 1; byteCount < 4 && delta >> ( 7 * byteCount ) != 0; byteCount++ );
+  while ( byteCount-- > 1 ) putByte ( 0x80 | ( delta >> ( 7 * byteCount ) ) );
+  putByte ( delta & 0x7F );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void beginFile ( uint16_t format, uint16_t trackCount ) {
+
+  fileLength = 0;
+  putWord ( 0x4D546864, 4 );  // MThd
+  putWord ( 6,          4 );
+  putWord ( format,     2 );
+  putWord ( trackCount, 2 );
+  putWord ( TEST_TICKS, 2 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void beginTrack () {
+
+  putWord ( 0x4D54726B, 4 );  // MTrk
+  putWord ( 0,          4 );  // length, set by endTrack
+  trackStart = fileLength;
+  lastTick   = 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void endTrack ( uint32_t tick ) {
+
+  uint32_t trackLength;
+
+  putDelta ( tick );
+  putWord  ( 0xFF2F00, 3 );
+
+  trackLength = fileLength - trackStart;
+  fileBuffer[trackStart - 4] = trackLength >> 24;
+  fileBuffer[trackStart - 3] = trackLength >> 16;
+  fileBuffer[trackStart - 2] = trackLength >> 8;
+  fileBuffer[trackStart - 1] = trackLength;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void putTempo ( uint32_t tick, uint32_t microsPerQuarter ) {
+
+  putDelta ( tick );
+  putWord  ( 0xFF5103, 3 );
+  putWord  ( microsPerQuarter, 3 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void putEvent ( uint32_t tick, int16_t status, uint8_t data1, uint8_t data2 ) {  // status -1: running status
+
+  putDelta ( tick );
+  if ( status >= 0 ) putByte ( status );
+  putByte ( data1 );
+  putByte ( data2 );
+
+}
+
+// ----------------------------------------------------------------------------
+// The Show
+// ----------------------------------------------------------------------------
+//
+// Tempo: 500000 us per quarter note from tick 0, 250000 from tick 960,
+// 1000000 from tick 1920 (i.e. 120, 240 and 60 bpm)...
+
+static unsigned long timeOfTick ( uint32_t tick ) {
+
+  uint64_t micros;
+
+  if      ( tick <  960 ) micros = (uint64_t) tick * 500000 / TEST_TICKS;
+  else if ( tick < 1920 ) micros = 1000000 + (uint64_t) ( tick - 960  ) * 250000 / TEST_TICKS;
+  else                    micros = 1500000 + (uint64_t) ( tick - 1920 ) * 1000000 / TEST_TICKS;
+
+  return micros / 1000;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void putTempoMap () {
+
+  putTempo ( 0,    500000 );
+  putTempo ( 960,  250000 );
+  putTempo ( 1920, 1000000 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void putTrain () {  // after a note on of MIDI channel 1, running status
+
+  uint16_t noteIndex;
+  uint32_t tick;
+
+  for ( noteIndex = 0; noteIndex < TEST_TRAIN_LENGTH; noteIndex++ ) {
+    tick = TEST_TRAIN_START + (uint32_t) noteIndex * 2 * TEST_TRAIN_STEP;
+    putEvent ( tick,                   -1, 60, 1 + noteIndex % 126 );
+    putEvent ( tick + TEST_TRAIN_STEP, -1, 60, 0 );
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void putNotes () {  // MIDI channel 1, note 60; level changes of LED A
+
+  putEvent ( 0,    0x90, 60, 127 );
+  putEvent ( 480,  -1,   60, 0   );  // note on, velocity 0: off
+  putEvent ( 960,  -1,   60, 64  );
+  putEvent ( 1440, 0x80, 60, 0   );
+  putEvent ( 1920, 0x90, 60, 32  );
+  putEvent ( 2400, -1,   60, 0   );
+  putTrain ();
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void putControls () {  // MIDI channel 2, controller 7; level changes of LED B
+
+  putEvent ( 240,  0xB1, 7, 16  );
+  putEvent ( 1200, -1,   7, 80  );
+  putEvent ( 2160, -1,   7, 127 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void buildExpected () {  // changes of LED A
+
+  uint16_t noteIndex;
+  uint32_t tick;
+
+  expectedCount = 0;
+  expected[expectedCount++] = (structTestChange) { timeOfTick ( 0 ),    255 };
+  expected[expectedCount++] = (structTestChange) { timeOfTick ( 480 ),  0   };
+  expected[expectedCount++] = (structTestChange) { timeOfTick ( 960 ),  129 };
+  expected[expectedCount++] = (structTestChange) { timeOfTick ( 1440 ), 0   };
+  expected[expectedCount++] = (structTestChange) { timeOfTick ( 1920 ), 64  };
+  expected[expectedCount++] = (structTestChange) { timeOfTick ( 2400 ), 0   };
+
+  for ( noteIndex = 0; noteIndex < TEST_TRAIN_LENGTH; noteIndex++ ) {
+    tick = TEST_TRAIN_START + (uint32_t) noteIndex * 2 * TEST_TRAIN_STEP;
+    expected[expectedCount].timeMs   = timeOfTick ( tick );
+    expected[expectedCount++].level  = ( 1 + noteIndex % 126 ) << 1 | ( 1 + noteIndex % 126 ) >> 6;
+    expected[expectedCount].timeMs   = timeOfTick ( tick + TEST_TRAIN_STEP );
+    expected[expectedCount++].level  = 0;
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+
+static void playShow ( const char * name ) {
+
+  CwwLedMidiPlayer player ( 3, 4 );
+  CwwLedController ledA ( 20, true );
+  CwwLedController ledB ( 21, true );
+  unsigned long    endTime;
+  uint16_t         changeIndex;
+  uint16_t         failCount;
+  uint8_t          levelA;
+  uint8_t          levelB;
+  uint8_t          controlIndex;
+
+  static const unsigned long controlTimes[]  = { 250, 1125, 2000 };
+  static const uint8_t       controlLevels[] = { 32,  161,  255  };
+
+  CWW_TEST_CHECK ( player.load ( fileBuffer, fileLength ) == MIDI_ISSUE_NONE );
+  player.mapNote    ( 0, 60, &ledA, LED_HOLD_LEVEL, LED_OFF );
+  player.mapControl ( 1, 7,  &ledB );
+
+  virtualTime = 0;
+  endTime     = timeOfTick ( TEST_TRAIN_START + 2 * TEST_TRAIN_LENGTH * TEST_TRAIN_STEP ) + 10;
+  levelA      = ledA.currentLevel ();
+  levelB      = ledB.currentLevel ();
+  changeIndex  = 0;
+  controlIndex = 0;
+  failCount    = 0;
+
+  player.start ();
+  for ( ; virtualTime <= endTime; virtualTime++ ) {
+    if ( player.updateIsDue () ) player.updateNow ();
+    if ( ledA.currentLevel () != levelA ) {
+      levelA = ledA.currentLevel ();
+      if ( changeIndex >= expectedCount
+        || expected[changeIndex].timeMs != virtualTime || expected[changeIndex].level != levelA ) {
+        if ( failCount++ == 0 ) printf ( "%s: change %u of LED A to %u at %lu ms\n", name, changeIndex, levelA, virtualTime );
+      }
+      changeIndex++;
+    }
+    if ( ledB.currentLevel () != levelB ) {
+      levelB = ledB.currentLevel ();
+      if ( controlIndex >= 3 || controlTimes[controlIndex] != virtualTime || controlLevels[controlIndex] != levelB ) {
+        if ( failCount++ == 0 ) printf ( "%s: change %u of LED B to %u at %lu ms\n", name, controlIndex, levelB, virtualTime );
+      }
+      controlIndex++;
+    }
+  }
+
+  CWW_TEST_CHECK ( failCount == 0 );
+  CWW_TEST_CHECK ( changeIndex == expectedCount && controlIndex == 3 );
+  CWW_TEST_CHECK ( ! player.isPlaying () );
+  CWW_TEST_CHECK ( player.valueOfTempo () == 1000000 );
+
+}
+
+// ============================================================================
+
+int main () {
+
+  uint32_t endTick;
+
+  CwwLedTimebase::setTimeSource ( virtualMillis );
+  buildExpected ();
+  endTick = TEST_TRAIN_START + 2 * TEST_TRAIN_LENGTH * TEST_TRAIN_STEP;
+
+  // Format 1: tempo map, notes and controls in separate tracks...
+  beginFile ( 1, 3 );
+  beginTrack (); putTempoMap (); endTrack ( endTick );
+  beginTrack (); putNotes    (); endTrack ( endTick );
+  beginTrack (); putControls (); endTrack ( endTick );
+  CWW_TEST_CHECK ( fileLength < TEST_FILE_CAPACITY );
+  playShow ( "format 1" );
+
+  // Format 0: the same events merged into one track; running status
+  // changes between channels and restarts after each tempo event...
+  beginFile ( 0, 1 );
+  beginTrack ();
+  putTempo ( 0,    500000 );
+  putEvent ( 0,    0x90, 60, 127 );
+  putEvent ( 240,  0xB1, 7,  16  );
+  putEvent ( 480,  0x90, 60, 0   );
+  putTempo ( 960,  250000 );
+  putEvent ( 960,  0x90, 60, 64  );
+  putEvent ( 1200, 0xB1, 7,  80  );
+  putEvent ( 1440, 0x80, 60, 0   );
+  putTempo ( 1920, 1000000 );
+  putEvent ( 1920, 0x90, 60, 32  );
+  putEvent ( 2160, 0xB1, 7,  127 );
+  putEvent ( 2400, 0x90, 60, 0   );
+  putTrain ();
+  endTrack ( endTick );
+  CWW_TEST_CHECK ( fileLength < TEST_FILE_CAPACITY );
+  playShow ( "format 0" );
+
+  // A level range control scales the minimum and maximum separately...
+  {
+    CwwLedMidiPlayer player ( 1, 1 );
+    CwwLedController ledC ( 22, true );
+
+    beginFile ( 0, 1 );
+    beginTrack ();
+    putEvent ( 0,  0xB0, 8, 64  );
+    putEvent ( 10, -1,   8, 127 );
+    endTrack ( 20 );
+
+    CWW_TEST_CHECK ( player.load ( fileBuffer, fileLength ) == MIDI_ISSUE_NONE );
+    CWW_TEST_CHECK ( player.mapControl ( 0, 8, &ledC, LED_PARAM_LEVEL_RANGE, 0 | 100 << 8, 50 | 250 << 8 ) );
+
+    virtualTime = 0;
+    player.start ();
+    player.updateNow ();
+    CWW_TEST_CHECK ( ledC.valueOfLevelMin () == 25 && ledC.valueOfLevelMax () == 175 );
+    virtualTime = 10;
+    player.updateNow ();
+    CWW_TEST_CHECK ( ledC.valueOfLevelMin () == 50 && ledC.valueOfLevelMax () == 250 );
+  }
+
+  CwwLedTimebase::setTimeSource ( NULL );
+
+  return cwwTestSummary ( "CwwLedMidiPlayerTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,274 @@
+// ****************************************************************************
+//
+// LED Protocol Test
+// -----------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Loopback host test of CwwLedProtocolEncoder and CwwLedProtocol over a
+// pseudo terminal: frames built by the encoder are written to the master
+// side and decoded from the slave side (through receiveFrom and a Stream
+// on the file descriptor), as between a host PC and a board on a UART.
+// Checks the commands applied, frames split over several writes and
+// packed into one, and the rejection of frames with CRC errors, COBS
+// errors and overflow, each followed by resynchronization.
+//
+// ****************************************************************************
+
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <pty.h>
+#include <sys/ioctl.h>
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+#include <CwwLedProtocol.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_CHANNEL_COUNT  8
+#define TEST_FIRST_PIN      30
+
+// ----------------------------------------------------------------------------
+
+class FdStream : public Stream {
+
+  public:
+
+    FdStream ( int fd ) { this->fd = fd; readCount = 0; }
+
+    virtual int available () {
+      int count;
+      return ioctl ( fd, FIONREAD, &count ) == 0 ? count : 0;
+    }
+
+    virtual int read () {
+      uint8_t dataByte;
+      if ( ::read ( fd, &dataByte, 1 ) != 1 ) return -1;
+      readCount++;
+      return dataByte;
+    }
+
+    virtual size_t write ( uint8_t value ) { return ::write ( fd, &value, 1 ) == 1 ? 1 : 0; }
+
+    unsigned long readCount;
+
+  private:
+
+    int fd;
+
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static int            masterFd;
+static FdStream     * slaveStream;
+static unsigned long  writtenCount;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void setRaw ( int fd ) {
+
+  struct termios settings;
+
+  tcgetattr ( fd, &settings );
+  cfmakeraw ( &settings );
+  tcsetattr ( fd, TCSANOW, &settings );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void sendBytes ( const uint8_t * bytes, size_t count ) {
+
+  if ( write ( masterFd, bytes, count ) == (ssize_t) count ) writtenCount += count;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static uint16_t receiveAll ( CwwLedProtocol & protocol ) {  // returns valid frames
+
+  uint16_t validFrames;
+  int      idleCount;
+
+  // Bytes pass the pty asynchronously; read until all written bytes are
+  // in, giving up after about a second...
+  validFrames = 0;
+  for ( idleCount = 0; slaveStream->readCount < writtenCount && idleCount < 1000; idleCount++ ) {
+    validFrames += protocol.receiveFrom ( *slaveStream );
+    if ( slaveStream->readCount < writtenCount ) usleep ( 1000 );
+  }
+
+  return validFrames;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static int pinLevel ( uint8_t channel ) {
+
+  return hostPinValues[TEST_FIRST_PIN + channel];
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedController      * controllers[TEST_CHANNEL_COUNT];
+  CwwLedBank              bank ( TEST_CHANNEL_COUNT );
+  CwwLedProtocol          protocol ( bank );
+  CwwLedProtocolEncoder   encoder;
+  uint8_t                 frame[CWW_LED_PROTOCOL_MAX_FRAME];
+  uint8_t                 frames[3 * CWW_LED_PROTOCOL_MAX_FRAME];
+  uint8_t                 noise[300];
+  uint8_t                 levels[TEST_CHANNEL_COUNT];
+  uint8_t                 frameSize;
+  uint8_t                 payloadLength;
+  uint16_t                framesSize;
+  uint8_t                 byteIndex;
+  uint8_t                 channel;
+  int                     slaveFd;
+  uint32_t                errorCount;
+
+  for ( channel = 0; channel < TEST_CHANNEL_COUNT; channel++ ) {
+    controllers[channel] = new CwwLedController ( TEST_FIRST_PIN + channel, true );
+    bank.addChannel ( controllers[channel] );
+  }
+
+  if ( openpty ( &masterFd, &slaveFd, NULL, NULL, NULL ) != 0 ) {
+    printf ( "CwwLedProtocolTest: no pseudo terminal\n" );
+    return 1;
+  }
+  setRaw ( masterFd );
+  setRaw ( slaveFd );
+  slaveStream  = new FdStream ( slaveFd );
+  writtenCount = 0;
+
+  // One frame with several commands, zero bytes in the payload...
+  for ( channel = 0; channel < TEST_CHANNEL_COUNT; channel++ ) levels[channel] = 20 * channel;
+  encoder.beginFrame ();
+  CWW_TEST_CHECK ( encoder.addMode   ( 0, LED_ON ) );
+  CWW_TEST_CHECK ( encoder.addLevels ( 1, TEST_CHANNEL_COUNT - 2, levels + 1 ) );
+  CWW_TEST_CHECK ( encoder.addLevel  ( 7, 0 ) );
+  frameSize = encoder.finishFrame ( frame );
+  CWW_TEST_CHECK ( frameSize <= CWW_LED_PROTOCOL_MAX_FRAME && frame[frameSize - 1] == 0 );
+  CWW_TEST_CHECK ( memchr ( frame, 0, frameSize - 1 ) == NULL );
+  sendBytes ( frame, frameSize );
+  CWW_TEST_CHECK ( receiveAll ( protocol ) == 1 );
+  CWW_TEST_CHECK ( pinLevel ( 0 ) == 255 );
+  for ( channel = 1; channel < TEST_CHANNEL_COUNT - 1; channel++ ) CWW_TEST_CHECK ( pinLevel ( channel ) == 20 * channel );
+  CWW_TEST_CHECK ( controllers[7]->currentLevel () == 0 );
+  CWW_TEST_CHECK ( protocol.valueOfCommandCount () == TEST_CHANNEL_COUNT );
+
+  // A run of levels too long for the payload is refused, whatever its
+  // length, and leaves the frame as it was...
+  encoder.beginFrame ();
+  CWW_TEST_CHECK ( encoder.addLevel ( 2, 1 ) );
+  CWW_TEST_CHECK ( ! encoder.addLevels ( 0, 254, noise ) && ! encoder.addLevels ( 0, 255, noise ) );
+  CWW_TEST_CHECK ( ! encoder.addLevels ( 0, CWW_LED_PROTOCOL_MAX_PAYLOAD - 5, noise ) );
+  CWW_TEST_CHECK ( encoder.addLevels ( 0, CWW_LED_PROTOCOL_MAX_PAYLOAD - 6, noise ) && ! encoder.addLevel ( 2, 1 ) );
+  encoder.beginFrame ();
+  frameSize = encoder.finishFrame ( frames );
+  CWW_TEST_CHECK ( ! encoder.addLevels ( 0, 253, noise ) );
+  CWW_TEST_CHECK ( encoder.finishFrame ( frame ) == frameSize && memcmp ( frame, frames, frameSize ) == 0 );
+
+  // A frame written byte by byte...
+  encoder.beginFrame ();
+  encoder.addLevel ( 2, 77 );
+  frameSize = encoder.finishFrame ( frame );
+  for ( byteIndex = 0; byteIndex < frameSize; byteIndex++ ) {
+    sendBytes ( frame + byteIndex, 1 );
+    protocol.receiveFrom ( *slaveStream );
+  }
+  receiveAll ( protocol );
+  CWW_TEST_CHECK ( pinLevel ( 2 ) == 77 );
+
+  // Several frames in one write, with empty frames (extra delimiters)
+  // in between...
+  framesSize = 0;
+  encoder.beginFrame ();
+  encoder.addLevel ( 3, 33 );
+  framesSize += encoder.finishFrame ( frames + framesSize );
+  frames[framesSize++] = 0;
+  frames[framesSize++] = 0;
+  encoder.beginFrame ();
+  encoder.addMode ( 4, LED_OFF );
+  framesSize += encoder.finishFrame ( frames + framesSize );
+  sendBytes ( frames, framesSize );
+  CWW_TEST_CHECK ( receiveAll ( protocol ) == 2 );
+  CWW_TEST_CHECK ( pinLevel ( 3 ) == 33 && pinLevel ( 4 ) == 0 );
+  CWW_TEST_CHECK ( protocol.valueOfFrameCount () == 4 );
+  CWW_TEST_CHECK ( protocol.valueOfErrorCount () == 0 );
+
+  // A full payload fits a frame; the encoder refuses more...
+  encoder.beginFrame ();
+  while ( encoder.addLevel ( 5, encoder.valueOfPayloadLength () ) ) {}
+  payloadLength = encoder.valueOfPayloadLength ();
+  CWW_TEST_CHECK ( payloadLength > CWW_LED_PROTOCOL_MAX_PAYLOAD - 3 );
+  frameSize = encoder.finishFrame ( frame );
+  sendBytes ( frame, frameSize );
+  CWW_TEST_CHECK ( receiveAll ( protocol ) == 1 );
+  CWW_TEST_CHECK ( pinLevel ( 5 ) == payloadLength - 3 );  // level of last command
+
+  // CRC error: one data bit flipped; nothing of the frame is applied, and
+  // the next frame is received again...
+  encoder.beginFrame ();
+  encoder.addLevel ( 1, 111 );
+  encoder.addLevel ( 6, 166 );
+  frameSize = encoder.finishFrame ( frame );
+  CWW_TEST_CHECK ( frame[frameSize - 4] == 166 );  // a data byte, not a COBS code
+  errorCount = protocol.valueOfErrorCount ();
+  frame[frameSize - 4] ^= 0x10;
+  sendBytes ( frame, frameSize );
+  CWW_TEST_CHECK ( receiveAll ( protocol ) == 0 );
+  CWW_TEST_CHECK ( protocol.valueOfErrorCount () == errorCount + 1 );
+  CWW_TEST_CHECK ( pinLevel ( 1 ) == 20 && pinLevel ( 6 ) == 120 );
+  frame[frameSize - 4] ^= 0x10;
+  sendBytes ( frame, frameSize );
+  CWW_TEST_CHECK ( receiveAll ( protocol ) == 1 );
+  CWW_TEST_CHECK ( pinLevel ( 1 ) == 111 && pinLevel ( 6 ) == 166 );
+
+  // COBS error: a frame cut short, its last block ending before the
+  // count of its code byte...
+  encoder.beginFrame ();
+  encoder.addLevel ( 1, 1 );
+  frameSize = encoder.finishFrame ( frame );
+  errorCount = protocol.valueOfErrorCount ();
+  frame[frameSize - 3] = 0;
+  sendBytes ( frame, frameSize - 2 );
+  CWW_TEST_CHECK ( receiveAll ( protocol ) == 0 );
+  CWW_TEST_CHECK ( protocol.valueOfErrorCount () == errorCount + 1 );
+  CWW_TEST_CHECK ( pinLevel ( 1 ) == 111 );
+
+  // Overflow: line noise without delimiters, longer than any frame...
+  memset ( noise, 0x55, sizeof ( noise ) );
+  errorCount = protocol.valueOfErrorCount ();
+  sendBytes ( noise, sizeof ( noise ) );
+  encoder.beginFrame ();
+  encoder.addLevel ( 1, 101 );
+  frameSize = encoder.finishFrame ( frame );
+  sendBytes ( frame, frameSize );  // noise ends at the frame's delimiter...
+  sendBytes ( frame, frameSize );  // ...so only the second copy gets through
+  CWW_TEST_CHECK ( receiveAll ( protocol ) == 1 );
+  CWW_TEST_CHECK ( protocol.valueOfErrorCount () == errorCount + 1 );
+  CWW_TEST_CHECK ( pinLevel ( 1 ) == 101 );
+
+  CWW_TEST_CHECK ( slaveStream->readCount == writtenCount );
+
+  delete slaveStream;
+  close ( slaveFd );
+  close ( masterFd );
+  for ( channel = 0; channel < TEST_CHANNEL_COUNT; channel++ ) delete controllers[channel];
+
+  return cwwTestSummary ( "CwwLedProtocolTest" );
+
+}
+
+// ****************************************************************************
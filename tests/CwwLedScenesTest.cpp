@@ -0,0 +1,149 @@
+// ****************************************************************************
+//
+// LED Scenes Test
+// ---------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedScenes crossfades on a virtual timebase: levels
+// halfway through plain and split fades, and recalls that set channels
+// anew while they are still fading (after invalidate(), and when the
+// scene recalled before did not list them). Each channel must then have
+// one fade table entry at most, so that the table (one entry per channel
+// of the bank) never overflows, and every channel must end at the level
+// of the scene recalled last.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+#include <CwwLedScenes.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_CHANNELS  4
+#define TEST_CYCLES    50
+
+// ----------------------------------------------------------------------------
+
+static unsigned long virtualTime;
+
+static const cwwStructLedSceneEntry sceneBase[] = {
+  CWW_LED_SCENE_LEVEL ( 0, 0 ),
+  CWW_LED_SCENE_LEVEL ( 1, 0 ),
+  CWW_LED_SCENE_LEVEL ( 2, 0 )
+};
+static const cwwStructLedSceneEntry sceneBright[] = {  // on sceneBase
+  CWW_LED_SCENE_LEVEL ( 0, 200 ),
+  CWW_LED_SCENE_LEVEL ( 1, 200 ),
+  CWW_LED_SCENE_LEVEL ( 2, 200 ),
+  CWW_LED_SCENE_LEVEL ( 3, 200 )
+};
+static const cwwStructLedSceneEntry sceneDim[] = {     // on sceneBase; leaves channel 3 alone
+  CWW_LED_SCENE_LEVEL ( 0, 40 ),
+  CWW_LED_SCENE_LEVEL ( 2, 100 )
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long virtualMillis () {
+
+  return virtualTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void runFor ( CwwLedScenes & scenes, unsigned long durationMs ) {
+
+  unsigned long endTime;
+
+  endTime = virtualTime + durationMs;
+  while ( virtualTime < endTime ) {
+    virtualTime++;
+    scenes.updateNow ();
+  }
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedBank       bank ( TEST_CHANNELS );
+  CwwLedController controllers[TEST_CHANNELS] = { { 40, true }, { 41, true }, { 42, true }, { 43, true } };
+  CwwLedScenes     scenes ( bank );
+  uint8_t          baseScene;
+  uint8_t          brightScene;
+  uint8_t          dimScene;
+  uint8_t          channelIndex;
+  uint8_t          cycleIndex;
+
+  virtualTime = 1000;
+  CwwLedTimebase::setTimeSource ( virtualMillis );
+
+  for ( channelIndex = 0; channelIndex < TEST_CHANNELS; channelIndex++ ) bank.addChannel ( &controllers[channelIndex] );
+  baseScene   = scenes.addScene ( sceneBase,   3 );
+  brightScene = scenes.addScene ( sceneBright, 4, baseScene );
+  dimScene    = scenes.addScene ( sceneDim,    2, baseScene );
+  CWW_TEST_CHECK ( baseScene != LED_SCENE_NONE && brightScene != LED_SCENE_NONE && dimScene != LED_SCENE_NONE );
+
+  // Plain fade: halfway at half the time...
+  scenes.recall ( baseScene );
+  CWW_TEST_CHECK ( scenes.recall ( brightScene, 1000 ) == 4 );
+  runFor ( scenes, 500 );
+  CWW_TEST_CHECK ( controllers[0].currentLevel () >= 98 && controllers[0].currentLevel () <= 102 );
+  runFor ( scenes, 520 );
+  CWW_TEST_CHECK ( controllers[0].currentLevel () == 200 && ! scenes.isFading () );
+
+  // Split fade: falling levels over 200 ms, rising over 1000 ms...
+  scenes.recall ( dimScene, 1000, 200 );
+  runFor ( scenes, 220 );
+  CWW_TEST_CHECK ( controllers[0].currentLevel () == 40 && controllers[1].currentLevel () == 0 );
+  CWW_TEST_CHECK ( controllers[3].currentLevel () == 200 );
+  runFor ( scenes, 1000 );
+  CWW_TEST_CHECK ( ! scenes.isFading () );
+
+  // Recall, invalidate and recall the same scene while it fades...
+  for ( cycleIndex = 0; cycleIndex < TEST_CYCLES; cycleIndex++ ) {
+    scenes.recall ( brightScene, 1000 );
+    runFor ( scenes, 10 );
+    scenes.invalidate ();
+    CWW_TEST_CHECK ( ! scenes.isFading () );
+  }
+  scenes.recall ( brightScene, 1000 );
+  runFor ( scenes, 1020 );
+  for ( channelIndex = 0; channelIndex < TEST_CHANNELS; channelIndex++ ) {
+    CWW_TEST_CHECK ( controllers[channelIndex].currentLevel () == 200 );
+  }
+  CWW_TEST_CHECK ( ! scenes.isFading () );
+
+  // Alternate with a scene that leaves channel 3 alone (its applied state
+  // is then unknown) while channel 3 still fades up...
+  scenes.recall ( baseScene );
+  controllers[3].setLevel ( 0 );
+  scenes.invalidate ();
+  for ( cycleIndex = 0; cycleIndex < TEST_CYCLES; cycleIndex++ ) {
+    scenes.recall ( brightScene, 1000 );
+    runFor ( scenes, 5 );
+    scenes.recall ( dimScene, 1000 );
+    runFor ( scenes, 5 );
+  }
+  scenes.recall ( brightScene, 1000 );
+  runFor ( scenes, 1020 );
+  for ( channelIndex = 0; channelIndex < TEST_CHANNELS; channelIndex++ ) {
+    CWW_TEST_CHECK ( controllers[channelIndex].currentLevel () == 200 );
+  }
+  CWW_TEST_CHECK ( ! scenes.isFading () );
+
+  CwwLedTimebase::setTimeSource ( NULL );
+
+  return cwwTestSummary ( "CwwLedScenesTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,113 @@
+// ****************************************************************************
+//
+// LED Sequence Builder Test
+// -------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedSequenceBuilder: a table built at compile time must
+// hold the header and steps useTable expects (its size checked by the
+// compiler), and play exactly as the same sequence built by addStep and
+// addParamStep, repeat count included, at every refresh.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedSequenceBuilder.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_REFRESH_COUNT  150
+#define TEST_REFRESH_MS     10
+#define TEST_REPEAT_COUNT   3
+
+// ----------------------------------------------------------------------------
+
+CWW_LED_SEQUENCE_TABLE ( testTable,
+  CwwLedSequenceBuilder<>().on ( 0 ).off ( 100 ).param ( 0, LED_PARAM_BLINK_PERIOD, 40 ).blink ( 50, 4 )
+                           .hold ( 200, 60 ).off ( 100 ).repeat ( TEST_REPEAT_COUNT ) );
+
+static_assert ( decltype ( testTable )::stepCount == 6, "one step per builder call" );
+static_assert ( decltype ( testTable )::byteSize == SEQUENCE_TABLE_HEADER_BYTES + 6 * SEQUENCE_TABLE_STEP_BYTES, "table size" );
+static_assert ( sizeof ( testTable ) == decltype ( testTable )::byteSize, "table without padding" );
+static_assert ( CwwLedSequenceBuilder<>::byteSize == SEQUENCE_TABLE_HEADER_BYTES, "empty table is its header" );
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void buildSequence ( CwwLedSequence & sequence ) {
+
+  sequence.discardAll ();
+  sequence.addStep ( 0,   LED_ON );
+  sequence.addStep ( 100, LED_OFF );
+  sequence.addParamStep ( 0, LED_PARAM_BLINK_PERIOD, 40 );
+  sequence.addStep ( 50,  LED_BLINK, 4 );
+  sequence.addStep ( 200, LED_HOLD_LEVEL, 60 );
+  sequence.addStep ( 100, LED_OFF );
+  sequence.setRepeatCount ( TEST_REPEAT_COUNT );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void playSequence ( CwwLedSequence & sequence, uint8_t pin, int * trace ) {
+
+  CwwLedController controller ( pin, true );
+  uint16_t         refreshIndex;
+
+  controller.setRefreshInterval ( TEST_REFRESH_MS );
+  controller.installSequence ( &sequence );
+  controller.startSequence ();
+
+  for ( refreshIndex = 0; refreshIndex < TEST_REFRESH_COUNT; refreshIndex++ ) {
+    controller.updateNow ();
+    trace[refreshIndex] = hostPinValues[pin];
+    hostAdvance ( TEST_REFRESH_MS * 1000UL );
+  }
+
+  CWW_TEST_CHECK ( ! controller.isPlayingSequence () );
+  controller.removeSequence ();
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedSequence sequence;
+  const uint8_t * tableBytes;
+  int            builtTrace[TEST_REFRESH_COUNT];
+  int            tableTrace[TEST_REFRESH_COUNT];
+  uint16_t       refreshIndex;
+  uint16_t       wrongCount;
+  uint8_t        levelCount;
+
+  // The header: step count (low byte first) and repeat count...
+  tableBytes = testTable.tableBytes ();
+  CWW_TEST_CHECK ( tableBytes[0] == 6 && tableBytes[1] == 0 && tableBytes[2] == TEST_REPEAT_COUNT );
+
+  buildSequence ( sequence );
+  CWW_TEST_CHECK ( ! sequence.isTable () && sequence.valueOfStepCount () == 6 );
+  playSequence ( sequence, 40, builtTrace );
+
+  CWW_TEST_CHECK ( sequence.useTable ( tableBytes ) );
+  CWW_TEST_CHECK ( sequence.isTable () && sequence.valueOfStepCount () == 6 );
+  playSequence ( sequence, 41, tableTrace );
+
+  // Both play alike, through every step: on, off, blinking, held...
+  wrongCount = 0;
+  levelCount = 0;
+  for ( refreshIndex = 0; refreshIndex < TEST_REFRESH_COUNT; refreshIndex++ ) {
+    if ( tableTrace[refreshIndex] != builtTrace[refreshIndex] ) wrongCount++;
+    if ( builtTrace[refreshIndex] == 60 ) levelCount++;
+  }
+  CWW_TEST_CHECK ( wrongCount == 0 );
+  CWW_TEST_CHECK ( levelCount == TEST_REPEAT_COUNT * 10 );
+
+  return cwwTestSummary ( "CwwLedSequenceBuilderTest" );
+
+}
+
+// ****************************************************************************
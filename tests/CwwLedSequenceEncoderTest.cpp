@@ -0,0 +1,171 @@
+// ****************************************************************************
+//
+// LED Sequence Encoder Test
+// -------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedSequenceEncoder: the times the LED switches for Morse
+// code (SOS, word and letter gaps, ignored characters) and for digit blink
+// patterns (from an LED left on), and run time sequences playing exactly as
+// the compile time tables of the same text or code.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedSequenceBuilder.h>
+#include <CwwLedSequenceEncoder.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_UNIT_MS      10
+#define TEST_MAX_EDGES    40
+#define TEST_PLAY_MS      2000
+#define TEST_LONG_LENGTH  1000
+
+// ----------------------------------------------------------------------------
+
+CWW_LED_SEQUENCE_TABLE ( morseTable,  CWW_LED_MORSE ( "Hi 42, ok", TEST_UNIT_MS ) );
+CWW_LED_SEQUENCE_TABLE ( digitsTable, CWW_LED_DIGITS ( 1203, TEST_UNIT_MS ) );
+
+static_assert ( decltype ( digitsTable )::stepCount == 2 + 4, "off and period steps, then one step per digit" );
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static uint8_t playEdges ( CwwLedSequence & sequence, uint8_t pin, boolean startOn, unsigned long * edgeTimes, int * trace ) {
+
+  CwwLedController controller ( pin, true );
+  unsigned long    startTime;
+  uint8_t          edgeCount;
+  int              lastValue;
+
+  // Records the time (in ms after the start) of each change of the pin,
+  // and, if trace is given, the pin at every ms...
+  if ( startOn ) controller.turnOn ();
+  controller.installSequence ( &sequence );
+  lastValue = hostPinValues[pin];
+  edgeCount = 0;
+  startTime = hostMillis;
+  controller.startSequence ();
+  while ( hostMillis - startTime < TEST_PLAY_MS ) {
+    controller.updateNow ();
+    if ( trace != NULL ) trace[hostMillis - startTime] = hostPinValues[pin];
+    if ( hostPinValues[pin] != lastValue ) {
+      lastValue = hostPinValues[pin];
+      if ( edgeCount < TEST_MAX_EDGES ) edgeTimes[edgeCount] = hostMillis - startTime;
+      edgeCount++;
+    }
+    hostAdvance ( 1000 );
+  }
+  controller.removeSequence ();
+
+  return edgeCount;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static boolean edgesAre ( const unsigned long * edgeTimes, uint8_t edgeCount, const unsigned long * expectedTimes, uint8_t expectedCount ) {
+
+  uint8_t edgeIndex;
+
+  if ( edgeCount != expectedCount ) return false;
+  for ( edgeIndex = 0; edgeIndex < edgeCount; edgeIndex++ ) {
+    if ( edgeTimes[edgeIndex] != expectedTimes[edgeIndex] ) return false;
+  }
+
+  return true;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static uint16_t traceDifferences ( const int * trace, const int * otherTrace ) {
+
+  uint16_t timeIndex;
+  uint16_t differenceCount;
+
+  differenceCount = 0;
+  for ( timeIndex = 0; timeIndex < TEST_PLAY_MS; timeIndex++ ) {
+    if ( trace[timeIndex] != otherTrace[timeIndex] ) differenceCount++;
+  }
+
+  return differenceCount;
+
+}
+
+// ============================================================================
+
+int main () {
+
+  // SOS: a word gap (7 units), dits of 1 unit, dahs of 3, 1 unit between
+  // elements and 3 between letters...
+  static const unsigned long sosTimes[] = { 70, 80, 90, 100, 110, 120, 150, 180, 190, 220, 230, 260,
+                                            290, 300, 310, 320, 330, 340 };
+  // E and T, by a word gap, or by a letter gap past an ignored character...
+  static const unsigned long wordTimes[]   = { 70, 80, 150, 180 };
+  static const unsigned long letterTimes[] = { 70, 80, 110, 140 };
+  // 4 then 2: off first, 10 units to the first blink (less the one the
+  // last digit's blinks leave), 5 between digits...
+  static const unsigned long digitTimes[]  = { 0, 130, 140, 150, 160, 170, 180, 190, 200, 250, 260, 270, 280 };
+
+  static int     sequenceTrace[TEST_PLAY_MS];
+  static int     tableTrace[TEST_PLAY_MS];
+  static char    longText[TEST_LONG_LENGTH + 1];
+  CwwLedSequence sequence;
+  CwwLedSequence tableSequence;
+  unsigned long  edgeTimes[TEST_MAX_EDGES];
+  uint8_t        edgeCount;
+
+  CWW_TEST_CHECK ( CwwLedSequenceEncoder::fillMorse ( sequence, "SOS", TEST_UNIT_MS ) );
+  CWW_TEST_CHECK ( sequence.valueOfStepCount () == 18 );
+  edgeCount = playEdges ( sequence, 50, false, edgeTimes, NULL );
+  CWW_TEST_CHECK ( edgesAre ( edgeTimes, edgeCount, sosTimes, sizeof sosTimes / sizeof sosTimes[0] ) );
+
+  CwwLedSequenceEncoder::fillMorse ( sequence, "e t", TEST_UNIT_MS );
+  edgeCount = playEdges ( sequence, 50, false, edgeTimes, NULL );
+  CWW_TEST_CHECK ( edgesAre ( edgeTimes, edgeCount, wordTimes, sizeof wordTimes / sizeof wordTimes[0] ) );
+  CwwLedSequenceEncoder::fillMorse ( sequence, "e,t", TEST_UNIT_MS );
+  edgeCount = playEdges ( sequence, 50, false, edgeTimes, NULL );
+  CWW_TEST_CHECK ( edgesAre ( edgeTimes, edgeCount, letterTimes, sizeof letterTimes / sizeof letterTimes[0] ) );
+
+  // Digits from an LED left on, which is switched off first (the first
+  // edge); blinks start on...
+  CWW_TEST_CHECK ( CwwLedSequenceEncoder::fillDigits ( sequence, 42, TEST_UNIT_MS ) );
+  CWW_TEST_CHECK ( sequence.valueOfStepCount () == 2 + 2 );
+  edgeCount = playEdges ( sequence, 50, true, edgeTimes, NULL );
+  CWW_TEST_CHECK ( edgesAre ( edgeTimes, edgeCount, digitTimes, sizeof digitTimes / sizeof digitTimes[0] ) );
+
+  // Run time sequences play as compile time tables...
+  CwwLedSequenceEncoder::fillMorse ( sequence, "Hi 42, ok", TEST_UNIT_MS );
+  tableSequence.useTable ( morseTable.tableBytes () );
+  CWW_TEST_CHECK ( sequence.valueOfStepCount () == tableSequence.valueOfStepCount () );
+  playEdges ( sequence,      51, false, edgeTimes, sequenceTrace );
+  playEdges ( tableSequence, 52, false, edgeTimes, tableTrace );
+  CWW_TEST_CHECK ( traceDifferences ( sequenceTrace, tableTrace ) == 0 );
+
+  CwwLedSequenceEncoder::fillDigits ( sequence, 1203, TEST_UNIT_MS );
+  tableSequence.useTable ( digitsTable.tableBytes () );
+  CWW_TEST_CHECK ( sequence.valueOfStepCount () == tableSequence.valueOfStepCount () );
+  playEdges ( sequence,      53, true, edgeTimes, sequenceTrace );
+  playEdges ( tableSequence, 54, true, edgeTimes, tableTrace );
+  CWW_TEST_CHECK ( traceDifferences ( sequenceTrace, tableTrace ) == 0 );
+
+  // Long texts are encoded in one pass...
+  memset ( longText, 'E', TEST_LONG_LENGTH );
+  longText[TEST_LONG_LENGTH] = 0;
+  CWW_TEST_CHECK ( CwwLedSequenceEncoder::fillMorse ( sequence, longText, TEST_UNIT_MS ) );
+  CWW_TEST_CHECK ( sequence.valueOfStepCount () == 2 * TEST_LONG_LENGTH );
+
+  // Units too long for the word gap or a digit are refused...
+  CWW_TEST_CHECK ( ! CwwLedSequenceEncoder::fillMorse ( sequence, "SOS", 0xFFFF / MORSE_WORD_UNITS + 1 ) );
+  CWW_TEST_CHECK ( ! CwwLedSequenceEncoder::fillDigits ( sequence, 42, 0xFFFF / 29 + 1 ) );
+
+  return cwwTestSummary ( "CwwLedSequenceEncoderTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,114 @@
+// ****************************************************************************
+//
+// LED Sequence Test
+// -----------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedSequence::validate and optimize: an optimized
+// sequence must drive the pin exactly as the original did at every
+// refresh, with and without PWM, including mode steps that show for one
+// refresh only before a zero delay step overrides them; and the range of
+// valid mode codes.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_REFRESH_COUNT  80
+#define TEST_REFRESH_MS     10
+
+// ----------------------------------------------------------------------------
+
+static void buildSequence ( CwwLedSequence & sequence ) {
+
+  sequence.discardAll ();
+  sequence.addStep ( 0,   LED_ON );
+  sequence.addStep ( 100, LED_HIGH );
+  sequence.addStep ( 100, LED_BLINK_MAX, 4 );
+  sequence.addStep ( 0,   LED_OFF );
+  sequence.addStep ( 50,  LED_FADE_UP );
+  sequence.addStep ( 100, LED_ON );
+  sequence.addStep ( 100, LED_ON );   // repeats the previous step
+  sequence.addStep ( 100, LED_OFF );
+  sequence.addStep ( 100, LED_ON );
+  sequence.addStep ( 0,   LED_OFF );  // hides the previous step, but for one refresh
+  sequence.addParamStep ( 50, LED_PARAM_BLINK_PERIOD, 40 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void playSequence ( CwwLedSequence & sequence, boolean usePwm, uint8_t pin, int * trace ) {
+
+  CwwLedController controller ( pin, usePwm );
+  uint16_t         refreshIndex;
+
+  controller.setRefreshInterval ( TEST_REFRESH_MS );
+  controller.installSequence ( &sequence );
+  controller.startSequence ();
+
+  for ( refreshIndex = 0; refreshIndex < TEST_REFRESH_COUNT; refreshIndex++ ) {
+    controller.updateNow ();
+    trace[refreshIndex] = hostPinValues[pin];
+    hostAdvance ( TEST_REFRESH_MS * 1000UL );
+  }
+
+  controller.removeSequence ();
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedSequence sequence;
+  int            originalTrace[TEST_REFRESH_COUNT];
+  int            optimizedTrace[TEST_REFRESH_COUNT];
+  boolean        usePwm;
+  uint16_t       refreshIndex;
+
+  for ( usePwm = false; ; usePwm = true ) {
+
+    buildSequence ( sequence );
+    CWW_TEST_CHECK ( sequence.validate ( usePwm ) & SEQUENCE_ISSUE_REDUNDANT_STEP );
+    CWW_TEST_CHECK ( sequence.validate ( usePwm ) & SEQUENCE_ISSUE_HIDDEN_STEP );
+    playSequence ( sequence, usePwm, 10, originalTrace );
+
+    // Repeated steps go (without PWM, also steps repeating a substitute);
+    // hidden steps stay...
+    CWW_TEST_CHECK ( sequence.optimize ( usePwm ) == ( usePwm ? 1 : 3 ) );
+    CWW_TEST_CHECK ( sequence.valueOfStepCount () == ( usePwm ? 10 : 8 ) );
+    CWW_TEST_CHECK ( ! ( sequence.validate ( usePwm ) & SEQUENCE_ISSUE_REDUNDANT_STEP ) );
+    playSequence ( sequence, usePwm, 11, optimizedTrace );
+
+    CWW_TEST_CHECK ( memcmp ( originalTrace, optimizedTrace, sizeof ( originalTrace ) ) == 0 );
+
+    // The hidden step does show, for one refresh...
+    refreshIndex = 650 / TEST_REFRESH_MS;
+    CWW_TEST_CHECK ( optimizedTrace[refreshIndex - 1] == 0
+                  && optimizedTrace[refreshIndex]     == 255
+                  && optimizedTrace[refreshIndex + 1] == 0 );
+
+    if ( usePwm ) break;
+
+  }
+
+  // Every mode is a valid step code; LED_MODE_COUNT and above are not...
+  sequence.discardAll ();
+  sequence.addStep ( 0, LED_ENVELOPE_OFF );
+  CWW_TEST_CHECK ( ! ( sequence.validate ( true ) & SEQUENCE_ISSUE_BAD_CODE ) );
+  sequence.addStep ( 0, LED_MODE_COUNT );
+  CWW_TEST_CHECK ( sequence.validate ( true ) & SEQUENCE_ISSUE_BAD_CODE );
+  CWW_TEST_CHECK ( sequence.optimize ( true ) == 0 );
+
+  return cwwTestSummary ( "CwwLedSequenceTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,356 @@
+// ****************************************************************************
+//
+// LED Soak Test
+// -------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Fast-forward host soak test: 100 controllers (blinking, oscillating,
+// playing repeating sequences with parameter steps, and taking random
+// mode commands) run through days of virtual time. Time never steps by
+// the ms; the driver keeps the next due time of every channel (from
+// millisUntilUpdate, or the next random command) in a heap, jumps the
+// virtual clock straight to the earliest one and updates only that
+// channel. After every event the channel's invariants are checked (see
+// CwwLedController::checkInvariants), and a channel must not stay due at
+// the same time for more than a few updates (zero delay sequence steps
+// take one update each).
+//
+// Quiescent channels are skipped analytically: an endless blink,
+// oscillation or repeating sequence looks the same a whole number of
+// periods later, so once a channel has run a full period, it jumps by
+// whole periods (up to SOAK_SKIP_MS at a time) instead of visiting every
+// phase edge. Each channel's controller runs on its own time (the virtual
+// time less the time it skipped; see channelTime), so it sees no jump.
+// Channels taking random commands are never skipped.
+//
+//   CwwLedSoakTest           30 simulated days (as run by make check)
+//   CwwLedSoakTest 1         1 simulated day
+//
+// The run fails on any invariant issue. It also reports its speed, so
+// that performance changes can be compared on the same host. Refresh
+// driven modes (fades, oscillation) need one update per refresh interval
+// while they are run; they set the cost of a run.
+//
+// ****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedController.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define SOAK_LED_COUNT       100
+#define SOAK_FIRST_PIN       100
+#define SOAK_DAY_MS          86400000UL
+#define SOAK_MAX_REPORTS     10
+#define SOAK_MAX_SAME_TIME   16      // updates of a channel at one time
+#define SOAK_DEFAULT_DAYS    30
+#define SOAK_SKIP_MS         3600000UL  // most time skipped at once; a full period is run in between
+
+// ----------------------------------------------------------------------------
+
+static unsigned long virtualTime;
+static unsigned long channelTime;  // time source of the channel being run
+
+static const unsigned long sequencePeriods[3] = { 16000, 39400, 60750 };  // sums of step delays
+
+static CwwLedController * controllers[SOAK_LED_COUNT];
+static CwwLedSequence     sequences[3];
+static unsigned long      commandTimes[SOAK_LED_COUNT];  // next random command; 0 for none
+static unsigned long      dueTimes[SOAK_LED_COUNT];
+static uint8_t            sameTimeCounts[SOAK_LED_COUNT];
+static uint8_t            heap[SOAK_LED_COUNT];          // channels, earliest due time first
+static unsigned long      skipPeriods[SOAK_LED_COUNT];   // period of an endless pattern; 0 for none
+static unsigned long      skipStarts[SOAK_LED_COUNT];    // virtual time the full period before a skip started
+static unsigned long      skippedTimes[SOAK_LED_COUNT];  // virtual time skipped; see channelTime
+static uint32_t           randomState;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long virtualMillis () {
+
+  return channelTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static uint32_t nextRandom ( uint32_t range ) {
+
+  randomState = randomState * 1664525UL + 1013904223UL;
+
+  return ( randomState >> 8 ) % range;
+
+}
+
+// ----------------------------------------------------------------------------
+
+static void siftDown ( uint8_t heapIndex ) {
+
+  uint8_t channel;
+  uint8_t childIndex;
+
+  channel = heap[heapIndex];
+
+  for ( ;; ) {
+    childIndex = 2 * heapIndex + 1;
+    if ( childIndex >= SOAK_LED_COUNT ) break;
+    if ( childIndex + 1 < SOAK_LED_COUNT && dueTimes[heap[childIndex + 1]] < dueTimes[heap[childIndex]] ) childIndex++;
+    if ( dueTimes[heap[childIndex]] >= dueTimes[channel] ) break;
+    heap[heapIndex] = heap[childIndex];
+    heapIndex = childIndex;
+  }
+
+  heap[heapIndex] = channel;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long dueTimeOf ( uint8_t channel ) {
+
+  unsigned long untilUpdate;
+  unsigned long dueTime;
+
+  untilUpdate = controllers[channel]->millisUntilUpdate ();
+  dueTime     = untilUpdate == UPDATE_NOT_SCHEDULED ? (unsigned long) -1 : channelTime + skippedTimes[channel] + untilUpdate;
+
+  if ( commandTimes[channel] != 0 && commandTimes[channel] < dueTime ) dueTime = commandTimes[channel];
+
+  return dueTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static boolean skipPeriodsOf ( uint8_t channel, unsigned long endTime ) {
+
+  unsigned long skipTime;
+
+  // After a full period has been run, skip as many whole periods as fit
+  // before the end of the run, then run a full period again...
+  if ( skipPeriods[channel] == 0 || virtualTime - skipStarts[channel] < skipPeriods[channel] ) return false;
+
+  skipTime = endTime - virtualTime < SOAK_SKIP_MS ? endTime - virtualTime : SOAK_SKIP_MS;
+  skipTime = skipTime / skipPeriods[channel] * skipPeriods[channel];
+  if ( skipTime == 0 ) return false;
+
+  skippedTimes[channel] += skipTime;
+  skipStarts[channel]    = virtualTime + skipTime;
+
+  return true;
+
+}
+
+// ----------------------------------------------------------------------------
+
+static void buildSequences () {
+
+  // Status pattern: on, short off, a burst of blinks, fade up, hold...
+  sequences[0].addStep ( 0,    LED_ON );
+  sequences[0].addStep ( 2000, LED_OFF );
+  sequences[0].addStep ( 500,  LED_BLINK_MAX, 6 );
+  sequences[0].addStep ( 3000, LED_FADE_UP );
+  sequences[0].addStep ( 1500, LED_HIGH );
+  sequences[0].addStep ( 9000, LED_LOW );
+  sequences[0].setRepeatCount ( 0 );
+
+  // Parameter steps changing periods and range mid sequence...
+  sequences[1].addParamStep ( 0,   LED_PARAM_BLINK_PERIOD, 300 );
+  sequences[1].addStep      ( 0,   LED_BLINK_LEVEL, 8 );
+  sequences[1].addParamStep ( 1200, LED_PARAM_LEVEL_RANGE, 40 | ( 200 << 8 ) );
+  sequences[1].addParamStep ( 0,   LED_PARAM_OSCILLATE_PERIOD, 1600 );
+  sequences[1].addStep      ( 0,   LED_OSCILLATE, 4 );
+  sequences[1].addStep      ( 3200, LED_HOLD_LEVEL );
+  sequences[1].addParamStep ( 30000, LED_PARAM_LEVEL_RANGE, 0 | ( 255 << 8 ) );
+  sequences[1].addStep      ( 0,   LED_TOGGLE );
+  sequences[1].addStep      ( 5000, LED_TOGGLE );
+  sequences[1].setRepeatCount ( 0 );
+
+  // Slow heartbeat with steps and a long pause...
+  sequences[2].addStep ( 0,     LED_STEP_UP, 64 );
+  sequences[2].addStep ( 250,   LED_STEP_UP, 64 );
+  sequences[2].addStep ( 250,   LED_STEP_DOWN, 128 );
+  sequences[2].addStep ( 250,   LED_FADE_DOWN );
+  sequences[2].addStep ( 60000, LED_OFF );
+  sequences[2].setRepeatCount ( 0 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void startChannel ( uint8_t channel ) {
+
+  CwwLedController * controllerPtr;
+
+  controllerPtr = controllers[channel];
+  commandTimes[channel] = 0;
+  skipStarts[channel]   = virtualTime;
+
+  switch ( channel % 6 ) {
+    case 0:  // plain blink
+      controllerPtr->setBlinkPeriod ( 400 + 37 * channel );
+      controllerPtr->blink ();
+      skipPeriods[channel] = controllerPtr->valueOfBlinkPeriod ();
+      break;
+    case 1:  // slow heartbeat oscillation
+      controllerPtr->setOscillatePeriod ( 3000 + 50 * channel );
+      controllerPtr->setRefreshInterval ( 40 );
+      controllerPtr->oscillate ();
+      skipPeriods[channel] = controllerPtr->valueOfOscillatePeriod ();
+      break;
+    case 2:
+    case 3:
+    case 4:  // repeating sequences
+      controllerPtr->installSequence ( &sequences[channel % 6 - 2] );
+      controllerPtr->startSequence ();
+      skipPeriods[channel] = sequencePeriods[channel % 6 - 2];
+      break;
+    case 5:  // random mode commands
+      commandTimes[channel] = virtualTime + 1 + nextRandom ( 60000 );
+      skipPeriods[channel]  = 0;
+      break;
+  }
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void runCommand ( uint8_t channel ) {
+
+  static const cwwEnumLedMode commandModes[] = {
+    LED_OFF, LED_ON, LED_LOW, LED_HIGH, LED_TOGGLE, LED_BLINK, LED_BLINK_LEVEL, LED_STEP_UP, LED_STEP_DOWN,
+    LED_FADE_DOWN, LED_FADE_UP, LED_FADE_REVERSE, LED_OSCILLATE, LED_HOLD_LEVEL, LED_ENVELOPE_ON, LED_ENVELOPE_OFF
+  };
+
+  CwwLedController * controllerPtr;
+
+  controllerPtr = controllers[channel];
+
+  switch ( nextRandom ( 8 ) ) {
+    case 0:
+      controllerPtr->setLevelRange ( nextRandom ( 100 ), 101 + nextRandom ( 155 ) );
+      break;
+    case 1:
+      controllerPtr->setLevel ( nextRandom ( 256 ) );
+      break;
+    default:
+      controllerPtr->setMode ( commandModes[nextRandom ( sizeof ( commandModes ) / sizeof ( commandModes[0] ) )],
+                               nextRandom ( 4 ) == 0 ? 0 : 1 + nextRandom ( 10 ), nextRandom ( 40 ) );
+      break;
+  }
+
+  commandTimes[channel] = virtualTime + 1 + nextRandom ( 60000 );
+
+}
+
+// ============================================================================
+
+int main ( int argumentCount, char ** arguments ) {
+
+  unsigned long simulatedDays;
+  unsigned long endTime;
+  unsigned long eventCount;
+  unsigned long updateCount;
+  unsigned long commandCount;
+  unsigned long skipCount;
+  unsigned long issueCount;
+  unsigned long stallCount;
+  uint8_t       channel;
+  uint8_t       stateIssues;
+  double        startSeconds;
+  double        wallSeconds;
+
+  simulatedDays = argumentCount > 1 ? strtoul ( arguments[1], NULL, 10 ) : SOAK_DEFAULT_DAYS;
+  if ( simulatedDays == 0 ) simulatedDays = 1;
+
+  virtualTime = 1000;
+  channelTime = virtualTime;
+  randomState = 90;
+  CwwLedTimebase::setTimeSource ( virtualMillis );
+
+  buildSequences ();
+
+  for ( channel = 0; channel < SOAK_LED_COUNT; channel++ ) {
+    controllers[channel] = new CwwLedController ( SOAK_FIRST_PIN + channel, true );
+    controllers[channel]->setEnvelope ( 100, 200, 128, 400 );
+    startChannel ( channel );
+  }
+  for ( channel = 0; channel < SOAK_LED_COUNT; channel++ ) {
+    dueTimes[channel] = dueTimeOf ( channel );
+    heap[channel]     = channel;
+  }
+  for ( channel = SOAK_LED_COUNT / 2; channel-- > 0; ) siftDown ( channel );
+
+  endTime      = virtualTime + simulatedDays * SOAK_DAY_MS;
+  eventCount   = 0;
+  updateCount  = 0;
+  commandCount = 0;
+  skipCount    = 0;
+  issueCount   = 0;
+  stallCount   = 0;
+  startSeconds = cwwTestSeconds ();
+
+  while ( dueTimes[heap[0]] < endTime ) {
+
+    channel     = heap[0];
+    virtualTime = dueTimes[channel];
+    channelTime = virtualTime - skippedTimes[channel];
+    eventCount++;
+
+    if ( commandTimes[channel] != 0 && commandTimes[channel] <= virtualTime ) {
+      runCommand ( channel );
+      commandCount++;
+    }
+    if ( controllers[channel]->updateIsDue () ) {
+      controllers[channel]->updateNow ();
+      updateCount++;
+    }
+
+    stateIssues = controllers[channel]->checkInvariants ();
+    if ( stateIssues != STATE_ISSUE_NONE && issueCount++ < SOAK_MAX_REPORTS ) {
+      printf ( "t=%lu ms channel %u: state issues 0x%02x (mode %d, level %u)\n", virtualTime, channel,
+               stateIssues, controllers[channel]->currentMode (), controllers[channel]->currentLevel () );
+    }
+
+    if ( skipPeriodsOf ( channel, endTime ) ) skipCount++;
+
+    // A channel staying due at the same time would stall time...
+    dueTimes[channel] = dueTimeOf ( channel );
+    if ( dueTimes[channel] > virtualTime ) {
+      sameTimeCounts[channel] = 0;
+    }
+    else if ( ++sameTimeCounts[channel] > SOAK_MAX_SAME_TIME ) {
+      if ( stallCount++ < SOAK_MAX_REPORTS ) printf ( "t=%lu ms channel %u: stays due\n", virtualTime, channel );
+      dueTimes[channel]       = virtualTime + 1;
+      sameTimeCounts[channel] = 0;
+    }
+    siftDown ( 0 );
+
+  }
+
+  wallSeconds = cwwTestSeconds () - startSeconds;
+
+  printf ( "CwwLedSoakTest: %lu days of %u LEDs: %lu events, %lu updates, %lu commands, %lu skips in %.2f s"
+           " (%.2f days/s)\n",
+           simulatedDays, SOAK_LED_COUNT, eventCount, updateCount, commandCount, skipCount, wallSeconds,
+           simulatedDays / wallSeconds );
+
+  CWW_TEST_CHECK ( issueCount == 0 );
+  CWW_TEST_CHECK ( stallCount == 0 );
+  CWW_TEST_CHECK ( updateCount > 0 && commandCount > 0 && skipCount > 0 );
+
+  for ( channel = 0; channel < SOAK_LED_COUNT; channel++ ) delete controllers[channel];
+  CwwLedTimebase::setTimeSource ( NULL );
+
+  return cwwTestSummary ( "CwwLedSoakTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,199 @@
+// ****************************************************************************
+//
+// Linux Sysfs LED Output Test
+// ---------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedSysfs against a temporary directory standing in for
+// /sys/class/leds: checks the brightness values written, scaling to the
+// maximum brightness, batching of writes per frame and skipped rewrites
+// of unchanged levels.
+//
+// Each check of a write first replaces the brightness file with a marker;
+// a file still holding the marker afterwards was not written.
+//
+// ****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+#include <CwwLedSysfs.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+static char classPath[64];
+
+// ----------------------------------------------------------------------------
+
+static void writeFile ( const char * ledName, const char * fileName, const char * text ) {
+
+  char   filePath[128];
+  FILE * file;
+
+  snprintf ( filePath, sizeof ( filePath ), "%s/%s/%s", classPath, ledName, fileName );
+  file = fopen ( filePath, "w" );
+  fputs ( text, file );
+  fclose ( file );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void addLedDirectory ( const char * ledName, const char * maxBrightness ) {
+
+  char ledPath[96];
+
+  snprintf ( ledPath, sizeof ( ledPath ), "%s/%s", classPath, ledName );
+  mkdir ( ledPath, 0700 );
+  writeFile ( ledName, "brightness", "0\n" );
+  if ( maxBrightness != NULL ) writeFile ( ledName, "max_brightness", maxBrightness );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void removeLedDirectory ( const char * ledName ) {
+
+  char filePath[128];
+
+  snprintf ( filePath, sizeof ( filePath ), "%s/%s/brightness", classPath, ledName );
+  unlink ( filePath );
+  snprintf ( filePath, sizeof ( filePath ), "%s/%s/max_brightness", classPath, ledName );
+  unlink ( filePath );
+  snprintf ( filePath, sizeof ( filePath ), "%s/%s", classPath, ledName );
+  rmdir ( filePath );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static long readBrightness ( const char * ledName ) {  // -1 if marker is still there
+
+  char   filePath[128];
+  char   text[16];
+  FILE * file;
+
+  snprintf ( filePath, sizeof ( filePath ), "%s/%s/brightness", classPath, ledName );
+  file = fopen ( filePath, "r" );
+  if ( fgets ( text, sizeof ( text ), file ) == NULL ) text[0] = '\0';
+  fclose ( file );
+
+  return text[0] == 'x' ? -1 : strtol ( text, NULL, 10 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void markBrightness ( const char * ledName ) {
+
+  writeFile ( ledName, "brightness", "x\n" );
+
+}
+
+// ============================================================================
+
+int main () {
+
+  strcpy ( classPath, "/tmp/CwwLedSysfsTest.XXXXXX" );
+  if ( mkdtemp ( classPath ) == NULL ) return 1;
+
+  addLedDirectory ( "green", "255\n" );
+  addLedDirectory ( "red",   "1000\n" );
+  addLedDirectory ( "blue",  NULL );     // no max_brightness: class default
+
+  {
+    CwwLedSysfs sysfs ( 4, classPath );
+
+    CWW_TEST_CHECK ( sysfs.addLed ( "green"   ) == 0 );
+    CWW_TEST_CHECK ( sysfs.addLed ( "red"     ) == 1 );
+    CWW_TEST_CHECK ( sysfs.addLed ( "blue"    ) == 2 );
+    CWW_TEST_CHECK ( sysfs.addLed ( "missing" ) == CWW_LED_SYSFS_NO_CHANNEL );
+    CWW_TEST_CHECK ( sysfs.valueOfLedCount () == 3 );
+    CWW_TEST_CHECK ( sysfs.valueOfMaxBrightness ( 0 ) == 255 );
+    CWW_TEST_CHECK ( sysfs.valueOfMaxBrightness ( 1 ) == 1000 );
+    CWW_TEST_CHECK ( sysfs.valueOfMaxBrightness ( 2 ) == 255 );
+
+    CwwLedController green ( sysfs, 0, true );
+    CwwLedController red   ( sysfs, 1, true );
+    CwwLedController blue  ( sysfs, 2, false );
+    CwwLedBank       bank  ( 3, &sysfs );
+    bank.addChannel ( &green );
+    bank.addChannel ( &red );
+    bank.addChannel ( &blue );
+
+    // Outside of a frame, a changed level is written at once, scaled to
+    // the maximum brightness of the LED...
+    markBrightness ( "red" );
+    red.setLevel ( 128 );
+    CWW_TEST_CHECK ( readBrightness ( "red" ) == 502 );  // 128 * 1000 / 255, rounded
+    red.setLevel ( 255 );
+    CWW_TEST_CHECK ( readBrightness ( "red" ) == 1000 );
+    red.setLevel ( 3 );
+    CWW_TEST_CHECK ( readBrightness ( "red" ) == 12 );   // shorter value over longer one
+
+    // Unchanged levels are not written again...
+    markBrightness ( "red" );
+    red.setLevel ( 3 );
+    CWW_TEST_CHECK ( readBrightness ( "red" ) == -1 );
+
+    // Within a frame, writes wait for the commit, and each LED is written
+    // once with its last level...
+    markBrightness ( "green" );
+    markBrightness ( "red" );
+    bank.beginFrame ();
+    green.setLevel ( 10 );
+    green.setLevel ( 20 );
+    green.setLevel ( 30 );
+    red.setLevel   ( 40 );
+    CWW_TEST_CHECK ( readBrightness ( "green" ) == -1 );
+    CWW_TEST_CHECK ( readBrightness ( "red" )   == -1 );
+    bank.commitFrame ();
+    CWW_TEST_CHECK ( readBrightness ( "green" ) == 30 );
+    CWW_TEST_CHECK ( readBrightness ( "red" )   == 157 );
+
+    // A level changed and changed back within a frame is not written...
+    markBrightness ( "green" );
+    markBrightness ( "red" );
+    bank.beginFrame ();
+    green.setLevel ( 99 );
+    green.setLevel ( 30 );
+    red.setLevel   ( 41 );
+    bank.commitFrame ();
+    CWW_TEST_CHECK ( readBrightness ( "green" ) == -1 );
+    CWW_TEST_CHECK ( readBrightness ( "red" )   == 161 );
+
+    // A frame without changes writes nothing...
+    markBrightness ( "green" );
+    markBrightness ( "red" );
+    bank.beginFrame ();
+    green.setLevel ( 30 );
+    bank.commitFrame ();
+    CWW_TEST_CHECK ( readBrightness ( "green" ) == -1 );
+    CWW_TEST_CHECK ( readBrightness ( "red" )   == -1 );
+
+    // Without PWM, an LED is either off or at maximum brightness...
+    blue.turnOn ();
+    CWW_TEST_CHECK ( readBrightness ( "blue" ) == 255 );
+    blue.turnOff ();
+    CWW_TEST_CHECK ( readBrightness ( "blue" ) == 0 );
+  }
+
+  removeLedDirectory ( "green" );
+  removeLedDirectory ( "red" );
+  removeLedDirectory ( "blue" );
+  rmdir ( classPath );
+
+  return cwwTestSummary ( "CwwLedSysfsTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,72 @@
+// ****************************************************************************
+//
+// LED Library Host Test Support
+// -----------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Checks for the host test programs in this directory. Each program is
+// built against the library and the Arduino stand-in (see host/Arduino.h)
+// and returns a non-zero exit status if any check fails:
+//
+//   CWW_TEST_CHECK ( level == 128 );
+//   ...
+//   return cwwTestSummary ( "CwwLedChaseTest" );
+//
+// ****************************************************************************
+
+#ifndef CwwLedTest_h
+#define CwwLedTest_h
+
+// ****************************************************************************
+
+#include <stdio.h>
+#include <time.h>
+
+// ============================================================================
+
+#define CWW_TEST_CHECK(condition)  cwwTestCheck ( ( condition ), #condition, __FILE__, __LINE__ )
+
+static unsigned long cwwTestCount     = 0;
+static unsigned long cwwTestFailCount = 0;
+
+// ----------------------------------------------------------------------------
+
+inline bool cwwTestCheck ( bool passed, const char * text, const char * file, int line ) {
+
+  cwwTestCount++;
+  if ( ! passed ) {
+    cwwTestFailCount++;
+    printf ( "%s:%d: check failed: %s\n", file, line, text );
+  }
+
+  return passed;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+inline int cwwTestSummary ( const char * testName ) {
+
+  printf ( "%s: %lu checks, %lu failed\n", testName, cwwTestCount, cwwTestFailCount );
+
+  return cwwTestFailCount > 0 ? 1 : 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+inline double cwwTestSeconds () {  // wall clock, for benchmarks
+
+  struct timespec now;
+
+  clock_gettime ( CLOCK_MONOTONIC, &now );
+
+  return now.tv_sec + now.tv_nsec * 1e-9;
+
+}
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************
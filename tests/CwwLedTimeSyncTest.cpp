@@ -0,0 +1,226 @@
+// ****************************************************************************
+//
+// LED Time Sync Test
+// ------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Multi-process host test of CwwLedTimeSync: the test is the master, and
+// forks three nodes, each with a simulated oscillator that is off by a
+// few thousand ppm and starts far from the master's time. The master
+// sends its beacon frames (see CwwLedProtocolEncoder) down one pipe per
+// node, which decodes them with a CwwLedProtocol, as from a serial bus.
+//
+// Time is virtual: each message carries the true time, from which each
+// node computes its own clock (skewed, offset, and read a few ms late as
+// by a busy loop), so a minute of operation runs in well under a second.
+// Once a second the master asks every node for its timebase time: after
+// settling, all nodes must be locked, within a few ms of the master, and
+// have measured the skew of their oscillator.
+//
+// ****************************************************************************
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedBank.h>
+#include <CwwLedProtocol.h>
+#include <CwwLedTimeSync.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_NODES          3
+#define TEST_SECONDS        60
+#define TEST_SETTLE_SECONDS 20     // nodes checked from then on
+#define TEST_MAX_ERROR_MS   3
+#define TEST_MAX_DRIFT_PPM  300    // error of measured skew
+#define TEST_MAX_LATE_US    3000   // loop latency of nodes
+
+enum enumTestMessage {
+  TEST_MESSAGE_BEACON,  // frame received at true time
+  TEST_MESSAGE_REPORT,  // reply with timebase time as of true time
+  TEST_MESSAGE_END
+};
+
+struct structTestMessage {
+  uint8_t            kind;
+  uint8_t            frameLength;
+  unsigned long long trueUs;
+  uint8_t            frame[CWW_LED_PROTOCOL_MAX_FRAME];
+};
+
+struct structTestReport {
+  unsigned long timeMs;
+  long          driftPpm;
+  uint8_t       isLocked;
+  uint8_t       stepCount;
+};
+
+// ----------------------------------------------------------------------------
+
+static const long          nodeSkews[TEST_NODES]   = { 5000, -3000, 100 };       // ppm; positive if fast
+static const unsigned long nodeOffsets[TEST_NODES] = { 123456, 4000000000UL, 5 }; // ms at true time 0
+
+static unsigned long long trueUs;
+static long               clockSkew;
+static unsigned long      clockOffset;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long nodeMillis () {
+
+  return clockOffset + (unsigned long) ( ( trueUs + (long long) trueUs * clockSkew / 1000000 ) / 1000 );
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long masterMillis () {
+
+  return trueUs / 1000;
+
+}
+
+// ----------------------------------------------------------------------------
+
+static int runNode ( uint8_t nodeIndex, int messageFd, int reportFd ) {
+
+  CwwLedBank        bank ( 1 );
+  CwwLedProtocol    protocol ( bank );
+  CwwLedTimeSync    timeSync;
+  structTestMessage message;
+  structTestReport  report;
+  uint8_t           byteIndex;
+
+  clockSkew   = nodeSkews[nodeIndex];
+  clockOffset = nodeOffsets[nodeIndex];
+  trueUs      = 0;
+  srand ( nodeIndex + 1 );
+  CwwLedTimebase::setTimeSource ( nodeMillis );
+  protocol.setTimeSync ( &timeSync );
+
+  while ( read ( messageFd, &message, sizeof message ) == sizeof message ) {
+
+    switch ( message.kind ) {
+
+      case TEST_MESSAGE_BEACON:
+        trueUs = message.trueUs + rand () % TEST_MAX_LATE_US;
+        for ( byteIndex = 0; byteIndex < message.frameLength; byteIndex++ ) protocol.receiveByte ( message.frame[byteIndex] );
+        timeSync.updateNow ();
+        break;
+
+      case TEST_MESSAGE_REPORT:
+        trueUs           = message.trueUs;
+        report.timeMs    = CwwLedTimebase::now ();
+        report.driftPpm  = timeSync.valueOfDrift ();
+        report.isLocked  = timeSync.isLocked ();
+        report.stepCount = timeSync.valueOfStepCount ();
+        if ( write ( reportFd, &report, sizeof report ) != sizeof report ) return 1;
+        break;
+
+      case TEST_MESSAGE_END:
+        return 0;
+
+    }
+
+  }
+
+  return 1;
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedTimeSync        timeSync;
+  CwwLedProtocolEncoder encoder;
+  structTestMessage     message;
+  structTestReport      report;
+  int                   messagePipes[TEST_NODES][2];
+  int                   reportPipes[TEST_NODES][2];
+  pid_t                 nodePids[TEST_NODES];
+  uint8_t               nodeIndex;
+  unsigned long         badCount;
+  unsigned long         reportCount;
+  long                  errorMs;
+  int                   exitStatus;
+
+  for ( nodeIndex = 0; nodeIndex < TEST_NODES; nodeIndex++ ) {
+    CWW_TEST_CHECK ( pipe ( messagePipes[nodeIndex] ) == 0 && pipe ( reportPipes[nodeIndex] ) == 0 );
+    nodePids[nodeIndex] = fork ();
+    if ( nodePids[nodeIndex] == 0 ) {
+      close ( messagePipes[nodeIndex][1] );
+      close ( reportPipes[nodeIndex][0] );
+      _exit ( runNode ( nodeIndex, messagePipes[nodeIndex][0], reportPipes[nodeIndex][1] ) );
+    }
+    close ( messagePipes[nodeIndex][0] );
+    close ( reportPipes[nodeIndex][1] );
+  }
+
+  trueUs = 0;
+  CwwLedTimebase::setTimeSource ( masterMillis );
+  memset ( &message, 0, sizeof message );
+  badCount    = 0;
+  reportCount = 0;
+
+  for ( trueUs = 0; trueUs <= TEST_SECONDS * 1000000ULL; trueUs += 1000 ) {
+
+    if ( timeSync.beaconIsDue () ) {
+      encoder.beginFrame ();
+      timeSync.addBeacon ( encoder );
+      message.kind        = TEST_MESSAGE_BEACON;
+      message.trueUs      = trueUs;
+      message.frameLength = encoder.finishFrame ( message.frame );
+      for ( nodeIndex = 0; nodeIndex < TEST_NODES; nodeIndex++ ) write ( messagePipes[nodeIndex][1], &message, sizeof message );
+    }
+
+    // Between beacons (and after a node read the last one late, so that
+    // its clock does not run back), every node must be in step with the
+    // master...
+    if ( trueUs % 1000000 != 600000 || trueUs < TEST_SETTLE_SECONDS * 1000000ULL ) continue;
+    message.kind   = TEST_MESSAGE_REPORT;
+    message.trueUs = trueUs;
+    for ( nodeIndex = 0; nodeIndex < TEST_NODES; nodeIndex++ ) {
+      write ( messagePipes[nodeIndex][1], &message, sizeof message );
+      if ( read ( reportPipes[nodeIndex][0], &report, sizeof report ) != sizeof report ) {
+        badCount++;
+        continue;
+      }
+      reportCount++;
+      errorMs = (long) ( report.timeMs - CwwLedTimebase::now () );
+      if ( labs ( errorMs ) > TEST_MAX_ERROR_MS || ! report.isLocked || report.stepCount != 1
+        || labs ( report.driftPpm + nodeSkews[nodeIndex] ) > TEST_MAX_DRIFT_PPM ) {
+        if ( badCount++ == 0 ) {
+          printf ( "node %u at %llu ms: error %ld ms, drift %ld ppm, locked %u, steps %u\n", nodeIndex, trueUs / 1000,
+                   errorMs, report.driftPpm, report.isLocked, report.stepCount );
+        }
+      }
+    }
+
+  }
+
+  message.kind = TEST_MESSAGE_END;
+  for ( nodeIndex = 0; nodeIndex < TEST_NODES; nodeIndex++ ) {
+    write ( messagePipes[nodeIndex][1], &message, sizeof message );
+    CWW_TEST_CHECK ( waitpid ( nodePids[nodeIndex], &exitStatus, 0 ) == nodePids[nodeIndex]
+                  && WIFEXITED ( exitStatus ) && WEXITSTATUS ( exitStatus ) == 0 );
+    close ( messagePipes[nodeIndex][1] );
+    close ( reportPipes[nodeIndex][0] );
+  }
+
+  CWW_TEST_CHECK ( reportCount == TEST_NODES * ( TEST_SECONDS - TEST_SETTLE_SECONDS ) );
+  CWW_TEST_CHECK ( badCount == 0 );
+
+  CwwLedTimebase::setTimeSource ( NULL );
+
+  return cwwTestSummary ( "CwwLedTimeSyncTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,134 @@
+// ****************************************************************************
+//
+// LED Timeline Test
+// -----------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedTimeline: all events due at one time are applied in
+// one update, however many; repeated iterations keep their timing; and a
+// repeating score of zero length does not lock up an update.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedBank.h>
+#include <CwwLedTimeline.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_CHANNEL_COUNT  16
+#define TEST_FIRST_PIN      40
+
+// ============================================================================
+
+int main () {
+
+  CwwLedController * controllers[TEST_CHANNEL_COUNT];
+  CwwLedBank         bank ( TEST_CHANNEL_COUNT );
+  uint8_t            channelMask[TEST_CHANNEL_COUNT / 8];
+  uint8_t            allMask[TEST_CHANNEL_COUNT / 8];
+  uint8_t            channel;
+  uint16_t           eventIndex;
+  unsigned long      writeCount;
+  boolean            eventsAreAdded;
+  boolean            levelsAreRight;
+
+  for ( channel = 0; channel < TEST_CHANNEL_COUNT; channel++ ) {
+    controllers[channel] = new CwwLedController ( TEST_FIRST_PIN + channel, true );
+    bank.addChannel ( controllers[channel] );
+  }
+  memset ( allMask, 0xFF, sizeof ( allMask ) );
+
+  // 200 level events due at the same time, more than any fixed bound per
+  // update, all apply in the one update they are due in...
+  {
+    CwwLedTimeline timeline ( bank, 256, TEST_CHANNEL_COUNT + 1 );
+
+    eventsAreAdded = true;
+    for ( eventIndex = 0; eventIndex < 200; eventIndex++ ) {
+      memset ( channelMask, 0, sizeof ( channelMask ) );
+      channel = eventIndex % TEST_CHANNEL_COUNT;
+      channelMask[channel / 8] = 1 << ( channel % 8 );
+      if ( ! timeline.addLevel ( 10, channelMask, eventIndex ) ) eventsAreAdded = false;
+    }
+    CWW_TEST_CHECK ( eventsAreAdded );
+    CWW_TEST_CHECK ( timeline.addLevel ( 20, allMask, 1 ) );
+
+    hostMillis = 1000;
+    timeline.start ();
+    CWW_TEST_CHECK ( ! timeline.updateIsDue () );
+    CWW_TEST_CHECK ( timeline.millisUntilUpdate () == 10 );
+
+    hostMillis += 10;
+    CWW_TEST_CHECK ( timeline.updateIsDue () );
+    CWW_TEST_CHECK ( timeline.updateNow () );
+    CWW_TEST_CHECK ( ! timeline.updateIsDue () );
+    levelsAreRight = true;
+    for ( channel = 0; channel < TEST_CHANNEL_COUNT; channel++ ) {
+      // Last event of each channel: the highest index below 200...
+      eventIndex = 192 + channel < 200 ? 192 + channel : 176 + channel;
+      if ( hostPinValues[TEST_FIRST_PIN + channel] != eventIndex ) levelsAreRight = false;
+    }
+    CWW_TEST_CHECK ( levelsAreRight );
+    CWW_TEST_CHECK ( timeline.millisUntilUpdate () == 10 );
+
+    hostMillis += 10;
+    CWW_TEST_CHECK ( timeline.updateNow () );
+    CWW_TEST_CHECK ( hostPinValues[TEST_FIRST_PIN] == 1 && hostPinValues[TEST_FIRST_PIN + 15] == 1 );
+    CWW_TEST_CHECK ( ! timeline.isPlaying () );
+  }
+
+  // Iterations follow each other without drift, even if updated late...
+  {
+    CwwLedTimeline timeline ( bank, 8, 2 );
+
+    timeline.addLevel ( 0,  allMask, 10 );
+    timeline.addLevel ( 50, allMask, 20 );
+    timeline.setLength ( 100 );
+    timeline.setRepeatCount ( 3 );
+
+    hostMillis = 5000;
+    timeline.start ();
+    timeline.updateNow ();
+    CWW_TEST_CHECK ( hostPinValues[TEST_FIRST_PIN] == 10 );
+    hostMillis += 130;  // late: the second iteration started 30 ms ago
+    timeline.updateNow ();
+    CWW_TEST_CHECK ( hostPinValues[TEST_FIRST_PIN] == 10 );
+    CWW_TEST_CHECK ( timeline.millisUntilUpdate () == 20 );
+    hostMillis += 20;
+    timeline.updateNow ();
+    CWW_TEST_CHECK ( hostPinValues[TEST_FIRST_PIN] == 20 );
+    hostMillis += 1000;
+    timeline.updateNow ();
+    CWW_TEST_CHECK ( ! timeline.isPlaying () );
+  }
+
+  // A repeating score of zero length applies its events once per update
+  // instead of looping forever...
+  {
+    CwwLedTimeline timeline ( bank, 8, 2 );
+
+    timeline.addLevel ( 0, allMask, 30 );
+    timeline.addLevel ( 0, allMask, 60 );
+    timeline.setRepeatCount ( 0 );
+
+    timeline.start ();
+    writeCount = hostPinWrites[TEST_FIRST_PIN];
+    CWW_TEST_CHECK ( timeline.updateNow () );
+    CWW_TEST_CHECK ( hostPinWrites[TEST_FIRST_PIN] == writeCount + 2 );
+    CWW_TEST_CHECK ( timeline.updateNow () );
+    CWW_TEST_CHECK ( hostPinWrites[TEST_FIRST_PIN] == writeCount + 4 );
+    CWW_TEST_CHECK ( hostPinValues[TEST_FIRST_PIN] == 60 && timeline.isPlaying () );
+  }
+
+  for ( channel = 0; channel < TEST_CHANNEL_COUNT; channel++ ) delete controllers[channel];
+
+  return cwwTestSummary ( "CwwLedTimelineTest" );
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,143 @@
+// ****************************************************************************
+//
+// LED Timing Probe Benchmark
+// --------------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host benchmark stepping a CwwLedTimingProbe through a grid of blink and
+// oscillate configurations: period, level range, refresh interval and
+// loop jitter. Time is virtual (see CwwLedTimebase::setTimeSource); each
+// pass of the simulated loop takes 1 ms plus a pseudo random delay of up
+// to the jitter, and updates the controller when it is due. For each
+// configuration, the period and ramp error statistics over 20 periods
+// are printed (all in ms; errors are measured minus expected).
+//
+// ****************************************************************************
+
+#include <stdio.h>
+
+#include <Arduino.h>
+
+#include <CwwLedTimebase.h>
+#include <CwwLedController.h>
+#include <CwwLedTimingProbe.h>
+
+// ============================================================================
+
+static unsigned long virtualTime;
+static uint32_t      jitterState;
+
+// ----------------------------------------------------------------------------
+
+static unsigned long virtualMillis () {
+
+  return virtualTime;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static unsigned long jitterDelay ( uint16_t jitterMs ) {
+
+  // Fixed sequence, so that runs compare...
+  jitterState = jitterState * 1664525UL + 1013904223UL;
+
+  return jitterMs > 0 ? ( jitterState >> 16 ) % ( jitterMs + 1 ) : 0;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+static void runConfiguration (
+  cwwEnumLedMode mode,
+  unsigned long  periodMs,
+  uint8_t        levelMin,
+  uint8_t        levelMax,
+  uint16_t       refreshMs,
+  uint16_t       jitterMs
+) {
+
+  CwwLedTimingProbe       probe ( 0 );
+  CwwLedController        controller ( probe, 0, true, false, periodMs, periodMs, refreshMs );
+  cwwStructLedTimingStats periodStats;
+  cwwStructLedTimingStats rampStats;
+  unsigned long           endTime;
+
+  controller.setLevelRange ( levelMin, levelMax );
+  controller.turnLow ();
+  probe.expectPeriod ( periodMs );
+  probe.expectRamp   ( periodMs / 2 );
+
+  jitterState = 12345;
+  endTime     = virtualTime + 20 * periodMs;
+  controller.setMode ( mode );
+  while ( (long) ( virtualTime - endTime ) < 0 ) {
+    virtualTime += 1 + jitterDelay ( jitterMs );
+    if ( controller.updateIsDue () ) controller.updateNow ();
+  }
+
+  periodStats = probe.valueOfPeriodStats ();
+  rampStats   = probe.valueOfRampStats ();
+
+  printf ( "%-9s %6lu  %3u-%-3u  %4u  %4u   %3u %6ld %6lu %6lu",
+           mode == LED_BLINK_LEVEL ? "blink" : "oscillate", periodMs, levelMin, levelMax, refreshMs, jitterMs,
+           periodStats.sampleCount, periodStats.meanErrorMs, periodStats.meanAbsErrorMs, periodStats.maxAbsErrorMs );
+  if ( mode == LED_OSCILLATE ) {
+    printf ( "   %3u %6ld %6lu %6lu\n",
+             rampStats.sampleCount, rampStats.meanErrorMs, rampStats.meanAbsErrorMs, rampStats.maxAbsErrorMs );
+  }
+  else {
+    printf ( "\n" );
+  }
+
+}
+
+// ============================================================================
+
+int main () {
+
+  static const unsigned long periods[]   = { 200, 500, 1000, 3000 };
+  static const uint8_t       ranges[][2] = { { 0, 255 }, { 0, 10 }, { 100, 140 } };
+  static const uint16_t      refreshes[] = { 10, 20, 30 };
+  static const uint16_t      jitters[]   = { 0, 5, 20 };
+
+  uint8_t periodIndex;
+  uint8_t rangeIndex;
+  uint8_t refreshIndex;
+  uint8_t jitterIndex;
+
+  virtualTime = 0;
+  CwwLedTimebase::setTimeSource ( virtualMillis );
+
+  printf ( "                                              ---- period ----------    ---- ramp ------------\n" );
+  printf ( "mode      period  range    refr  jitt     n   mean   mean    max     n   mean   mean    max\n" );
+  printf ( "                                                 err  |err|  |err|          err  |err|  |err|\n" );
+
+  // Blink timing does not depend on the level range...
+  for ( periodIndex = 0; periodIndex < sizeof ( periods ) / sizeof ( periods[0] ); periodIndex++ ) {
+    for ( refreshIndex = 0; refreshIndex < sizeof ( refreshes ) / sizeof ( refreshes[0] ); refreshIndex++ ) {
+      for ( jitterIndex = 0; jitterIndex < sizeof ( jitters ) / sizeof ( jitters[0] ); jitterIndex++ ) {
+        runConfiguration ( LED_BLINK_LEVEL, periods[periodIndex], 0, 255,
+                           refreshes[refreshIndex], jitters[jitterIndex] );
+      }
+    }
+  }
+
+  for ( periodIndex = 0; periodIndex < sizeof ( periods ) / sizeof ( periods[0] ); periodIndex++ ) {
+    for ( rangeIndex = 0; rangeIndex < sizeof ( ranges ) / sizeof ( ranges[0] ); rangeIndex++ ) {
+      for ( refreshIndex = 0; refreshIndex < sizeof ( refreshes ) / sizeof ( refreshes[0] ); refreshIndex++ ) {
+        for ( jitterIndex = 0; jitterIndex < sizeof ( jitters ) / sizeof ( jitters[0] ); jitterIndex++ ) {
+          runConfiguration ( LED_OSCILLATE, periods[periodIndex], ranges[rangeIndex][0], ranges[rangeIndex][1],
+                             refreshes[refreshIndex], jitters[jitterIndex] );
+        }
+      }
+    }
+  }
+
+  CwwLedTimebase::setTimeSource ( NULL );
+
+  return 0;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,97 @@
+// ****************************************************************************
+//
+// Tone Output Test
+// ----------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Host test of CwwLedTone: mapping of levels to frequencies with and
+// without PWM, and the frequency of the square wave generated by tick(),
+// counted over one second of ticks.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+#include <CwwLedController.h>
+#include <CwwLedTone.h>
+
+#include "CwwLedTest.h"
+
+// ============================================================================
+
+#define TEST_TICK_RATE  20000
+
+// ----------------------------------------------------------------------------
+
+static unsigned long countCycles ( CwwLedTone & tone, uint8_t channel ) {  // over one second
+
+  unsigned long tickIndex;
+  unsigned long risingCount;
+  boolean       lastOutput;
+
+  risingCount = 0;
+  lastOutput  = tone.valueOfOutput ( channel );
+
+  for ( tickIndex = 0; tickIndex < TEST_TICK_RATE; tickIndex++ ) {
+    tone.tick ();
+    if ( tone.valueOfOutput ( channel ) && ! lastOutput ) risingCount++;
+    lastOutput = tone.valueOfOutput ( channel );
+  }
+
+  return risingCount;
+
+}
+
+// ============================================================================
+
+int main () {
+
+  CwwLedTone tone ( TEST_TICK_RATE, 2, 200, 4000 );
+  unsigned long cycleCount;
+
+  CWW_TEST_CHECK ( tone.addBuzzer ( 8 ) == 0 );
+  CWW_TEST_CHECK ( tone.addBuzzer ( 9 ) == 1 );
+
+  // With PWM, levels 1 to 255 map onto the frequency range...
+  tone.writeLevel ( 0, 1, true );
+  CWW_TEST_CHECK ( tone.valueOfFrequency ( 0 ) == 200 );
+  tone.writeLevel ( 0, 128, true );
+  CWW_TEST_CHECK ( tone.valueOfFrequency ( 0 ) == 200 + 3800UL * 127 / 254 );
+  tone.writeLevel ( 0, 255, true );
+  CWW_TEST_CHECK ( tone.valueOfFrequency ( 0 ) == 4000 );
+  tone.writeLevel ( 0, 0, true );
+  CWW_TEST_CHECK ( tone.valueOfFrequency ( 0 ) == 0 );
+
+  // ...without PWM, any level but 0 is the maximum frequency...
+  tone.writeLevel ( 1, 128, false );
+  CWW_TEST_CHECK ( tone.valueOfFrequency ( 1 ) == 4000 );
+  tone.writeLevel ( 1, 1, false );
+  CWW_TEST_CHECK ( tone.valueOfFrequency ( 1 ) == 4000 );
+  tone.writeLevel ( 1, 0, false );
+  CWW_TEST_CHECK ( tone.valueOfFrequency ( 1 ) == 0 );
+
+  // ...also as driven by a controller without PWM...
+  {
+    CwwLedController beeper ( tone, 1, false );
+    beeper.turnOn ();
+    CWW_TEST_CHECK ( tone.valueOfFrequency ( 1 ) == 4000 );
+    beeper.turnOff ();
+    CWW_TEST_CHECK ( tone.valueOfFrequency ( 1 ) == 0 );
+  }
+
+  // The wave has the set frequency; silence keeps the output low...
+  tone.writeLevel ( 0, 255, true );
+  cycleCount = countCycles ( tone, 0 );
+  CWW_TEST_CHECK ( cycleCount >= 3999 && cycleCount <= 4001 );
+  tone.writeLevel ( 0, 1, true );
+  cycleCount = countCycles ( tone, 0 );
+  CWW_TEST_CHECK ( cycleCount >= 199 && cycleCount <= 201 );
+  tone.writeLevel ( 0, 0, true );
+  CWW_TEST_CHECK ( countCycles ( tone, 0 ) == 0 && ! tone.valueOfOutput ( 0 ) );
+  CWW_TEST_CHECK ( hostPinValues[8] == 0 );
+
+  return cwwTestSummary ( "CwwLedToneTest" );
+
+}
+
+// ****************************************************************************
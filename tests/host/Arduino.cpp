@@ -0,0 +1,83 @@
+// ****************************************************************************
+//
+// Arduino Host Stand-In
+// ---------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// This code implements the host stand-in for the Arduino core functions
+// used by the library.
+//
+// ****************************************************************************
+
+#include <Arduino.h>
+
+// ============================================================================
+
+unsigned long hostMillis = 0;
+unsigned long hostMicros = 0;
+uint8_t       hostPinModes[HOST_PIN_COUNT];
+int           hostPinValues[HOST_PIN_COUNT];
+unsigned long hostPinWrites[HOST_PIN_COUNT];
+unsigned int  hostToneFrequency = 0;
+unsigned long hostPullupCount   = 0;
+
+static unsigned long hostMicrosCarry = 0;  // micros not yet a full milli
+
+// ============================================================================
+
+void hostAdvance ( unsigned long stepUs ) {
+
+  hostMicros      += stepUs;
+  hostMicrosCarry += stepUs;
+  hostMillis      += hostMicrosCarry / 1000;
+  hostMicrosCarry %= 1000;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void pinMode ( uint8_t pin, uint8_t mode ) {
+
+  if ( mode == INPUT && hostPinModes[pin] != INPUT && hostPinValues[pin] != 0 ) hostPullupCount++;
+  hostPinModes[pin] = mode;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void digitalWrite ( uint8_t pin, uint8_t value ) {
+
+  if ( hostPinModes[pin] == INPUT && hostPinValues[pin] == 0 && value ) hostPullupCount++;
+  hostPinValues[pin] = value ? 255 : 0;
+  hostPinWrites[pin]++;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void analogWrite ( uint8_t pin, int value ) {
+
+  hostPinValues[pin] = value;
+  hostPinWrites[pin]++;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void tone ( uint8_t pin, unsigned int frequency ) {
+
+  (void) pin;
+  hostToneFrequency = frequency;
+
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+void noTone ( uint8_t pin ) {
+
+  (void) pin;
+  hostToneFrequency = 0;
+
+}
+
+// ****************************************************************************
@@ -0,0 +1,88 @@
+// ****************************************************************************
+//
+// Arduino Host Stand-In
+// ---------------------
+// Code by agent; V1.01-beta-01; October 2026
+//
+// Minimal stand-in for the Arduino core, so that the library and its tests
+// build and run on a host. Time does not pass by itself: tests set
+// hostMillis and hostMicros (see hostAdvance) or install their own time
+// source (see CwwLedTimebase::setTimeSource). Pin calls are recorded per
+// pin, e.g. to check levels written by a backend. As on AVR, an input pin
+// with its output latch HIGH has its pull-up on; each time that happens
+// is counted (see hostPullupCount).
+//
+// ****************************************************************************
+
+#ifndef Arduino_h
+#define Arduino_h
+
+// ****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+
+// ============================================================================
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define HIGH          1
+#define LOW           0
+#define INPUT         0
+#define OUTPUT        1
+#define INPUT_PULLUP  2
+
+#define PROGMEM
+#define memcpy_P(destination, source, count)  memcpy ( destination, source, count )
+#define pgm_read_byte(address)                ( * (const uint8_t  *) ( address ) )
+#define pgm_read_word(address)                ( * (const uint16_t *) ( address ) )
+
+#define HOST_PIN_COUNT  256
+
+extern unsigned long hostMillis;
+extern unsigned long hostMicros;
+extern uint8_t       hostPinModes[HOST_PIN_COUNT];
+extern int           hostPinValues[HOST_PIN_COUNT];   // 0 to 255; digital HIGH is 255
+extern unsigned long hostPinWrites[HOST_PIN_COUNT];
+extern unsigned int  hostToneFrequency;               // 0 while silent
+extern unsigned long hostPullupCount;                 // pull-ups switched on by INPUT with latch HIGH
+
+inline unsigned long millis () { return hostMillis; }
+inline unsigned long micros () { return hostMicros; }
+inline void          noInterrupts () {}
+inline void          interrupts   () {}
+
+void hostAdvance ( unsigned long stepUs );  // advance micros and millis together
+
+void pinMode      ( uint8_t pin, uint8_t mode );
+void digitalWrite ( uint8_t pin, uint8_t value );
+void analogWrite  ( uint8_t pin, int value );
+void tone         ( uint8_t pin, unsigned int frequency );
+void noTone       ( uint8_t pin );
+
+// ============================================================================
+
+class Stream {
+
+  public:
+
+    virtual int    available () = 0;
+    virtual int    read      () = 0;
+    virtual size_t write     ( uint8_t value ) = 0;
+    virtual size_t write     ( const uint8_t * buffer, size_t count ) {
+      size_t index;
+      for ( index = 0; index < count; index++ ) write ( buffer[index] );
+      return count;
+    }
+    virtual ~Stream () {}
+
+};
+
+// ****************************************************************************
+
+#endif
+
+// ****************************************************************************